@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""
+What-If Cycle-Time Analyzer
+
+Reads AXL call traces recorded with TracingAXL (binary log files), rebuilds
+the motion timeline and prints the recorded and predicted per-phase and
+total cycle times under modified velocities, accelerations, settle times
+and overlap rules (see cycle_trace.py).
+
+With --read-profiles the maximum velocity, accel unit and S-curve jerk of
+every traced axis are read from the AXL library (set AXL_SIMULATOR=true for
+the simulator); otherwise moves follow the commanded values unlimited.
+
+Usage:
+    python scripts/analyze_cycle_trace.py trace.blog --velocity-scale 1.2
+    python scripts/analyze_cycle_trace.py trace.blog.1 trace.blog --settle 0.05 --wait-by-profile
+    python scripts/analyze_cycle_trace.py trace.blog --phase-settle measure=0.2 --read-profiles
+"""
+
+import argparse
+import sys
+from pathlib import Path
+from typing import Dict, List
+
+PROJECT_ROOT = Path(__file__).parent.parent
+sys.path.insert(0, str(PROJECT_ROOT / "src"))
+
+
+def _assignments(values: List[str], key_type=str) -> Dict:
+    """Parse NAME=VALUE options"""
+    parsed = {}
+    for value in values:
+        key, _, number = value.partition("=")
+        parsed[key_type(key)] = float(number)
+    return parsed
+
+
+def run_analysis(args: argparse.Namespace) -> int:
+    # Local application imports
+    from infrastructure.implementation.hardware.robot.ajinextek.cycle_trace import (
+        TraceCall,
+        WhatIf,
+        build_timeline,
+        load_trace,
+    )
+
+    events = load_trace(args.traces)
+    if not events:
+        print("[ERROR] no AXL calls in the trace")
+        return 1
+
+    profiles = {}
+    if args.read_profiles:
+        # Local application imports
+        from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+        from infrastructure.implementation.hardware.robot.ajinextek.measurement_order import (
+            read_axis_profile,
+        )
+
+        axl = AXLWrapper.get_instance()
+        axl.open(7)
+        try:
+            axes = {
+                event.args[0]
+                for event in events
+                if isinstance(event, TraceCall) and event.method == "move_start_pos"
+            }
+            profiles = {axis_no: read_axis_profile(axl, axis_no) for axis_no in sorted(axes)}
+        finally:
+            axl.close()
+
+    timeline = build_timeline(
+        events,
+        profiles=profiles,
+        start_positions=_assignments(args.start_pos, int),
+        thread=args.thread,
+    )
+    what_if = WhatIf(
+        velocity=args.velocity,
+        accel=args.accel,
+        decel=args.decel,
+        velocity_scale=args.velocity_scale,
+        accel_scale=args.accel_scale,
+        settle=args.settle,
+        phase_settle=_assignments(args.phase_settle),
+        settle_during_decel=args.settle_during_decel,
+        wait_by_profile=args.wait_by_profile,
+    )
+    recorded = timeline.recorded()
+    predicted = timeline.simulate(what_if)
+
+    print("=" * 65)
+    print(f"WHAT-IF CYCLE TIME ({len(timeline.segments)} segments)")
+    print("=" * 65)
+    print(predicted.format_against(recorded))
+    print("-" * 65)
+    for kind, recorded_time in recorded.kinds.items():
+        print(f"  {kind:<10}{recorded_time:>10.3f} s -> {predicted.kinds.get(kind, 0.0):>8.3f} s")
+    print("=" * 65)
+    return 0
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("traces", nargs="+", help="binary log files, oldest first")
+    parser.add_argument("--velocity", type=float, help="replace every commanded velocity")
+    parser.add_argument("--accel", type=float, help="replace every commanded acceleration")
+    parser.add_argument("--decel", type=float, help="replace every commanded deceleration")
+    parser.add_argument("--velocity-scale", type=float, default=1.0)
+    parser.add_argument("--accel-scale", type=float, default=1.0, help="scales accel and decel")
+    parser.add_argument("--settle", type=float, help="replace every settle time (s)")
+    parser.add_argument(
+        "--phase-settle", action="append", default=[], help="PHASE=SECONDS settle of one phase"
+    )
+    parser.add_argument("--settle-during-decel", action="store_true")
+    parser.add_argument("--wait-by-profile", action="store_true")
+    parser.add_argument(
+        "--start-pos", action="append", default=[], help="AXIS=POSITION at trace start"
+    )
+    parser.add_argument("--thread", help="host thread to analyze (default: all)")
+    parser.add_argument("--read-profiles", action="store_true", help="read axis profiles via AXL")
+    args = parser.parse_args()
+
+    # Third-party imports
+    from loguru import logger
+
+    logger.remove()
+    logger.add(sys.stderr, level="WARNING")
+
+    return run_analysis(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
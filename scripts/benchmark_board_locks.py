@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""
+Per-Board Lock Contention Benchmark
+
+Runs worker threads that each drive their own axis (servo enable and
+universal output writes) through ShardedAXL against the simulated AXL
+library, once behind a single lock shared by every board and once with one
+lock per board, and prints the call throughput for each board and thread
+count.
+
+Driver calls are simulated with 1 ms sleeps, which release the GIL the way
+the real library's ctypes calls do, so the numbers show lock contention
+rather than Python overhead.
+
+Usage:
+    python scripts/benchmark_board_locks.py
+    python scripts/benchmark_board_locks.py --duration 2.0 --axes 16
+"""
+
+import argparse
+import os
+import sys
+import threading
+import time
+from pathlib import Path
+from typing import List, Tuple
+
+PROJECT_ROOT = Path(__file__).parent.parent
+sys.path.insert(0, str(PROJECT_ROOT / "src"))
+
+BOARD_COUNTS = (1, 2, 4)
+THREAD_COUNTS = (1, 2, 4, 8)
+CALL_LATENCY = 1e-3  # Simulated driver call time (s), sleep-based
+
+
+def measure(sharded, axes: List[int], threads: int, duration: float) -> float:
+    """Calls per second with each thread working its own axes for a fixed time"""
+    stop = threading.Event()
+    counts = [0] * threads
+    start = threading.Barrier(threads + 1)
+
+    def worker(index: int) -> None:
+        own = axes[index::threads] or [axes[index % len(axes)]]
+        start.wait()
+        n = 0
+        while not stop.is_set():
+            axis_no = own[n % len(own)]
+            sharded.servo_on(axis_no, 1)
+            sharded.write_universal_output(axis_no, n & 0xFF)
+            n += 2
+        counts[index] = n
+
+    workers = [threading.Thread(target=worker, args=(i,)) for i in range(threads)]
+    for thread in workers:
+        thread.start()
+    start.wait()
+    began = time.perf_counter()
+    time.sleep(duration)
+    stop.set()
+    for thread in workers:
+        thread.join()
+    return sum(counts) / (time.perf_counter() - began)
+
+
+def run_benchmark(axis_count: int, duration: float) -> List[Tuple[int, int, float, float]]:
+    """(boards, threads, single-lock calls/s, sharded calls/s) per configuration"""
+    os.environ["AXL_SIMULATOR"] = "true"
+
+    # Local application imports
+    from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+        LatencyModel,
+        SimulatedAXL,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+    from infrastructure.implementation.hardware.robot.ajinextek.board_locks import (
+        BoardTopology,
+        ShardedAXL,
+    )
+
+    latency = LatencyModel(
+        open=0.0,
+        status=0.0,
+        command=CALL_LATENCY,
+        motion=0.0,
+        io=CALL_LATENCY,
+        file=0.0,
+        jitter=0.0,
+    )
+    results = []
+    for boards in BOARD_COUNTS:
+        AXLWrapper.reset_for_testing()
+        axl = AXLWrapper.get_instance()
+        axl.dll = SimulatedAXL(axis_count=axis_count, latency=latency, board_count=boards)
+        axl.open(7)
+        try:
+            topology = BoardTopology.discover(axl)
+            # Interleave axes across boards so every thread count spreads over all boards
+            axes = sorted(range(axis_count), key=lambda a: (a % (axis_count // boards), a))
+            for threads in THREAD_COUNTS:
+                single = measure(ShardedAXL(axl, BoardTopology()), axes, threads, duration)
+                sharded = measure(ShardedAXL(axl, topology), axes, threads, duration)
+                results.append((boards, threads, single, sharded))
+        finally:
+            AXLWrapper.reset_for_testing()
+    return results
+
+
+def print_report(results: List[Tuple[int, int, float, float]]) -> None:
+    print("=" * 62)
+    print("PER-BOARD LOCK CONTENTION BENCHMARK (simulated AXL)")
+    print("=" * 62)
+    print(f"{'boards':>8}{'threads':>9}{'single [call/s]':>17}{'sharded [call/s]':>18}{'x':>8}")
+    for boards, threads, single, sharded in results:
+        print(f"{boards:>8}{threads:>9}{single:>17.0f}{sharded:>18.0f}{sharded / single:>8.2f}")
+    print("=" * 62)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--duration", type=float, default=1.0, help="seconds per configuration")
+    parser.add_argument("--axes", type=int, default=8, help="simulated axes (multiple of 4)")
+    args = parser.parse_args()
+
+    # Third-party imports
+    from loguru import logger
+
+    logger.remove()
+    logger.add(sys.stderr, level="WARNING")
+
+    print_report(run_benchmark(args.axes, args.duration))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
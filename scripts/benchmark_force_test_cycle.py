@@ -0,0 +1,343 @@
+#!/usr/bin/env python3
+"""
+Force-Test Cycle-Time Benchmark
+
+Drives the robot and DIO side of an EOL force test - bring-up, operator start
+buttons, servo enable and homing, standby stroke, temperature x position
+matrix and tower lamp updates - through the real AjinextekRobot/AjinextekDIO
+services against the simulated AXL library, and compares per-phase cycle
+times and AXL call counts with the budgets in force_test_cycle_budgets.json.
+
+Dwell times and simulated motion are accelerated by the scenario time_scale;
+driver call latencies and the services' own polling intervals are not, so
+regressions in software overhead show up undiluted.
+
+Usage:
+    python scripts/benchmark_force_test_cycle.py            # Check against budgets
+    python scripts/benchmark_force_test_cycle.py --update   # Rewrite budgets from this run
+"""
+
+import argparse
+import asyncio
+from dataclasses import dataclass, field
+import json
+import math
+import os
+import sys
+import tempfile
+import time
+from pathlib import Path
+from typing import Any, Dict, List
+
+PROJECT_ROOT = Path(__file__).parent.parent
+sys.path.insert(0, str(PROJECT_ROOT / "src"))
+
+BUDGET_FILE = Path(__file__).parent / "force_test_cycle_budgets.json"
+TIME_MARGIN = 0.25  # Headroom added to measured times by --update
+TIME_MARGIN_MIN = 0.05  # Minimum absolute time headroom (s) for short phases
+CALL_MARGIN = 0.10  # Headroom added to measured call counts by --update
+
+DEFAULT_SCENARIO: Dict[str, Any] = {
+    "axis_id": 0,
+    "irq_no": 7,
+    "time_scale": 20.0,
+    "initial_position": 1000.0,
+    "operating_position": 175000.0,
+    "velocity": 100000.0,
+    "acceleration": 85000.0,
+    "deceleration": 85000.0,
+    "temperature_list": [38.0, 52.0, 66.0, 72.0],
+    "stroke_positions": [170000.0],
+    "robot_move_stabilization": 0.1,
+    "robot_standby_stabilization": 1.0,
+    "mcu_command_stabilization": 0.1,
+    "button_poll_interval": 0.1,
+    "operator_reaction": 0.3,
+    "servo_brake_release": 0,
+    "left_button": 8,
+    "right_button": 9,
+    "door_sensor": 10,
+    "tower_lamp_red": 4,
+    "tower_lamp_yellow": 5,
+    "tower_lamp_green": 6,
+    "beep": 7,
+}
+
+
+@dataclass
+class PhaseResult:
+    """Measured cost of one benchmark phase"""
+
+    name: str
+    time_s: float = 0.0
+    ffi_calls: int = 0
+    driver_time_s: float = 0.0
+    calls_by_function: Dict[str, int] = field(default_factory=dict)
+
+
+class _PhaseTimer:
+    """Context manager that charges wall time and simulator calls to a phase"""
+
+    def __init__(self, simulator: Any, results: List[PhaseResult], name: str):
+        self._sim = simulator
+        self._results = results
+        self._name = name
+
+    def __enter__(self) -> None:
+        self._counts = self._sim.call_counts
+        self._driver = self._sim.driver_time
+        self._start = time.perf_counter()
+
+    def __exit__(self, *exc: Any) -> None:
+        elapsed = time.perf_counter() - self._start
+        counts = self._sim.call_counts
+        delta = {k: v - self._counts.get(k, 0) for k, v in counts.items()}
+        delta = {k: v for k, v in delta.items() if v}
+        self._results.append(
+            PhaseResult(
+                name=self._name,
+                time_s=elapsed,
+                ffi_calls=sum(delta.values()),
+                driver_time_s=self._sim.driver_time - self._driver,
+                calls_by_function=delta,
+            )
+        )
+
+
+async def _run_sequence(scenario: Dict[str, Any]) -> List[PhaseResult]:
+    # Local application imports
+    from infrastructure.implementation.hardware.digital_io.ajinextek.ajinextek_dio import (
+        AjinextekDIO,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.ajinextek_robot import (
+        AjinextekRobot,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.axl_bringup import (
+        AXLBringup,
+        default_motion_settings_file,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+
+    s = scenario
+    scale = s["time_scale"]
+    axis = s["axis_id"]
+
+    def dwell(seconds: float) -> "asyncio.Future":
+        return asyncio.sleep(seconds / scale)
+
+    sim = AXLWrapper.get_instance().dll
+    sim.time_scale = scale
+
+    # Parameter file: the deployed one when present, otherwise the simulator defaults
+    motion_file = default_motion_settings_file()
+    if not motion_file.exists():
+        motion_file = Path(tempfile.gettempdir()) / "benchmark_robot_motion_settings.mot"
+        sim.AxmMotSaveParaAll(str(motion_file).encode("utf-8"))
+
+    # Operator buttons and door sensor are B-contact: idle level is HIGH
+    for pin in (s["left_button"], s["right_button"], s["door_sensor"]):
+        sim.set_input(0, pin, True)
+
+    robot = AjinextekRobot(axis_id=axis, irq_no=s["irq_no"])
+    dio = AjinextekDIO(irq_no=s["irq_no"])
+    results: List[PhaseResult] = []
+
+    async def move(position: float) -> None:
+        await robot.move_absolute(
+            position=position,
+            axis_id=axis,
+            velocity=s["velocity"],
+            acceleration=s["acceleration"],
+            deceleration=s["deceleration"],
+        )
+        await dwell(s["robot_move_stabilization"])
+
+    with _PhaseTimer(sim, results, "connect"):
+        AXLBringup.get_instance().start(s["irq_no"], motion_file)
+        await asyncio.gather(robot.connect(), dio.connect())
+
+    with _PhaseTimer(sim, results, "button_start"):
+        await dio.write_multiple_outputs({s["tower_lamp_green"]: True, s["tower_lamp_red"]: False})
+
+        loop = asyncio.get_running_loop()
+        for pin in (s["left_button"], s["right_button"]):
+            loop.call_later(s["operator_reaction"] / scale, sim.set_input, 0, pin, False)
+
+        while True:
+            inputs = await dio.read_all_inputs()
+            if not inputs[s["left_button"]] and not inputs[s["right_button"]]:
+                break
+            await asyncio.sleep(s["button_poll_interval"] / scale)
+
+        await dio.write_multiple_outputs(
+            {s["tower_lamp_green"]: False, s["tower_lamp_yellow"]: True}
+        )
+        for pin in (s["left_button"], s["right_button"]):
+            sim.set_input(0, pin, True)
+
+    with _PhaseTimer(sim, results, "initialize"):
+        await dio.write_output(s["servo_brake_release"], True)
+        await robot.enable_servo(axis)
+        await robot.home_axis(axis)
+        await move(s["initial_position"])
+
+    with _PhaseTimer(sim, results, "standby"):
+        await move(s["operating_position"])
+        await dwell(s["robot_standby_stabilization"])
+        await move(s["initial_position"])
+
+    with _PhaseTimer(sim, results, "matrix"):
+        for _ in s["temperature_list"]:
+            await dwell(s["mcu_command_stabilization"])  # MCU temperature set
+            for position in s["stroke_positions"]:
+                await move(position)
+                await robot.get_current_position(axis)  # Force sample alignment
+            await move(s["initial_position"])
+
+    with _PhaseTimer(sim, results, "finish"):
+        await dio.write_multiple_outputs(
+            {s["tower_lamp_yellow"]: False, s["tower_lamp_green"]: True, s["beep"]: True}
+        )
+        await dwell(0.2)
+        await dio.write_output(s["beep"], False)
+        await robot.disconnect()
+        await dio.disconnect()
+
+    results.append(
+        PhaseResult(
+            name="total",
+            time_s=sum(r.time_s for r in results),
+            ffi_calls=sum(r.ffi_calls for r in results),
+            driver_time_s=sum(r.driver_time_s for r in results),
+        )
+    )
+    return results
+
+
+def run_benchmark(scenario: Dict[str, Any]) -> List[PhaseResult]:
+    """Run the force-test sequence once on a fresh simulated AXL library"""
+    # Local application imports
+    from infrastructure.implementation.hardware.robot.ajinextek.axl_bringup import AXLBringup
+    from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+
+    # The wrapper picks the simulator from the environment; restore it afterwards
+    # so later AXLWrapper instances in this process are unaffected
+    previous = os.environ.get("AXL_SIMULATOR")
+    os.environ["AXL_SIMULATOR"] = "true"
+    AXLWrapper.reset_for_testing()
+    AXLBringup.reset_for_testing()
+    try:
+        return asyncio.run(_run_sequence(scenario))
+    finally:
+        AXLWrapper.reset_for_testing()
+        AXLBringup.reset_for_testing()
+        if previous is None:
+            os.environ.pop("AXL_SIMULATOR", None)
+        else:
+            os.environ["AXL_SIMULATOR"] = previous
+
+
+def load_budgets(path: Path = BUDGET_FILE) -> Dict[str, Any]:
+    """Budget file contents ({"scenario": {...}, "budgets": {phase: {...}}})"""
+    if not path.exists():
+        return {"scenario": dict(DEFAULT_SCENARIO), "budgets": {}}
+    data = json.loads(path.read_text(encoding="utf-8"))
+    data["scenario"] = {**DEFAULT_SCENARIO, **data.get("scenario", {})}
+    return data
+
+
+def check_budgets(
+    results: List[PhaseResult],
+    budgets: Dict[str, Dict[str, float]],
+    check_time: bool = True,
+) -> List[str]:
+    """
+    Budget violations as readable messages (empty when within budget)
+
+    check_time=False checks only the AXL call budgets, which do not depend
+    on machine load.
+    """
+    violations = []
+    for result in results:
+        budget = budgets.get(result.name)
+        if budget is None:
+            continue
+        if check_time and result.time_s > budget["time_s"]:
+            violations.append(
+                f"{result.name}: {result.time_s:.3f}s exceeds budget {budget['time_s']:.3f}s"
+            )
+        if result.ffi_calls > budget["ffi_calls"]:
+            violations.append(
+                f"{result.name}: {result.ffi_calls} AXL calls exceed budget {budget['ffi_calls']}"
+            )
+    return violations
+
+
+def make_budgets(results: List[PhaseResult]) -> Dict[str, Dict[str, float]]:
+    return {
+        r.name: {
+            "time_s": round(max(r.time_s * (1 + TIME_MARGIN), r.time_s + TIME_MARGIN_MIN), 3),
+            "ffi_calls": int(math.ceil(r.ffi_calls * (1 + CALL_MARGIN))),
+        }
+        for r in results
+    }
+
+
+def print_report(results: List[PhaseResult], budgets: Dict[str, Dict[str, float]]) -> None:
+    print("=" * 78)
+    print("FORCE-TEST CYCLE BENCHMARK (simulated AXL)")
+    print("=" * 78)
+    print(
+        f"{'phase':<14}{'time [s]':>10}{'budget':>10}"
+        f"{'AXL calls':>12}{'budget':>10}{'driver [ms]':>14}"
+    )
+    for r in results:
+        b = budgets.get(r.name, {})
+        print(
+            f"{r.name:<14}{r.time_s:>10.3f}{b.get('time_s', float('nan')):>10.3f}"
+            f"{r.ffi_calls:>12}{b.get('ffi_calls', '-'):>10}{r.driver_time_s * 1000:>14.2f}"
+        )
+    print()
+    print("Top AXL calls per phase:")
+    for r in results:
+        if r.calls_by_function:
+            top = sorted(r.calls_by_function.items(), key=lambda kv: -kv[1])[:4]
+            print(f"  {r.name:<12} " + ", ".join(f"{name}={count}" for name, count in top))
+    print("=" * 78)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--update", action="store_true", help="rewrite budgets from this run")
+    parser.add_argument("--budget-file", type=Path, default=BUDGET_FILE)
+    args = parser.parse_args()
+
+    # Third-party imports
+    from loguru import logger
+
+    logger.remove()
+    logger.add(sys.stderr, level="WARNING")
+
+    data = load_budgets(args.budget_file)
+    results = run_benchmark(data["scenario"])
+
+    if args.update:
+        data["budgets"] = make_budgets(results)
+        args.budget_file.write_text(json.dumps(data, indent=2) + "\n", encoding="utf-8")
+        print_report(results, data["budgets"])
+        print(f"[UPDATED] Budgets written to {args.budget_file}")
+        return 0
+
+    print_report(results, data["budgets"])
+    violations = check_budgets(results, data["budgets"])
+    if violations:
+        print("[FAILED] Cycle-time budget exceeded:")
+        for violation in violations:
+            print(f"  - {violation}")
+        return 1
+    print("[SUCCESS] All phases within budget")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+"""
+Loopback IO Latency Benchmark
+
+Toggles an output wired back to an input and prints edge latency histograms
+for polling and interrupt timing (see io_latency_probe.py). With --simulate
+the loopback runs against the simulated AXL library with a wired delay;
+otherwise the real library and a loopback cable are used.
+
+IO points are kind:index:bit - dio:<module>:<offset> for DIO bits,
+axis:<axis>:<bit> for axis universal IO. Interrupt timing needs a DIO input.
+
+Usage:
+    python scripts/benchmark_io_latency.py --simulate
+    python scripts/benchmark_io_latency.py --output axis:0:1 --input dio:0:0 --samples 1000
+    python scripts/benchmark_io_latency.py --mode polling --poll-interval 0.0005
+"""
+
+import argparse
+import os
+import sys
+from pathlib import Path
+
+PROJECT_ROOT = Path(__file__).parent.parent
+sys.path.insert(0, str(PROJECT_ROOT / "src"))
+
+MODES = ("polling", "interrupt")
+
+
+def run_benchmark(args: argparse.Namespace) -> int:
+    # Local application imports
+    from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+    from infrastructure.implementation.hardware.robot.ajinextek.io_latency_probe import (
+        IO_DIO,
+        IOPoint,
+        LoopbackProbe,
+    )
+
+    output = IOPoint.parse(args.output)
+    input = IOPoint.parse(args.input)
+    axl = AXLWrapper.get_instance()
+    if args.simulate:
+        # Local application imports
+        from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+            SimulatedAXL,
+        )
+
+        axl.dll = SimulatedAXL()
+        axl.dll.wire_loopback(output, input, delay=args.wire_delay)
+    axl.open(7)
+
+    probe = LoopbackProbe(output, input, axl=axl, timeout=args.timeout)
+    modes = MODES if args.mode == "both" else (args.mode,)
+    if "interrupt" in modes and input.kind != IO_DIO:
+        print(f"[SKIP] interrupt timing needs a DIO input, got {input}")
+        modes = tuple(mode for mode in modes if mode != "interrupt")
+
+    print("=" * 72)
+    print(f"LOOPBACK IO LATENCY  {output} -> {input}  ({args.samples} edges per mode)")
+    print("=" * 72)
+    timeouts = 0
+    try:
+        for mode in modes:
+            if mode == "polling":
+                histogram = probe.measure_polling(args.samples, args.poll_interval)
+            else:
+                histogram = probe.measure_interrupt(args.samples)
+            print(histogram.format())
+            print(f"  suggested edge timeout: {histogram.suggested_timeout() * 1000:.3f} ms")
+            print("-" * 72)
+            timeouts += histogram.timeouts
+    finally:
+        axl.close()
+    if timeouts:
+        print("[WARN] edges timed out - check the loopback wiring")
+        return 1
+    return 0
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--simulate", action="store_true", help="use the simulated AXL library")
+    parser.add_argument("--output", default="dio:1:0", help="output bit (default dio:1:0)")
+    parser.add_argument("--input", default="dio:0:0", help="input bit (default dio:0:0)")
+    parser.add_argument("--samples", type=int, default=200, help="edges per mode")
+    parser.add_argument("--mode", choices=MODES + ("both",), default="both")
+    parser.add_argument("--poll-interval", type=float, default=0.0, help="seconds, 0 spins")
+    parser.add_argument("--timeout", type=float, default=0.1, help="edge wait limit (s)")
+    parser.add_argument(
+        "--wire-delay", type=float, default=0.5e-3, help="simulated cable delay (s)"
+    )
+    args = parser.parse_args()
+
+    if args.simulate:
+        os.environ["AXL_SIMULATOR"] = "true"
+
+    # Third-party imports
+    from loguru import logger
+
+    logger.remove()
+    logger.add(sys.stderr, level="WARNING")
+
+    return run_benchmark(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
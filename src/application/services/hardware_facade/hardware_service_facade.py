@@ -963,6 +963,9 @@ class HardwareServiceFacade:
         Uses MCU get_temperature() to read actual temperature and compares
         against expected value with configurable tolerance range.
         Includes retry logic: 10 additional attempts with 1-second delays if initial verification fails.
+        MCUs providing wait_temperature_settled() are read once first; only when
+        that reading is out of tolerance do they wait for the fitted step response
+        to settle, and one final reading decides if it does not within the budget.
 
         Args:
             expected_temp: Expected temperature value (°C)
@@ -987,6 +990,39 @@ class HardwareServiceFacade:
         max_retries = 10
         retry_delay = 1.0
 
+        # Event-driven MCUs fit the step response and report settling without fixed delays
+        wait_settled = getattr(self._mcu, "wait_temperature_settled", None)
+        if wait_settled is not None:
+            # One reading first - the fit needs several samples, too slow for a normal pass
+            try:
+                actual_temp = await self._mcu.get_temperature()
+            except Exception as e:
+                logger.debug(f"Initial MCU temperature read failed: {e}")
+            else:
+                temp_diff = abs(actual_temp - expected_temp)
+                if temp_diff <= test_config.temperature_tolerance:
+                    logger.info(
+                        f"✅ Temperature verification PASSED on first attempt - "
+                        f"Actual: {actual_temp:.1f}°C, Expected: {expected_temp:.1f}°C, "
+                        f"Diff: {temp_diff:.1f}°C (≤{test_config.temperature_tolerance:.1f}°C)"
+                    )
+                    return
+
+            estimate = await wait_settled(
+                expected_temp,
+                test_config.temperature_tolerance,
+                timeout=max_retries * retry_delay,
+            )
+            if estimate is not None and estimate.settled:
+                logger.info(
+                    f"✅ Temperature verification PASSED - settled at {expected_temp:.1f}°C "
+                    f"(predicted final {estimate.final_temperature:.2f}°C, "
+                    f"{estimate.samples} samples)"
+                )
+                return
+            if estimate is not None:
+                max_retries = 0  # Settle budget spent - one final reading decides
+
         for attempt in range(max_retries + 1):  # 0-10 (11 total attempts)
             try:
                 # Read actual temperature from MCU
@@ -128,6 +128,12 @@ class AXLConfigurationError(AXLError):
     ...
 
 
+class AXLFunctionNotAvailableError(AXLError):
+    """AXL function missing from the loaded DLL version"""
+
+    ...
+
+
 # ============================================================================
 # Future Robot Vendors (for expansion)
 # ============================================================================
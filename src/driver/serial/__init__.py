@@ -7,6 +7,7 @@ Optimized for request-response patterns like BS205 LoadCell and similar industri
 The architecture provides:
 - SerialConnection: Core async serial communication class
 - SerialManager: Factory class for creating connections
+- SerialReactor: Reactor with one deadline heap shared by all serial ports
 - Constants: Centralized configuration values
 - Exceptions: Structured error handling
 """
@@ -26,6 +27,10 @@ from driver.serial.constants import (
     MAX_COMMAND_LENGTH,
     MAX_RESPONSE_LENGTH,
     MAX_RETRY_ATTEMPTS,
+    REACTOR_COMMAND_TIMEOUT,
+    REACTOR_READ_SIZE,
+    REACTOR_READER_TIMEOUT,
+    REACTOR_REQUEST_TIMEOUT,
     READ_BUFFER_SIZE,
     RESPONSE_TERMINATOR,
     RETRY_DELAY,
@@ -40,6 +45,12 @@ from driver.serial.exceptions import (
     SerialError,
     SerialTimeoutError,
 )
+from driver.serial.reactor import (
+    ReactorFrame,
+    SerialReactor,
+    TerminatorFramer,
+    get_shared_reactor,
+)
 
 
 # Core serial communication classes (conditional import for dependencies)
@@ -57,6 +68,10 @@ __all__ = [
     # Core classes
     "SerialConnection",
     "SerialManager",
+    "SerialReactor",
+    "TerminatorFramer",
+    "ReactorFrame",
+    "get_shared_reactor",
     # Constants
     "DEFAULT_BAUDRATE",
     "DEFAULT_TIMEOUT",
@@ -70,6 +85,10 @@ __all__ = [
     "MAX_RETRY_ATTEMPTS",
     "RETRY_DELAY",
     "FLUSH_TIMEOUT",
+    "REACTOR_COMMAND_TIMEOUT",
+    "REACTOR_READ_SIZE",
+    "REACTOR_READER_TIMEOUT",
+    "REACTOR_REQUEST_TIMEOUT",
     "BS205_BAUDRATE",
     "BS205_TIMEOUT",
     "BS205_TERMINATOR",
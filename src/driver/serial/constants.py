@@ -30,3 +30,9 @@ FLUSH_TIMEOUT = 0.1  # Timeout for buffer flushing operations
 BS205_BAUDRATE = 9600  # BS205 LoadCell specific baud rate
 BS205_TIMEOUT = 1.0  # BS205 LoadCell specific timeout
 BS205_TERMINATOR = "\r"  # BS205 LoadCell specific terminator
+
+# Reactor Settings
+REACTOR_READ_SIZE = 4096  # Maximum bytes drained per readable event
+REACTOR_REQUEST_TIMEOUT = 1.0  # Default response deadline (seconds)
+REACTOR_READER_TIMEOUT = 0.05  # Blocking read timeout of per-port reader threads (seconds)
+REACTOR_COMMAND_TIMEOUT = 2.0  # Wait for a selector change on the reactor thread (seconds)
@@ -0,0 +1,580 @@
+"""
+Serial Reactor
+
+One reactor for all serial ports of the station, with two read backends:
+
+- select   ports with a selectable descriptor (pyserial on POSIX) are
+           registered with a selectors.DefaultSelector (epoll on Linux), so
+           the reactor thread sleeps in a single select() call until a port
+           has bytes or the nearest response deadline expires
+- thread   ports without one (pyserial on Windows, where select() only
+           accepts sockets) get a reader thread blocking in port.read(); it
+           feeds the same framing and dispatch path
+
+Either way the reactor thread owns the shared deadline heap, so response
+timeouts of every port are served by one timer and idle ports cost no
+polling sleeps. add_port() picks the backend (threaded=None) or takes it
+explicitly.
+
+Each port has a framing plugin (any object with feed(bytes) -> list of
+complete frames, e.g. TerminatorFramer or an instrument's frame scanner).
+Requests register a completion future with a deadline on the shared
+time.monotonic() clock before the bytes are written; each received frame
+resolves the oldest pending request of its port whose matcher accepts it
+(FIFO when no matcher is given), and listeners see every frame. Responses
+therefore complete after line time plus the reactor's wake-up, and callers
+await the future instead of sleeping.
+"""
+
+# Standard library imports
+from collections import deque
+from concurrent.futures import Future
+from dataclasses import dataclass, field
+import heapq
+import itertools
+import selectors
+import socket
+import sys
+import threading
+import time
+from typing import Any, Callable, Deque, Dict, List, NamedTuple, Optional, Protocol, Tuple
+
+# Third-party imports
+import asyncio
+from loguru import logger
+
+# Local application imports
+from driver.serial.constants import (
+    ENCODING,
+    REACTOR_COMMAND_TIMEOUT,
+    MAX_RESPONSE_LENGTH,
+    REACTOR_READ_SIZE,
+    REACTOR_READER_TIMEOUT,
+    REACTOR_REQUEST_TIMEOUT,
+    RESPONSE_TERMINATOR,
+)
+from driver.serial.exceptions import (
+    SerialCommunicationError,
+    SerialConfigurationError,
+    SerialConnectionError,
+    SerialTimeoutError,
+)
+
+
+class Framer(Protocol):
+    """Framing plugin: splits a byte stream into complete frames"""
+
+    def feed(self, data: bytes) -> List[Any]: ...
+
+
+class TerminatorFramer:
+    """Frames terminated by a byte sequence (terminator included in each frame)"""
+
+    def __init__(
+        self,
+        terminator: bytes = RESPONSE_TERMINATOR.encode(ENCODING),
+        max_size: int = MAX_RESPONSE_LENGTH,
+    ):
+        """
+        Initialize terminator framer
+
+        Args:
+            terminator: Byte sequence ending each frame
+            max_size: Bytes without a terminator discarded as noise beyond this
+        """
+        self._terminator = terminator
+        self._max_size = max_size
+        self._buffer = bytearray()
+        self.errors = 0
+
+    def feed(self, data: bytes) -> List[bytes]:
+        buffer = self._buffer
+        buffer += data
+        frames: List[bytes] = []
+        start = 0
+        while True:
+            end = buffer.find(self._terminator, start)
+            if end < 0:
+                break
+            end += len(self._terminator)
+            frames.append(bytes(buffer[start:end]))
+            start = end
+        del buffer[:start]
+        if len(buffer) > self._max_size:
+            self.errors += 1
+            buffer.clear()
+        return frames
+
+
+class ReactorFrame(NamedTuple):
+    """One received frame"""
+
+    port: str  # Registered port name
+    data: Any  # Frame as returned by the framer (bytes for TerminatorFramer)
+    timestamp: float  # time.monotonic() of the read that completed it
+
+
+@dataclass(eq=False)
+class _Pending:
+    future: Future
+    match: Optional[Callable[[bytes], bool]]
+    deadline: float
+    sent: float = 0.0
+
+
+@dataclass(eq=False)
+class _Port:
+    name: str
+    serial: Any
+    framer: Framer
+    write_lock: threading.Lock = field(default_factory=threading.Lock)
+    pending: Deque[_Pending] = field(default_factory=deque)
+    listeners: List[Callable[[ReactorFrame], None]] = field(default_factory=list)
+    reader: Optional[threading.Thread] = None  # Thread backend only
+    fd: Optional[int] = None  # Select backend only (captured while the port is open)
+    closed: threading.Event = field(default_factory=threading.Event)
+    frames: int = 0
+    unmatched: int = 0
+    timeouts: int = 0
+    read_errors: int = 0
+    last_round_trip: Optional[float] = None
+
+
+class SerialReactor:
+    """Serial reactor: one deadline heap, selector or per-port reader threads"""
+
+    def __init__(self, clock: Callable[[], float] = time.monotonic):
+        """
+        Initialize serial reactor
+
+        Args:
+            clock: Shared timestamp clock for frames and deadlines
+        """
+        self._clock = clock
+        self._selector = selectors.DefaultSelector()
+        self._wake_recv, self._wake_send = socket.socketpair()
+        self._wake_recv.setblocking(False)
+        self._wake_send.setblocking(False)
+        self._selector.register(self._wake_recv, selectors.EVENT_READ, None)
+
+        self._lock = threading.Lock()
+        self._ports: Dict[str, _Port] = {}
+        self._deadlines: List[Tuple[float, int, _Pending, _Port]] = []
+        self._sequence = itertools.count()
+        self._commands: Deque[Callable[[], None]] = deque()
+
+        self._stop_event = threading.Event()
+        self._thread: Optional[threading.Thread] = None
+
+    # ========================================================================
+    # Ports
+    # ========================================================================
+
+    def add_port(
+        self,
+        name: str,
+        port: Any,
+        framer: Framer,
+        listener: Optional[Callable[[ReactorFrame], None]] = None,
+        threaded: Optional[bool] = None,
+    ) -> None:
+        """
+        Register an open pyserial-like port
+
+        The port belongs to the reactor until remove_port(). Selected ports are
+        switched to non-blocking reads (timeout 0), threaded ports to blocking
+        reads of REACTOR_READER_TIMEOUT.
+
+        Args:
+            name: Port name used by requests and listeners
+            port: Open port (read, write, in_waiting, timeout)
+            framer: Framing plugin of the port's protocol
+            listener: First listener, registered before any byte is read
+            threaded: Reader thread backend (None = on Windows or without fileno())
+
+        Raises:
+            SerialConfigurationError: Duplicate name, or no selectable
+                descriptor when threaded=False
+        """
+        unselectable = _unselectable_reason(port)
+        if threaded is None:
+            threaded = sys.platform == "win32" or unselectable is not None
+        elif not threaded and unselectable is not None:
+            raise SerialConfigurationError(
+                "Port has no selectable file descriptor", port=name, details=unselectable
+            )
+
+        entry = _Port(name, port, framer)
+        if listener is not None:
+            entry.listeners.append(listener)
+        with self._lock:
+            if name in self._ports:
+                raise SerialConfigurationError("Port already registered", port=name)
+            self._ports[name] = entry
+
+        if threaded:
+            port.timeout = REACTOR_READER_TIMEOUT
+            entry.reader = threading.Thread(
+                target=self._read_port, args=(entry,), name=f"Serial-Reactor-{name}", daemon=True
+            )
+            entry.reader.start()
+        else:
+            port.timeout = 0
+            entry.fd = port.fileno()
+            try:
+                self._call(lambda: self._selector.register(entry.fd, selectors.EVENT_READ, entry))
+            except Exception:
+                with self._lock:
+                    self._ports.pop(name, None)
+                raise
+        backend = "thread" if threaded else "select"
+        logger.info(f"Serial reactor: port {name} registered ({backend})")
+
+    def remove_port(self, name: str) -> None:
+        """
+        Unregister a port and fail its pending requests (the port is not closed)
+
+        Returns once the reactor no longer reads the port, so the caller may
+        close it right away.
+        """
+        with self._lock:
+            entry = self._ports.pop(name, None)
+        if entry is None:
+            return
+        entry.closed.set()
+        if entry.reader is None:
+            self._call(lambda: self._unregister(entry))
+        elif entry.reader is not threading.current_thread():
+            entry.reader.join(timeout=2.0)
+        self._fail_pending(entry, SerialConnectionError("Port removed from reactor", port=name))
+        logger.info(f"Serial reactor: port {name} removed")
+
+    def _unregister(self, entry: _Port) -> None:
+        # By the descriptor captured in add_port(): a closed port has no fileno()
+        try:
+            self._selector.unregister(entry.fd)
+        except (KeyError, ValueError):
+            pass
+
+    def _fail_pending(self, entry: _Port, error: Exception) -> None:
+        with self._lock:
+            pending = list(entry.pending)
+            entry.pending.clear()
+        for item in pending:
+            if item.future.set_running_or_notify_cancel():
+                item.future.set_exception(error)
+
+    def _port(self, name: str) -> _Port:
+        entry = self._ports.get(name)
+        if entry is None:
+            raise SerialConnectionError("Port not registered with reactor", port=name)
+        return entry
+
+    # ========================================================================
+    # Reactor Thread
+    # ========================================================================
+
+    def start(self) -> None:
+        """Start the reactor thread"""
+        if self._thread is not None and self._thread.is_alive():
+            return
+        self._stop_event.clear()
+        self._thread = threading.Thread(target=self._run, name="Serial-Reactor", daemon=True)
+        self._thread.start()
+        logger.info("Serial reactor started")
+
+    def stop(self) -> None:
+        """Stop the reactor thread and fail all pending requests"""
+        self._stop_event.set()
+        self._wake()
+        if self._thread is not None:
+            self._thread.join(timeout=2.0)
+            self._thread = None
+        for entry in list(self._ports.values()):
+            self._fail_pending(entry, SerialConnectionError("Serial reactor stopped"))
+        with self._lock:
+            self._deadlines.clear()
+        logger.info("Serial reactor stopped")
+
+    def close(self) -> None:
+        """Stop the reactor, remove all ports and release the selector (ports are not closed)"""
+        self.stop()
+        for name in list(self._ports):
+            self.remove_port(name)
+        self._selector.close()
+        self._wake_recv.close()
+        self._wake_send.close()
+
+    @property
+    def is_running(self) -> bool:
+        return self._thread is not None and self._thread.is_alive()
+
+    def _call(self, command: Callable[[], Any]) -> Any:
+        """Run a selector change on the reactor thread and wait for it (directly while stopped)"""
+        if not self.is_running or threading.current_thread() is self._thread:
+            return command()
+        done = threading.Event()
+        outcome: List[Any] = [None, None]  # Result, exception
+
+        def run() -> None:
+            try:
+                outcome[0] = command()
+            except Exception as e:
+                outcome[1] = e
+            finally:
+                done.set()
+
+        self._commands.append(run)
+        self._wake()
+        if not done.wait(REACTOR_COMMAND_TIMEOUT):
+            if self.is_running:
+                raise SerialCommunicationError("Serial reactor did not run the command in time")
+            if not done.is_set():
+                run()  # The thread exited before reaching it
+        if outcome[1] is not None:
+            raise outcome[1]
+        return outcome[0]
+
+    def _wake(self) -> None:
+        try:
+            self._wake_send.send(b"\x00")
+        except (BlockingIOError, OSError):
+            pass  # Wake-up already pending
+
+    def _run(self) -> None:
+        # Every step is guarded: one bad port must not stop the other instruments
+        while not self._stop_event.is_set():
+            with self._lock:
+                deadline = self._deadlines[0][0] if self._deadlines else None
+            # Blocks without a timeout while nothing is pending
+            timeout = None if deadline is None else max(deadline - self._clock(), 0.0)
+            try:
+                events = self._selector.select(timeout)
+            except Exception as e:
+                logger.error(f"Serial reactor: select failed: {e}")
+                self._stop_event.wait(REACTOR_READER_TIMEOUT)  # No busy loop on a lasting error
+                events = []
+            now = self._clock()
+
+            for key, _ in events:
+                if key.data is None:
+                    try:
+                        self._wake_recv.recv(4096)
+                    except BlockingIOError:
+                        pass
+                    continue
+                try:
+                    self._on_readable(key.data, now)
+                except Exception as e:
+                    logger.error(f"Serial reactor: handling {key.data.name} failed: {e}")
+
+            while self._commands:
+                command = self._commands.popleft()
+                try:
+                    command()
+                except Exception as e:
+                    logger.error(f"Serial reactor: command failed: {e}")
+            try:
+                self._expire(self._clock())
+            except Exception as e:
+                logger.error(f"Serial reactor: deadline expiry failed: {e}")
+        # Commands queued while stopping still complete (their callers wait)
+        while self._commands:
+            self._commands.popleft()()
+
+    def _on_readable(self, entry: _Port, now: float) -> None:
+        try:
+            data = entry.serial.read(REACTOR_READ_SIZE)
+        except Exception as e:
+            # A failing descriptor stays readable - drop it instead of spinning
+            self._drop(entry, e)
+            return
+        if data:
+            self._feed(entry, data, now)
+
+    def _read_port(self, entry: _Port) -> None:
+        """Reader thread of a threaded port"""
+        port = entry.serial
+        while not entry.closed.is_set():
+            try:
+                # Blocks until at least one byte arrives (or the read timeout)
+                data = port.read(max(1, min(port.in_waiting, REACTOR_READ_SIZE)))
+            except Exception as e:
+                if not entry.closed.is_set():
+                    self._drop(entry, e)
+                return
+            if data:
+                self._feed(entry, data, self._clock())
+
+    def _drop(self, entry: _Port, error: Exception) -> None:
+        entry.read_errors += 1
+        logger.warning(f"Serial reactor: read on {entry.name} failed, removing port: {error}")
+        entry.closed.set()
+        with self._lock:
+            self._ports.pop(entry.name, None)
+        if entry.reader is None:
+            self._unregister(entry)
+        self._fail_pending(
+            entry, SerialCommunicationError("Read failed", port=entry.name, details=str(error))
+        )
+
+    def _feed(self, entry: _Port, data: bytes, now: float) -> None:
+        for raw in entry.framer.feed(data):
+            self._dispatch(entry, ReactorFrame(entry.name, raw, now))
+
+    def _dispatch(self, entry: _Port, frame: ReactorFrame) -> None:
+        entry.frames += 1
+        matched: Optional[_Pending] = None
+        with self._lock:
+            for item in entry.pending:
+                if item.future.cancelled():
+                    continue  # Caller gave up; removed at its deadline
+                if item.match is None or item.match(frame.data):
+                    matched = item
+                    break
+            if matched is not None:
+                entry.pending.remove(matched)
+
+        if matched is None:
+            entry.unmatched += 1
+        elif matched.future.set_running_or_notify_cancel():
+            entry.last_round_trip = frame.timestamp - matched.sent
+            matched.future.set_result(frame)
+
+        for listener in entry.listeners:
+            try:
+                listener(frame)
+            except Exception as e:
+                logger.warning(f"Serial reactor: listener on {entry.name} failed: {e}")
+
+    def _expire(self, now: float) -> None:
+        expired: List[Tuple[_Pending, _Port]] = []
+        with self._lock:
+            while self._deadlines and self._deadlines[0][0] <= now:
+                _, _, item, entry = heapq.heappop(self._deadlines)
+                if item.future.done() or item not in entry.pending:
+                    continue  # Already answered
+                entry.pending.remove(item)
+                entry.timeouts += 1
+                expired.append((item, entry))
+        for item, entry in expired:
+            if item.future.set_running_or_notify_cancel():
+                item.future.set_exception(
+                    SerialTimeoutError("No response before deadline", port=entry.name)
+                )
+
+    # ========================================================================
+    # Requests
+    # ========================================================================
+
+    def send(self, name: str, data: bytes) -> None:
+        """Write bytes without expecting a response"""
+        entry = self._port(name)
+        with entry.write_lock:
+            entry.serial.write(data)
+
+    def request(
+        self,
+        name: str,
+        data: bytes,
+        timeout: float = REACTOR_REQUEST_TIMEOUT,
+        match: Optional[Callable[[bytes], bool]] = None,
+    ) -> Future:
+        """
+        Write a request and return a future for its response
+
+        Args:
+            name: Registered port name
+            data: Request bytes
+            timeout: Response deadline in seconds from now
+            match: Predicate selecting the response frame (None = next frame)
+
+        Returns:
+            Future resolved with the ReactorFrame, or failed with
+            SerialTimeoutError once the deadline passes
+        """
+        entry = self._port(name)
+        now = self._clock()
+        item = _Pending(Future(), match, now + timeout, now)
+        with self._lock:
+            earliest = self._deadlines[0][0] if self._deadlines else None
+            entry.pending.append(item)
+            heapq.heappush(self._deadlines, (item.deadline, next(self._sequence), item, entry))
+        if earliest is None or item.deadline < earliest:
+            self._wake()  # Shorten the select() timeout
+
+        try:
+            with entry.write_lock:
+                item.sent = self._clock()
+                entry.serial.write(data)
+        except Exception as e:
+            with self._lock:
+                if item in entry.pending:
+                    entry.pending.remove(item)
+            if item.future.set_running_or_notify_cancel():
+                item.future.set_exception(
+                    SerialCommunicationError("Write failed", port=name, details=str(e))
+                )
+        return item.future
+
+    async def request_async(
+        self,
+        name: str,
+        data: bytes,
+        timeout: float = REACTOR_REQUEST_TIMEOUT,
+        match: Optional[Callable[[bytes], bool]] = None,
+    ) -> ReactorFrame:
+        """request() for coroutines (raises SerialTimeoutError past the deadline)"""
+        return await asyncio.wrap_future(self.request(name, data, timeout, match))
+
+    # ========================================================================
+    # Listeners and Status
+    # ========================================================================
+
+    def add_listener(self, name: str, listener: Callable[[ReactorFrame], None]) -> None:
+        """Call listener(frame) from the reactor thread for every frame of a port"""
+        entry = self._port(name)
+        entry.listeners = entry.listeners + [listener]
+
+    def remove_listener(self, name: str, listener: Callable[[ReactorFrame], None]) -> None:
+        entry = self._port(name)
+        entry.listeners = [item for item in entry.listeners if item != listener]
+
+    def get_statistics(self) -> Dict[str, Dict[str, Any]]:
+        """Frame, matching and error counters per port"""
+        with self._lock:
+            return {
+                name: {
+                    "frames": entry.frames,
+                    "unmatched": entry.unmatched,
+                    "pending": len(entry.pending),
+                    "timeouts": entry.timeouts,
+                    "read_errors": entry.read_errors,
+                    "last_round_trip": entry.last_round_trip,
+                    "backend": "select" if entry.reader is None else "thread",
+                }
+                for name, entry in self._ports.items()
+            }
+
+
+def _unselectable_reason(port: Any) -> Optional[str]:
+    """None if the port has a selectable descriptor, else the reason it has none"""
+    try:
+        port.fileno()
+    except Exception as e:
+        return str(e) or type(e).__name__
+    return None
+
+
+_shared_reactor: Optional[SerialReactor] = None
+_shared_lock = threading.Lock()
+
+
+def get_shared_reactor() -> SerialReactor:
+    """Process-wide reactor shared by all serial instruments (started on first use)"""
+    global _shared_reactor
+    with _shared_lock:
+        if _shared_reactor is None:
+            _shared_reactor = SerialReactor()
+        _shared_reactor.start()
+        return _shared_reactor
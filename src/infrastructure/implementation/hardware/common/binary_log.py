@@ -0,0 +1,404 @@
+"""
+Binary Hot-Path Log
+
+Logging for sampler and timer threads that must not stall on string
+formatting or file I/O. Format strings are registered once with define();
+a log call only appends (format id, monotonic ns, raw arguments) to a
+per-thread buffer - no formatting, no locks, no I/O. A background writer
+drains the buffers into a compact binary file with size-based rotation, and
+decode_log() renders the text offline:
+
+    python -m infrastructure.implementation.hardware.common.binary_log trace.blog
+
+Every file starts with a header and repeats the format and thread tables, so
+rotated files decode on their own. A restarted writer appends to an existing
+file behind a new header (the decoder restarts its tables there) instead of
+truncating it.
+
+File layout (little-endian):
+    header   "<4sHdq"   magic, version, wall-clock time, monotonic ns at that time
+    format   "<BHH"     kind 0, format id, byte length + UTF-8 format string
+    thread   "<BHH"     kind 1, thread index, byte length + UTF-8 thread name
+    record   "<BHHqB"   kind 2, format id, thread index, monotonic ns, argument count
+             then per argument a type byte: q int64, d float64, ? bool, s "<H" + UTF-8
+"""
+
+# Standard library imports
+from datetime import datetime
+import io
+import os
+from pathlib import Path
+import struct
+import sys
+import threading
+import time
+from typing import Any, Dict, Iterator, List, Optional, Tuple, Union
+
+BLOG_MAGIC = b"BLOG"
+BLOG_VERSION = 1
+BLOG_DEFAULT_MAX_BYTES = 16 * 1024 * 1024  # Rotate after (bytes)
+BLOG_DEFAULT_BACKUP_COUNT = 4  # Rotated files kept (trace.blog.1 ... .N)
+BLOG_DEFAULT_FLUSH_PERIOD = 0.2  # Writer drain period (s)
+BLOG_DEFAULT_THREAD_CAPACITY = 65536  # Records buffered per thread before dropping
+
+_HEADER = struct.Struct("<4sHdq")
+_DEFINE = struct.Struct("<BHH")
+_RECORD = struct.Struct("<BHHqB")
+_STR_LEN = struct.Struct("<H")
+_INT = struct.Struct("<q")
+_FLOAT = struct.Struct("<d")
+
+_KIND_FORMAT = 0
+_KIND_THREAD = 1
+_KIND_RECORD = 2
+
+_Record = Tuple[int, int, Tuple[Any, ...]]
+
+
+class _ThreadBuffer:
+    """Records of one producer thread (appended by it, drained by the writer)"""
+
+    __slots__ = ("index", "name", "thread", "records")
+
+    def __init__(self, index: int, thread: threading.Thread):
+        self.index = index
+        self.name = thread.name
+        self.thread = thread  # Buffer is dropped once this thread has exited and been drained
+        self.records: List[_Record] = []
+
+
+class BinaryLog:
+    """핫패스용 바이너리 로거 (스레드별 버퍼 + 백그라운드 기록)"""
+
+    def __init__(
+        self,
+        path: Union[str, Path],
+        max_bytes: int = BLOG_DEFAULT_MAX_BYTES,
+        backup_count: int = BLOG_DEFAULT_BACKUP_COUNT,
+        flush_period: float = BLOG_DEFAULT_FLUSH_PERIOD,
+        thread_capacity: int = BLOG_DEFAULT_THREAD_CAPACITY,
+    ):
+        """
+        초기화
+
+        Args:
+            path: Log file path
+            max_bytes: Rotate when the file grows beyond this size
+            backup_count: Number of rotated files kept
+            flush_period: Writer drain period in seconds
+            thread_capacity: Records buffered per thread; further records are dropped
+        """
+        self._path = Path(path)
+        self._max_bytes = max_bytes
+        self._backup_count = backup_count
+        self._flush_period = flush_period
+        self._thread_capacity = thread_capacity
+
+        self._formats: List[str] = []
+        self._format_ids: Dict[str, int] = {}
+        self._buffers: List[_ThreadBuffer] = []
+        self._thread_count = 0  # Thread indices are never reused, even after a buffer is dropped
+        self._local = threading.local()
+        self._register_lock = threading.Lock()  # Cold path only (define, first log per thread)
+        self._write_lock = threading.Lock()
+
+        self._file: Optional[io.BufferedWriter] = None
+        self._file_size = 0
+        self._written_tables = (0, 0)  # Format ids / thread indices already in the current file
+        self._records = 0
+        self._dropped = 0
+        self._rotations = 0
+
+        self._stop_event = threading.Event()
+        self._thread: Optional[threading.Thread] = None
+
+    # ========================================================================
+    # Producer API
+    # ========================================================================
+
+    def define(self, fmt: str) -> int:
+        """
+        Register a str.format() template and return its id for log()
+
+        Registering the same template again returns the existing id.
+        """
+        with self._register_lock:
+            fmt_id = self._format_ids.get(fmt)
+            if fmt_id is None:
+                fmt_id = len(self._formats)
+                self._formats.append(fmt)
+                self._format_ids[fmt] = fmt_id
+            return fmt_id
+
+    def log(self, fmt_id: int, *args: Any) -> None:
+        """
+        Record a log entry (hot path)
+
+        Arguments are stored as-is and rendered by the writer; int, float,
+        bool and str are kept exactly, anything else is written as repr().
+        """
+        try:
+            buffer = self._local.buffer
+        except AttributeError:
+            buffer = self._register_thread()
+        records = buffer.records
+        if len(records) < self._thread_capacity:
+            records.append((fmt_id, time.monotonic_ns(), args))
+        else:
+            self._dropped += 1  # Approximate under contention; only a diagnostic
+
+    def _register_thread(self) -> _ThreadBuffer:
+        with self._register_lock:
+            buffer = _ThreadBuffer(self._thread_count, threading.current_thread())
+            self._thread_count += 1
+            self._buffers.append(buffer)
+        self._local.buffer = buffer
+        return buffer
+
+    # ========================================================================
+    # Writer
+    # ========================================================================
+
+    def start(self) -> None:
+        """Start the background writer (the file is opened on the first flush)"""
+        if self._thread is not None and self._thread.is_alive():
+            return
+        self._stop_event.clear()
+        self._thread = threading.Thread(target=self._run, name="BinaryLogWriter", daemon=True)
+        self._thread.start()
+
+    def stop(self) -> None:
+        """Write everything buffered so far, stop the writer and close the file"""
+        self._stop_event.set()
+        if self._thread is not None:
+            self._thread.join(timeout=5.0)
+            self._thread = None
+        self.flush()
+        with self._write_lock:
+            if self._file is not None:
+                self._file.close()
+                self._file = None
+
+    @property
+    def is_running(self) -> bool:
+        return self._thread is not None and self._thread.is_alive()
+
+    def _run(self) -> None:
+        while not self._stop_event.wait(self._flush_period):
+            self.flush()
+
+    def flush(self) -> int:
+        """
+        Drain all thread buffers to the file
+
+        Returns:
+            Number of records written
+        """
+        with self._register_lock:
+            buffers = list(self._buffers)
+        # Checked before draining: an exited thread cannot append after its last drain
+        finished = [buffer for buffer in buffers if not buffer.thread.is_alive()]
+
+        with self._write_lock:
+            if self._file is None:
+                self._open()
+            written = 0
+            out = bytearray()
+            for buffer in buffers:
+                records = buffer.records
+                count = len(records)
+                if count == 0:
+                    continue
+                batch = records[:count]
+                del records[:count]  # Single bytecode op: producers' appends are not lost
+                for fmt_id, t_ns, args in batch:
+                    self._pack_record(out, fmt_id, buffer.index, t_ns, args)
+                written += count
+
+            # Snapshot the tables after draining so every drained id is defined
+            with self._register_lock:
+                buffers = list(self._buffers)
+                formats = list(self._formats)
+                thread_count = self._thread_count
+
+            if out:
+                self._write(out, buffers, formats, thread_count)
+            self._records += written
+
+        if finished:
+            with self._register_lock:
+                self._buffers = [b for b in self._buffers if b not in finished or b.records]
+        return written
+
+    def _pack_record(
+        self, out: bytearray, fmt_id: int, thread_index: int, t_ns: int, args: Tuple[Any, ...]
+    ) -> None:
+        out += _RECORD.pack(_KIND_RECORD, fmt_id, thread_index, t_ns, len(args))
+        for arg in args:
+            if isinstance(arg, bool):
+                out += b"?" + (b"\x01" if arg else b"\x00")
+            elif isinstance(arg, int) and -(2**63) <= arg < 2**63:
+                out += b"q" + _INT.pack(arg)
+            elif isinstance(arg, float):
+                out += b"d" + _FLOAT.pack(arg)
+            else:
+                text = (arg if isinstance(arg, str) else repr(arg)).encode("utf-8")[:0xFFFF]
+                out += b"s" + _STR_LEN.pack(len(text)) + text
+
+    def _write(
+        self, out: bytearray, buffers: List[_ThreadBuffer], formats: List[str], thread_count: int
+    ) -> None:
+        assert self._file is not None
+        if self._file_size + len(out) > self._max_bytes and self._file_size > _HEADER.size:
+            self._rotate()
+        # Tables are rewritten after every open, so new ids are always defined before use
+        tables = self._tables(buffers, formats, thread_count)
+        self._file.write(tables)
+        self._file.write(out)
+        self._file.flush()
+        self._file_size += len(tables) + len(out)
+
+    def _tables(
+        self, buffers: List[_ThreadBuffer], formats: List[str], thread_count: int
+    ) -> bytes:
+        known_formats, known_threads = self._written_tables
+        out = bytearray()
+        for fmt_id in range(known_formats, len(formats)):
+            text = formats[fmt_id].encode("utf-8")
+            out += _DEFINE.pack(_KIND_FORMAT, fmt_id, len(text)) + text
+        for buffer in buffers:
+            if buffer.index >= known_threads:
+                text = buffer.name.encode("utf-8")
+                out += _DEFINE.pack(_KIND_THREAD, buffer.index, len(text)) + text
+        self._written_tables = (len(formats), thread_count)
+        return bytes(out)
+
+    def _open(self, truncate: bool = False) -> None:
+        """Open the log behind a new header; appends to an existing file unless truncate"""
+        self._path.parent.mkdir(parents=True, exist_ok=True)
+        self._file = open(self._path, "wb" if truncate else "ab")
+        self._file.write(_HEADER.pack(BLOG_MAGIC, BLOG_VERSION, time.time(), time.monotonic_ns()))
+        self._file_size = self._file.tell()
+        self._written_tables = (0, 0)
+
+    def _rotate(self) -> None:
+        assert self._file is not None
+        self._file.close()
+        for i in range(self._backup_count - 1, 0, -1):
+            source = self._path.with_name(f"{self._path.name}.{i}")
+            if source.exists():
+                os.replace(source, self._path.with_name(f"{self._path.name}.{i + 1}"))
+        if self._backup_count > 0:
+            os.replace(self._path, self._path.with_name(f"{self._path.name}.1"))
+        self._rotations += 1
+        self._open(truncate=True)  # Already renamed away, or discarded with backup_count 0
+
+    def get_stats(self) -> Dict[str, int]:
+        """Record, drop and rotation counters"""
+        with self._register_lock:
+            pending = sum(len(b.records) for b in self._buffers)
+            threads = len(self._buffers)
+        return {
+            "records": self._records,
+            "pending": pending,
+            "dropped": self._dropped,
+            "threads": threads,
+            "rotations": self._rotations,
+        }
+
+
+# ============================================================================
+# Offline Decoder
+# ============================================================================
+
+
+def _read_str(data: bytes, pos: int, length: int) -> Tuple[str, int]:
+    return data[pos : pos + length].decode("utf-8", errors="replace"), pos + length
+
+
+def decode_records(path: Union[str, Path]) -> Iterator[Tuple[float, str, str]]:
+    """
+    Decode a binary log file
+
+    Yields:
+        (wall-clock timestamp, thread name, rendered message)
+
+    Raises:
+        ValueError: If the file is not a binary log
+    """
+    data = Path(path).read_bytes()
+    if not data.startswith(BLOG_MAGIC):
+        raise ValueError(f"{path}: not a binary log (magic {data[:4]!r})")
+
+    formats: Dict[int, str] = {}
+    threads: Dict[int, str] = {}
+    wall, mono_ns = 0.0, 0
+    pos = 0
+    while pos < len(data):
+        if data.startswith(BLOG_MAGIC, pos):  # Header of each writer session appended to the file
+            if len(data) - pos < _HEADER.size:
+                raise ValueError(f"{path}: truncated header at offset {pos}")
+            _, version, wall, mono_ns = _HEADER.unpack_from(data, pos)
+            if version != BLOG_VERSION:
+                raise ValueError(f"{path}: unsupported binary log version {version}")
+            formats, threads = {}, {}
+            pos += _HEADER.size
+            continue
+        kind = data[pos]
+        if kind in (_KIND_FORMAT, _KIND_THREAD):
+            _, key, length = _DEFINE.unpack_from(data, pos)
+            text, pos = _read_str(data, pos + _DEFINE.size, length)
+            (formats if kind == _KIND_FORMAT else threads)[key] = text
+            continue
+        if kind != _KIND_RECORD:
+            raise ValueError(f"{path}: corrupt record at offset {pos}")
+
+        _, fmt_id, thread_index, t_ns, count = _RECORD.unpack_from(data, pos)
+        pos += _RECORD.size
+        args: List[Any] = []
+        for _ in range(count):
+            tag = data[pos : pos + 1]
+            pos += 1
+            if tag == b"q":
+                args.append(_INT.unpack_from(data, pos)[0])
+                pos += _INT.size
+            elif tag == b"d":
+                args.append(_FLOAT.unpack_from(data, pos)[0])
+                pos += _FLOAT.size
+            elif tag == b"?":
+                args.append(data[pos] != 0)
+                pos += 1
+            else:
+                (length,) = _STR_LEN.unpack_from(data, pos)
+                text, pos = _read_str(data, pos + _STR_LEN.size, length)
+                args.append(text)
+
+        fmt = formats.get(fmt_id, f"<format {fmt_id}>" + " {}" * count)
+        try:
+            message = fmt.format(*args)
+        except (IndexError, KeyError, ValueError):
+            message = f"{fmt} {args}"
+        yield wall + (t_ns - mono_ns) / 1e9, threads.get(thread_index, f"#{thread_index}"), message
+
+
+def decode_log(path: Union[str, Path]) -> Iterator[str]:
+    """Render a binary log file as text lines"""
+    for timestamp, thread, message in decode_records(path):
+        stamp = datetime.fromtimestamp(timestamp).strftime("%Y-%m-%d %H:%M:%S.%f")
+        yield f"{stamp} [{thread}] {message}"
+
+
+def main(argv: Optional[List[str]] = None) -> int:
+    """Print decoded log files (oldest rotated file first when given in that order)"""
+    paths = argv if argv is not None else sys.argv[1:]
+    if not paths:
+        print("Usage: python -m infrastructure.implementation.hardware.common.binary_log FILE...")
+        return 2
+    for path in paths:
+        for line in decode_log(path):
+            print(line)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
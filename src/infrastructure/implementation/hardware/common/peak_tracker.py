@@ -0,0 +1,163 @@
+"""
+Streaming Peak Tracker
+
+Tracks the peak (largest magnitude), maximum and minimum of a sample stream
+within an armed measurement window. It is updated per sample by the stream
+that produces the values (e.g. BS205StreamReader.add_listener), so a peak
+between two polls is never missed and disarming returns immediately instead
+of after a fixed sampling loop.
+
+Each extremum keeps the timestamp of its sample. With a PositionSampler the
+peak time is mapped to the axis position at that moment by interpolating the
+sampler ring, which shares the time.monotonic() clock.
+"""
+
+# Standard library imports
+from dataclasses import dataclass, replace
+import math
+import threading
+import time
+from typing import Any, Callable, Optional, Tuple
+
+# Third-party imports
+import numpy as np
+
+
+@dataclass(frozen=True)
+class PeakResult:
+    """Extrema of one measurement window"""
+
+    peak: float  # Sample with the largest magnitude (sign kept)
+    peak_time: float
+    maximum: float
+    maximum_time: float
+    minimum: float
+    minimum_time: float
+    count: int
+    start: float  # Arm time
+    end: Optional[float]  # Disarm time (None while armed)
+    cmd_position: Optional[float] = None  # Axis positions at peak_time
+    act_position: Optional[float] = None
+
+    @property
+    def valid(self) -> bool:
+        return self.count > 0
+
+
+class PeakTracker:
+    """스트림 샘플 피크/극값 추적기 (측정 구간 단위 arm/disarm)"""
+
+    def __init__(self, position_sampler: Optional[Any] = None, axis: Optional[int] = None):
+        """
+        초기화
+
+        Args:
+            position_sampler: PositionSampler whose ring maps peak time to position
+            axis: Axis captured by position_sampler (required with it)
+        """
+        if position_sampler is not None and axis is None:
+            raise ValueError("axis is required with a position sampler")
+
+        self._position_sampler = position_sampler
+        self._axis = axis
+        self._lock = threading.Lock()
+        self._armed = False
+        self._start = 0.0
+        self._end: Optional[float] = None
+        self._clear()
+
+    def _clear(self) -> None:
+        self._count = 0
+        self._peak = self._max = self._min = math.nan
+        self._peak_time = self._max_time = self._min_time = math.nan
+
+    # ========================================================================
+    # Stream Attachment
+    # ========================================================================
+
+    def attach(self, stream: Any) -> Callable[[float, float], None]:
+        """
+        Register update() as a listener of a sample stream
+
+        Returns:
+            The registered listener (for stream.remove_listener)
+        """
+        stream.add_listener(self.update)
+        return self.update
+
+    def update(self, timestamp: float, value: float) -> None:
+        """Feed one sample (ignored while disarmed)"""
+        with self._lock:
+            if not self._armed:
+                return
+            if self._count == 0:
+                self._peak = self._max = self._min = value
+                self._peak_time = self._max_time = self._min_time = timestamp
+            else:
+                if value > self._max:
+                    self._max, self._max_time = value, timestamp
+                if value < self._min:
+                    self._min, self._min_time = value, timestamp
+                if abs(value) > abs(self._peak):
+                    self._peak, self._peak_time = value, timestamp
+            self._count += 1
+
+    # ========================================================================
+    # Measurement Window
+    # ========================================================================
+
+    def arm(self) -> None:
+        """Start a new measurement window (previous extrema are discarded)"""
+        with self._lock:
+            self._clear()
+            self._start = time.monotonic()
+            self._end = None
+            self._armed = True
+
+    def disarm(self) -> PeakResult:
+        """Close the measurement window and return its extrema"""
+        with self._lock:
+            if self._armed:
+                self._armed = False
+                self._end = time.monotonic()
+        return self.result()
+
+    def reset(self) -> None:
+        """Discard the extrema collected so far (the armed state is kept)"""
+        with self._lock:
+            self._clear()
+            self._start = time.monotonic()
+
+    @property
+    def is_armed(self) -> bool:
+        return self._armed
+
+    def result(self) -> PeakResult:
+        """Extrema so far (valid is False before the first sample)"""
+        with self._lock:
+            result = PeakResult(
+                peak=self._peak,
+                peak_time=self._peak_time,
+                maximum=self._max,
+                maximum_time=self._max_time,
+                minimum=self._min,
+                minimum_time=self._min_time,
+                count=self._count,
+                start=self._start,
+                end=self._end,
+            )
+        if result.count == 0 or self._position_sampler is None:
+            return result
+        cmd, act = self._positions_at(result.peak_time)
+        return replace(result, cmd_position=cmd, act_position=act)
+
+    def _positions_at(self, timestamp: float) -> Tuple[Optional[float], Optional[float]]:
+        # Sampler ring columns: cmd, act
+        times, values = self._position_sampler.get_ring(self._axis).snapshot()
+        if len(times) == 0:
+            return None, None
+        # Clamps to the first/last sample outside the captured range
+        return (
+            float(np.interp(timestamp, times, values[:, 0])),
+            float(np.interp(timestamp, times, values[:, 1])),
+        )
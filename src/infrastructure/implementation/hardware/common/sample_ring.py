@@ -0,0 +1,150 @@
+"""
+Timestamped Sample Ring
+
+Fixed-capacity ring buffer of timestamped samples shared by the hardware
+samplers. Writers append whole blocks under one lock acquisition and readers
+get copies, so a background sampler thread never blocks on its consumers.
+"""
+
+# Standard library imports
+import threading
+from typing import Dict, Optional, Tuple
+
+# Third-party imports
+import numpy as np
+
+
+class TimestampedRing:
+    """Ring buffer of (timestamp, values[width]) rows backed by numpy arrays"""
+
+    def __init__(self, capacity: int, width: int = 1):
+        """
+        Args:
+            capacity: Maximum number of rows kept (oldest rows are overwritten)
+            width: Number of values per row
+        """
+        if capacity <= 0 or width <= 0:
+            raise ValueError("capacity and width must be positive")
+
+        self._capacity = capacity
+        self._width = width
+        self._times = np.zeros(capacity, dtype=np.float64)
+        self._values = np.zeros((capacity, width), dtype=np.float64)
+        self._head = 0  # Next write index
+        self._count = 0
+        self._total = 0  # Rows ever written (for drop accounting)
+        self._lock = threading.Lock()
+
+    @property
+    def capacity(self) -> int:
+        return self._capacity
+
+    @property
+    def width(self) -> int:
+        return self._width
+
+    @property
+    def total_written(self) -> int:
+        return self._total
+
+    def __len__(self) -> int:
+        return self._count
+
+    def append(self, timestamp: float, values) -> None:
+        """Append a single row"""
+        row = np.asarray(values, dtype=np.float64).reshape(1, self._width)
+        self.extend(np.array([timestamp], dtype=np.float64), row)
+
+    def extend(self, timestamps, values) -> None:
+        """
+        Append a block of rows
+
+        Args:
+            timestamps: 1-D array of N timestamps (monotonic seconds)
+            values: Array of shape (N, width) or (N,) when width == 1
+        """
+        times = np.asarray(timestamps, dtype=np.float64).reshape(-1)
+        rows = np.asarray(values, dtype=np.float64).reshape(len(times), self._width)
+        n = len(times)
+        if n == 0:
+            return
+        if n > self._capacity:
+            times = times[-self._capacity :]
+            rows = rows[-self._capacity :]
+
+        with self._lock:
+            m = len(times)
+            first = min(m, self._capacity - self._head)
+            self._times[self._head : self._head + first] = times[:first]
+            self._values[self._head : self._head + first] = rows[:first]
+            rest = m - first
+            if rest:
+                self._times[:rest] = times[first:]
+                self._values[:rest] = rows[first:]
+            self._head = (self._head + m) % self._capacity
+            self._count = min(self._count + m, self._capacity)
+            self._total += n
+
+    def clear(self) -> None:
+        with self._lock:
+            self._head = 0
+            self._count = 0
+
+    def latest(self) -> Optional[Tuple[float, np.ndarray]]:
+        """Most recent row as (timestamp, values) or None when empty"""
+        with self._lock:
+            if self._count == 0:
+                return None
+            idx = (self._head - 1) % self._capacity
+            return float(self._times[idx]), self._values[idx].copy()
+
+    def snapshot(self) -> Tuple[np.ndarray, np.ndarray]:
+        """All rows in chronological order as (timestamps, values) copies"""
+        with self._lock:
+            if self._count < self._capacity:
+                return self._times[: self._count].copy(), self._values[: self._count].copy()
+            order = np.r_[self._head : self._capacity, 0 : self._head]
+            return self._times[order], self._values[order]
+
+    def window(
+        self, duration: Optional[float] = None, end: Optional[float] = None
+    ) -> Tuple[np.ndarray, np.ndarray]:
+        """
+        Rows whose timestamps fall into [end - duration, end]
+
+        Args:
+            duration: Window length in seconds (None = everything up to end)
+            end: Window end timestamp (None = newest sample)
+        """
+        times, values = self.snapshot()
+        if len(times) == 0:
+            return times, values
+        if end is None:
+            end = times[-1]
+        mask = times <= end
+        if duration is not None:
+            mask &= times >= end - duration
+        return times[mask], values[mask]
+
+    def window_stats(
+        self, duration: Optional[float] = None, end: Optional[float] = None
+    ) -> Dict[str, np.ndarray]:
+        """
+        Per-column statistics over a time window
+
+        Returns:
+            Dictionary with count, mean, min, max, std and rms per column
+            (empty arrays when the window has no samples)
+        """
+        times, values = self.window(duration, end)
+        if len(times) == 0:
+            empty = np.zeros(0)
+            return {"count": 0, "mean": empty, "min": empty, "max": empty, "std": empty, "rms": empty}
+        return {
+            "count": len(times),
+            "mean": values.mean(axis=0),
+            "min": values.min(axis=0),
+            "max": values.max(axis=0),
+            "std": values.std(axis=0),
+            "rms": np.sqrt((values**2).mean(axis=0)),
+        }
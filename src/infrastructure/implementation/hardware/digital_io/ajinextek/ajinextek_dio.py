@@ -6,6 +6,7 @@ Provides digital input/output control through AXL library.
 """
 
 # Standard library imports
+import asyncio
 from typing import Any, Dict, List, Optional
 
 # Third-party imports
@@ -57,9 +58,11 @@ class AjinextekDIO(DigitalIOService):
 
         # AXL library interface (싱글톤 인스턴스 사용)
         # Local application imports
+        from infrastructure.implementation.hardware.robot.ajinextek.axl_bringup import AXLBringup
         from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
 
         self._axl_lib = AXLWrapper.get_instance()
+        self._bringup = AXLBringup.get_instance()
         self._detected_modules: Dict[int, Dict[str, Any]] = {}
         self._module_input_counts: Dict[int, int] = {}
         self._module_output_counts: Dict[int, int] = {}
@@ -88,6 +91,9 @@ class AjinextekDIO(DigitalIOService):
         try:
             logger.info("Connecting to Ajinextek DIO hardware")
 
+            # Wait for the shared background AxlOpen only (not the motion stages)
+            await asyncio.wrap_future(self._bringup.opened_future(self._irq_no))
+
             # 중앙화된 연결 관리 사용 (서비스 이름으로 추적)
             self._axl_lib.connect(self._irq_no, service_name=self.SERVICE_NAME)
 
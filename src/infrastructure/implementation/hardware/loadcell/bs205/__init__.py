@@ -1,5 +1,6 @@
 # Local application imports
 from infrastructure.implementation.hardware.loadcell.bs205.bs205_loadcell import BS205LoadCell
+from infrastructure.implementation.hardware.loadcell.bs205.stream_reader import BS205StreamReader
 
 
-__all__ = ["BS205LoadCell"]
+__all__ = ["BS205LoadCell", "BS205StreamReader"]
@@ -6,6 +6,7 @@ Combines adapter and controller functionality into a single service.
 """
 
 # Standard library imports
+import time
 from typing import Any, Dict, Optional
 
 # Third-party imports
@@ -24,12 +25,15 @@ from driver.serial.exceptions import (
     SerialTimeoutError,
 )
 from driver.serial.serial import SerialConnection, SerialManager
+from infrastructure.implementation.hardware.common.peak_tracker import PeakTracker
 from infrastructure.implementation.hardware.loadcell.bs205.constants import (
     CMD_HOLD,
     CMD_HOLD_RELEASE,
     CMD_READ_WEIGHT,
     CMD_ZERO,
     STATUS_MESSAGES,
+    STREAM_RING_CAPACITY,
+    STREAM_STALE_TIMEOUT,
     ZERO_OPERATION_DELAY,
 )
 from infrastructure.implementation.hardware.loadcell.bs205.error_codes import (
@@ -40,6 +44,9 @@ from infrastructure.implementation.hardware.loadcell.bs205.error_codes import (
     BS205OperationError,
     validate_weight_range,
 )
+from infrastructure.implementation.hardware.loadcell.bs205.stream_reader import (
+    BS205StreamReader,
+)
 
 
 class BS205LoadCell(LoadCellService):
@@ -80,6 +87,7 @@ class BS205LoadCell(LoadCellService):
         # State initialization
         self._connection: Optional[SerialConnection] = None
         self._is_connected = False
+        self._stream: Optional[BS205StreamReader] = None  # Owns the port while streaming
 
         # Command rate limiting
         self._last_command_time = 0.0
@@ -174,6 +182,10 @@ class BS205LoadCell(LoadCellService):
         disconnect_error = None
 
         try:
+            if self._stream is not None:
+                self._stream.stop()
+                self._stream = None
+
             if self._connection:
                 try:
                     await self._connection.disconnect()
@@ -204,7 +216,7 @@ class BS205LoadCell(LoadCellService):
         Returns:
             연결 상태
         """
-        return self._is_connected and self._connection is not None
+        return self._is_connected and (self._connection is not None or self._stream is not None)
 
     async def read_force(self) -> ForceValue:
         """
@@ -224,6 +236,9 @@ class BS205LoadCell(LoadCellService):
                 error_code=int(BS205ErrorCode.HARDWARE_NOT_CONNECTED),
             )
 
+        if self._stream is not None:
+            return await self._read_streamed_force()
+
         try:
             # BS205 바이너리 프로토콜 사용
             response = await self._send_bs205_command(CMD_READ_WEIGHT)
@@ -300,6 +315,9 @@ class BS205LoadCell(LoadCellService):
             )
             sampling_interval_ms = int(min_sampling_interval)
 
+        if self._stream is not None:
+            return await self._read_streamed_peak_force(duration_ms)
+
         try:
             logger.info(
                 f"Starting peak force measurement - Duration: {duration_ms}ms, Interval: {sampling_interval_ms}ms"
@@ -491,6 +509,120 @@ class BS205LoadCell(LoadCellService):
             "hardware_type": "BS205",
         }
 
+    # ========================================================================
+    # Streaming
+    # ========================================================================
+
+    async def start_streaming(
+        self, poll: bool = True, ring_capacity: int = STREAM_RING_CAPACITY, serial_factory=None
+    ) -> BS205StreamReader:
+        """
+        Hand the serial port to a background stream reader
+
+        While streaming, read_force() returns the newest streamed weight
+        without a serial round trip, and hold, hold release and zero are
+        written by the reader thread.
+
+        Args:
+            poll: Request each weight (False = indicator in continuous output mode)
+            ring_capacity: Weight samples kept
+            serial_factory: Callable returning an open pyserial-like port
+
+        Returns:
+            The running stream reader (latest/window access)
+        """
+        if not await self.is_connected():
+            raise BS205HardwareError(
+                "BS205 LoadCell is not connected",
+                error_code=int(BS205ErrorCode.HARDWARE_NOT_CONNECTED),
+            )
+        if self._stream is not None:
+            return self._stream
+
+        async with self._command_lock:
+            if self._connection:
+                await self._connection.disconnect()
+                self._connection = None
+
+            stream = BS205StreamReader(
+                port=self._port,
+                baudrate=self._baudrate,
+                bytesize=self._bytesize,
+                stopbits=self._stopbits,
+                parity=self._parity,
+                indicator_id=self._indicator_id,
+                poll=poll,
+                ring_capacity=ring_capacity,
+                serial_factory=serial_factory,
+            )
+            try:
+                await asyncio.to_thread(stream.start)
+            except Exception as e:
+                self._is_connected = False
+                raise BS205CommunicationError(
+                    f"Failed to start BS205 stream reader: {e}",
+                    error_code=int(BS205ErrorCode.COMM_PORT_NOT_AVAILABLE),
+                ) from e
+            self._stream = stream
+        return stream
+
+    async def stop_streaming(self) -> None:
+        """Stop the stream reader and return to command/response mode"""
+        if self._stream is None:
+            return
+        stream, self._stream = self._stream, None
+        await asyncio.to_thread(stream.stop)
+        self._is_connected = False
+        await self.connect()
+
+    async def _read_streamed_peak_force(self, duration_ms: int) -> ForceValue:
+        """Peak of every streamed weight within the next duration_ms"""
+        # One tracker per call, so overlapping measurements do not share a window
+        stream = self._stream
+        tracker = PeakTracker()
+        listener = tracker.attach(stream)
+        tracker.arm()
+        try:
+            await asyncio.sleep(duration_ms / 1000.0)
+        finally:
+            result = tracker.disarm()
+            stream.remove_listener(listener)
+        if not result.valid:
+            raise BS205OperationError(
+                "No streamed force samples during peak measurement",
+                error_code=int(BS205ErrorCode.OPERATION_TIMEOUT),
+            )
+
+        validate_weight_range(result.peak)
+        logger.info(
+            f"Streamed peak force measurement completed - "
+            f"Samples: {result.count}, Duration: {duration_ms}ms, Peak: {result.peak:.3f}kgf"
+        )
+        return ForceValue.from_raw_data(result.peak, MeasurementUnit.KILOGRAM_FORCE)
+
+    def get_stream(self) -> Optional[BS205StreamReader]:
+        """Running stream reader or None in command/response mode"""
+        return self._stream
+
+    async def _read_streamed_force(self) -> ForceValue:
+        """Newest streamed weight, waiting briefly for the first frame"""
+        deadline = time.monotonic() + STREAM_STALE_TIMEOUT
+        while True:
+            sample = self._stream.latest() if self._stream is not None else None
+            now = time.monotonic()
+            if sample is not None and now - sample[0] <= STREAM_STALE_TIMEOUT:
+                break
+            if now >= deadline:
+                raise BS205CommunicationError(
+                    "No recent BS205 stream frame",
+                    error_code=int(BS205ErrorCode.COMM_TIMEOUT),
+                )
+            await asyncio.sleep(0.005)
+
+        weight_value = sample[1]
+        validate_weight_range(weight_value)
+        return ForceValue.from_raw_data(weight_value, MeasurementUnit.KILOGRAM_FORCE)
+
     async def _send_bs205_command(
         self, command: str, timeout: Optional[float] = None
     ) -> Optional[str]:
@@ -504,6 +636,11 @@ class BS205LoadCell(LoadCellService):
         Returns:
             파싱된 응답 문자열
         """
+        if self._stream is not None and command in [CMD_HOLD, CMD_HOLD_RELEASE, CMD_ZERO]:
+            # The stream reader owns the port - it writes the command between requests
+            self._stream.send_command(command)
+            return "OK"
+
         if not self._connection:
             raise BS205CommunicationError(
                 "No connection available",
@@ -80,6 +80,16 @@ WEIGHT_FIELD_INDEX = 1
 UNIT_FIELD_INDEX = 2
 STATUS_FIELD_INDEX = 1
 
+# Streaming Reader
+FRAME_STX = 0x02  # Start of response frame
+FRAME_ETX = 0x03  # End of response frame
+FRAME_MIN_SIZE = 5  # STX + ID + Sign + one digit + ETX
+FRAME_MAX_VALUE_BYTES = 8  # Digits, decimal point and padding spaces
+STREAM_READ_TIMEOUT = 0.01  # Serial read timeout until the reactor takes the port
+STREAM_REQUEST_TIMEOUT = 0.1  # Re-send the weight request when no frame arrives
+STREAM_RING_CAPACITY = 6000  # Weight samples kept (~1 min at 100 Hz)
+STREAM_STALE_TIMEOUT = 0.5  # Streamed values older than this are not returned
+
 # Error Thresholds
 MAX_CONSECUTIVE_ERRORS = 5
 COMMUNICATION_TIMEOUT_MULTIPLIER = 2.0
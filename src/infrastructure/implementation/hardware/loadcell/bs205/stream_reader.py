@@ -0,0 +1,436 @@
+"""
+BS205 Streaming Reader
+
+Keeps the BS205 serial port open on the shared SerialReactor and turns the
+byte stream into a timestamped weight ring. BS205LoadCell.read_force() pays for a
+command round trip, a fixed 150 ms response delay and a string parse per
+reading; here the next weight request goes out as soon as the previous frame
+has arrived (poll mode), or the reader just listens to an indicator set to
+continuous output (listen mode). Poll requests go through the reactor's
+request(), so a lost frame is re-requested from the reactor's shared
+deadline heap after request_timeout.
+
+BS205FrameScanner parses frames (STX + ID + Sign + Value + ETX) byte by byte
+across read boundaries into preallocated arrays, so a frame split over two
+reads or surrounded by line noise costs no extra buffering. Each weight is
+stamped with time.monotonic() - the clock of the AXL samplers - corrected
+back to the arrival of its ETX byte.
+
+Hold, hold release and zero are written with send_command() under the
+reactor's port write lock, between weight requests. Listeners registered
+with add_listener() see every weight as it is stored (e.g. PeakTracker).
+"""
+
+# Standard library imports
+from array import array
+from concurrent.futures import Future
+import threading
+from typing import Any, Callable, Dict, List, Optional, Tuple
+
+# Third-party imports
+from loguru import logger
+import numpy as np
+
+# Local application imports
+from driver.serial.constants import REACTOR_READ_SIZE
+from driver.serial.exceptions import SerialCommunicationError, SerialTimeoutError
+from driver.serial.reactor import ReactorFrame, SerialReactor, get_shared_reactor
+from infrastructure.implementation.hardware.common.sample_ring import TimestampedRing
+from infrastructure.implementation.hardware.loadcell.bs205.constants import (
+    CMD_READ_WEIGHT,
+    DEFAULT_BAUDRATE,
+    DEFAULT_INDICATOR_ID,
+    FRAME_ETX,
+    FRAME_MAX_VALUE_BYTES,
+    FRAME_MIN_SIZE,
+    FRAME_STX,
+    STREAM_READ_TIMEOUT,
+    STREAM_REQUEST_TIMEOUT,
+    STREAM_RING_CAPACITY,
+)
+
+# Scanner states
+_IDLE = 0  # Waiting for STX
+_ID = 1  # Expecting the indicator ID byte
+_SIGN = 2  # Expecting '+' or '-'
+_VALUE = 3  # Digits, '.' and spaces until ETX
+
+_PLUS = 0x2B
+_MINUS = 0x2D
+_DOT = 0x2E
+_SPACE = 0x20
+_DIGIT_0 = 0x30
+_DIGIT_9 = 0x39
+_ID_FIRST = 0x30  # ID 0
+_ID_LAST = 0x3F  # ID 15
+
+_POW10 = tuple(10.0**n for n in range(FRAME_MAX_VALUE_BYTES + 1))
+
+_PARITY_MAP = {None: "N", "none": "N", "even": "E", "odd": "O", "mark": "M", "space": "S"}
+
+
+def encode_command(indicator_id: int, command: str) -> bytes:
+    """BS205 command bytes: ID (0x30 + id) + command + CRLF"""
+    return bytes([0x30 + indicator_id, ord(command), 0x0D, 0x0A])
+
+
+class BS205FrameScanner:
+    """BS205 응답 프레임 증분 스캐너"""
+
+    def __init__(self, indicator_id: Optional[int] = None):
+        """
+        초기화
+
+        Args:
+            indicator_id: Accept only frames of this indicator (None = any)
+        """
+        self._expected_id = None if indicator_id is None else 0x30 + indicator_id
+        self.frames = 0
+        self.errors = 0  # Frames dropped for unexpected bytes
+        self._reset()
+
+    def _reset(self) -> None:
+        self._state = _IDLE
+        self._negative = False
+        self._mantissa = 0
+        self._decimals = 0
+        self._digits = 0
+        self._value_bytes = 0
+        self._dot = False
+
+    def _error(self) -> None:
+        self.errors += 1
+        self._state = _IDLE
+
+    def feed(self, data, size: int, weights: array, ends: array) -> int:
+        """
+        Scan bytes and complete any frames they finish
+
+        Args:
+            data: Received bytes (bytes, bytearray or memoryview)
+            size: Number of valid bytes in data
+            weights: Output array receiving the weight of each completed frame
+            ends: Output array receiving the index of each frame's ETX in data
+
+        Returns:
+            Number of frames completed (entries written to weights and ends)
+        """
+        count = 0
+        capacity = len(weights)
+        for index in range(size):
+            byte = data[index]
+            state = self._state
+            if byte == FRAME_STX:
+                if state != _IDLE:
+                    self._error()  # Frame restarted before its ETX
+                self._reset()
+                self._state = _ID
+            elif state == _IDLE:
+                continue  # Line noise and CR/LF between frames
+            elif state == _ID:
+                if _ID_FIRST <= byte <= _ID_LAST and (
+                    self._expected_id is None or byte == self._expected_id
+                ):
+                    self._state = _SIGN
+                else:
+                    self._error()
+            elif state == _SIGN:
+                if byte == _PLUS or byte == _MINUS:
+                    self._negative = byte == _MINUS
+                    self._state = _VALUE
+                else:
+                    self._error()
+            elif byte == FRAME_ETX:
+                if self._digits == 0 or count == capacity:
+                    self._error()
+                    continue
+                weight = self._mantissa / _POW10[self._decimals]
+                weights[count] = -weight if self._negative else weight
+                ends[count] = index
+                count += 1
+                self.frames += 1
+                self._state = _IDLE
+            else:
+                self._value_bytes += 1
+                if self._value_bytes > FRAME_MAX_VALUE_BYTES:
+                    self._error()
+                elif _DIGIT_0 <= byte <= _DIGIT_9:
+                    self._mantissa = self._mantissa * 10 + (byte - _DIGIT_0)
+                    self._digits += 1
+                    if self._dot:
+                        self._decimals += 1
+                elif byte == _DOT and not self._dot:
+                    self._dot = True
+                elif byte != _SPACE:
+                    self._error()
+        return count
+
+
+class BS205Framer:
+    """Reactor framing plugin: (weight, bytes received after its ETX) per frame"""
+
+    def __init__(self, scanner: BS205FrameScanner, max_read: int = REACTOR_READ_SIZE):
+        """
+        Initialize BS205 framer
+
+        Args:
+            scanner: Frame scanner keeping the state across reads
+            max_read: Largest read the reactor delivers
+        """
+        self._scanner = scanner
+        max_frames = max_read // FRAME_MIN_SIZE + 1
+        self._weights = array("d", [0.0]) * max_frames
+        self._ends = array("l", [0]) * max_frames
+
+    def feed(self, data: bytes) -> List[Tuple[float, int]]:
+        size = len(data)
+        count = self._scanner.feed(data, size, self._weights, self._ends)
+        return [(self._weights[i], size - 1 - self._ends[i]) for i in range(count)]
+
+
+class BS205StreamReader:
+    """BS205 로드셀 연속 수신 리더 (시리얼 리액터 + 타임스탬프 링)"""
+
+    def __init__(
+        self,
+        port: str,
+        baudrate: int = DEFAULT_BAUDRATE,
+        bytesize: int = 8,
+        stopbits: int = 1,
+        parity: Optional[str] = None,
+        indicator_id: int = DEFAULT_INDICATOR_ID,
+        poll: bool = True,
+        ring_capacity: int = STREAM_RING_CAPACITY,
+        request_timeout: float = STREAM_REQUEST_TIMEOUT,
+        serial_factory: Optional[Callable[..., Any]] = None,
+        reactor: Optional[SerialReactor] = None,
+    ):
+        """
+        초기화
+
+        Args:
+            port: Serial port (e.g., "COM3", "/dev/ttyUSB0")
+            baudrate: Baud rate
+            bytesize: Data bits
+            stopbits: Stop bits
+            parity: Parity setting (None, "even", "odd", "mark", "space")
+            indicator_id: Indicator device ID
+            poll: Request each weight (False = indicator in continuous output mode)
+            ring_capacity: Weight samples kept
+            request_timeout: Re-send the weight request when no frame arrives
+            serial_factory: Callable returning an open pyserial-like port
+                (defaults to serial.Serial)
+            reactor: Serial reactor receiving the port (defaults to the shared reactor)
+        """
+        self._port_name = port
+        self._baudrate = baudrate
+        self._bytesize = bytesize
+        self._stopbits = stopbits
+        self._parity = parity
+        self._indicator_id = indicator_id
+        self._poll = poll
+        self._request_timeout = request_timeout
+        self._serial_factory = serial_factory
+        self._reactor = reactor
+        self._name = f"BS205:{port}:{id(self):x}"
+
+        parity_bits = 0 if _PARITY_MAP.get(parity.lower() if parity else None, "N") == "N" else 1
+        self._byte_time = (1 + bytesize + parity_bits + stopbits) / baudrate
+
+        self._ring = TimestampedRing(ring_capacity, 1)
+        self._scanner = BS205FrameScanner(indicator_id)
+        self._request = encode_command(indicator_id, CMD_READ_WEIGHT)
+        self._listeners: List[Callable[[float, float], None]] = []
+        self._listener_errors = 0
+
+        self._serial: Optional[Any] = None
+        self._requests = 0
+        self._request_timeouts = 0
+        self._read_errors = 0
+        self._running = False
+
+    # ========================================================================
+    # Reactor Registration
+    # ========================================================================
+
+    def start(self) -> None:
+        """Open the port, register it with the reactor and send the first request"""
+        if self._running:
+            return
+        if self._reactor is None:
+            self._reactor = get_shared_reactor()
+        self._serial = self._open()
+        framer = BS205Framer(self._scanner)
+        self._reactor.add_port(self._name, self._serial, framer, listener=self._on_frame)
+        self._running = True
+        self._send_request()
+        mode = "poll" if self._poll else "listen"
+        logger.info(f"BS205 stream reader started on {self._port_name} ({mode} mode)")
+
+    def stop(self) -> None:
+        """Remove the port from the reactor and close it (the ring is kept)"""
+        if self._running:
+            self._running = False  # Failed poll requests are not re-sent
+            stats = self._reactor.get_statistics().get(self._name)
+            if stats is not None:
+                self._read_errors += stats["read_errors"]
+            self._reactor.remove_port(self._name)
+        if self._serial is not None:
+            try:
+                self._serial.close()
+            except Exception as e:
+                logger.warning(f"Error closing BS205 stream port: {e}")
+            self._serial = None
+        logger.info("BS205 stream reader stopped")
+
+    @property
+    def is_running(self) -> bool:
+        return self._running
+
+    def _open(self) -> Any:
+        factory = self._serial_factory
+        if factory is None:
+            # Third-party imports
+            import serial
+
+            factory = serial.Serial
+
+        port = factory(
+            port=self._port_name,
+            baudrate=self._baudrate,
+            bytesize=self._bytesize,
+            stopbits=float(self._stopbits),
+            parity=_PARITY_MAP.get(self._parity.lower() if self._parity else None, "N"),
+            timeout=STREAM_READ_TIMEOUT,
+        )
+        # Linux serial drivers: deliver bytes without the driver's receive latency
+        set_low_latency = getattr(port, "set_low_latency_mode", None)
+        if set_low_latency is not None:
+            try:
+                set_low_latency(True)
+            except (OSError, ValueError, NotImplementedError) as e:
+                logger.debug(f"Low-latency mode not supported on {self._port_name}: {e}")
+        return port
+
+    def _on_frame(self, frame: ReactorFrame) -> None:
+        weight, trailing = frame.data
+        # Bytes after the ETX were still on the wire when it arrived
+        timestamp = frame.timestamp - trailing * self._byte_time
+        self._ring.append(timestamp, weight)
+        if self._listeners:
+            self._notify(timestamp, weight)
+
+    def _notify(self, timestamp: float, weight: float) -> None:
+        for listener in self._listeners:
+            try:
+                listener(timestamp, weight)
+            except Exception as e:
+                self._listener_errors += 1
+                if self._listener_errors == 1 or self._listener_errors % 100 == 0:
+                    logger.warning(f"BS205 stream listener failed ({self._listener_errors}x): {e}")
+
+    def _send_request(self) -> None:
+        """Request the next weight; the reactor resolves or expires the request"""
+        if not (self._poll and self._running):
+            return
+        try:
+            future = self._reactor.request(self._name, self._request, self._request_timeout)
+        except SerialCommunicationError:
+            return  # Port removed
+        self._requests += 1
+        future.add_done_callback(self._on_request_done)
+
+    def _on_request_done(self, future: Future) -> None:
+        if future.cancelled() or not self._running:
+            return
+        error = future.exception()
+        if error is None:
+            self._send_request()
+        elif isinstance(error, SerialTimeoutError):
+            self._request_timeouts += 1
+            self._send_request()
+        elif isinstance(error, SerialCommunicationError):
+            self._read_errors += 1
+            if self._read_errors == 1 or self._read_errors % 100 == 0:
+                logger.warning(f"BS205 weight request failed ({self._read_errors}x): {error}")
+            # Retry later instead of spinning on a failing write
+            timer = threading.Timer(self._request_timeout, self._send_request)
+            timer.daemon = True
+            timer.start()
+
+    # ========================================================================
+    # Commands
+    # ========================================================================
+
+    def send_command(self, command: str) -> None:
+        """
+        Write a command without response (hold, hold release, zero)
+
+        The reactor serializes it with the weight requests; weight frames keep
+        streaming around it.
+        """
+        if not self.is_running:
+            raise RuntimeError("BS205 stream reader is not running")
+        self._reactor.send(self._name, encode_command(self._indicator_id, command))
+
+    # ========================================================================
+    # Listeners
+    # ========================================================================
+
+    def add_listener(self, listener: Callable[[float, float], None]) -> None:
+        """
+        Call listener(timestamp, kg) from the reactor for every weight
+
+        Listeners run on the reactor and must return quickly.
+        """
+        # Copy-on-write so the reader thread iterates a stable list
+        self._listeners = self._listeners + [listener]
+
+    def remove_listener(self, listener: Callable[[float, float], None]) -> None:
+        self._listeners = [item for item in self._listeners if item != listener]
+
+    # ========================================================================
+    # Data Access
+    # ========================================================================
+
+    def latest(self) -> Optional[Tuple[float, float]]:
+        """Newest weight as (timestamp, kg) or None before the first frame"""
+        row = self._ring.latest()
+        if row is None:
+            return None
+        return row[0], float(row[1][0])
+
+    def window(
+        self, duration: Optional[float] = None, end: Optional[float] = None
+    ) -> Tuple[np.ndarray, np.ndarray]:
+        """Weights (kg) and timestamps within [end - duration, end]"""
+        times, values = self._ring.window(duration, end)
+        return times, values[:, 0]
+
+    def window_stats(
+        self, duration: Optional[float] = None, end: Optional[float] = None
+    ) -> Dict[str, Any]:
+        """Count, mean, min, max, std and rms of the weights in a window"""
+        stats = self._ring.window_stats(duration, end)
+        if stats["count"] == 0:
+            return {key: (0 if key == "count" else None) for key in stats}
+        return {key: (value if key == "count" else float(value[0])) for key, value in stats.items()}
+
+    def get_ring(self) -> TimestampedRing:
+        """Raw weight ring (one column, kg)"""
+        return self._ring
+
+    def get_statistics(self) -> Dict[str, Any]:
+        """Frame, request and error counters"""
+        read_errors = self._read_errors
+        if self._running:
+            read_errors += self._reactor.get_statistics().get(self._name, {}).get("read_errors", 0)
+        return {
+            "frames": self._scanner.frames,
+            "frame_errors": self._scanner.errors,
+            "requests": self._requests,
+            "request_timeouts": self._request_timeouts,
+            "read_errors": read_errors,
+            "listener_errors": self._listener_errors,
+            "buffered": len(self._ring),
+        }
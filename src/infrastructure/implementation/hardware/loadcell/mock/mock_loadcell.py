@@ -6,7 +6,7 @@ Mock implementation for testing and development without real hardware.
 
 # Standard library imports
 import random
-from typing import Any, Dict, List, Optional
+from typing import Any, Callable, Dict, List, Optional
 
 # Third-party imports
 import asyncio
@@ -53,6 +53,7 @@ class MockLoadCell(LoadCellService):
         self._is_connected = False
         self._zero_offset = 0.0
         self._value_index = 0
+        self._force_source: Optional[Callable[[], float]] = None
 
         # Connection parameters (injected at creation time)
         self._port = port
@@ -144,7 +145,10 @@ class MockLoadCell(LoadCellService):
         # 짧은 측정 지연
         await asyncio.sleep(0.05)
 
-        if self._mock_values and self._value_index < len(self._mock_values):
+        if self._force_source is not None:
+            # 외부 힘 소스 (예: 시뮬레이션 DUT 모델)
+            force = self._force_source()
+        elif self._mock_values and self._value_index < len(self._mock_values):
             # 사전 정의된 값 사용
             force = self._mock_values[self._value_index]
             self._value_index = (self._value_index + 1) % len(self._mock_values)
@@ -256,7 +260,9 @@ class MockLoadCell(LoadCellService):
             await asyncio.sleep(0.5)
 
             # 현재 읽기값을 영점으로 설정
-            if self._mock_values and self._value_index < len(self._mock_values):
+            if self._force_source is not None:
+                self._zero_offset = self._force_source()
+            elif self._mock_values and self._value_index < len(self._mock_values):
                 self._zero_offset = self._mock_values[self._value_index]
             else:
                 # Zero offset should be small - representing sensor bias, not full base force
@@ -394,6 +400,17 @@ class MockLoadCell(LoadCellService):
         self._value_index = 0
         logger.info(f"Mock values updated: {len(values)} values")
 
+    def set_force_source(self, source: Optional[Callable[[], float]]) -> None:
+        """
+        외부 힘 소스 설정
+
+        Args:
+            source: Callable returning the force in N (e.g. a simulated DUT's
+                loadcell reading), or None to fall back to mock values
+        """
+        self._force_source = source
+        logger.info(f"Force source {'set' if source else 'cleared'}")
+
     def set_base_force(self, force: float) -> None:
         """
         기본 힘 값 설정
@@ -1,5 +1,6 @@
 # Local application imports
 from infrastructure.implementation.hardware.mcu.lma.lma_mcu import LMAMCU
+from infrastructure.implementation.hardware.mcu.lma.transport import LMATransport
 
 
-__all__ = ["LMAMCU"]
+__all__ = ["LMAMCU", "LMATransport"]
@@ -25,6 +25,9 @@ CMD_SET_COOLING_TEMP = 0x06
 CMD_REQUEST_TEMP = 0x07
 CMD_STROKE_INIT_COMPLETE = 0x08
 
+# Fixed Frames
+TEMP_REQUEST_FRAME = STX + bytes([CMD_REQUEST_TEMP, 0]) + ETX  # FFFF0700FEFE
+
 # Status Codes (Controller -> PC)
 STATUS_BOOT_COMPLETE = 0x00
 STATUS_TEST_MODE_COMPLETE = 0x01
@@ -64,6 +67,20 @@ DEFAULT_TIMEOUT = 5.0
 DEFAULT_RETRY_COUNT = 3
 BOOT_COMPLETE_TIMEOUT = 60.0  # Boot complete message wait timeout
 
+# Event-Driven Transport
+TRANSPORT_EVENT_CAPACITY = 64  # Unclaimed frames kept for later waiters
+
+# Thermal Settle Detection
+THERMAL_FIT_WINDOW = 120.0  # Seconds of temperature history used by the fit
+THERMAL_MIN_SAMPLES = 6  # Samples before the fit may declare settled
+THERMAL_CONFIDENCE_Z = 2.0  # Standard errors added to the predicted final temperature
+THERMAL_TAU_MIN = 0.5  # Time constant search range (s)
+THERMAL_TAU_MAX = 600.0
+THERMAL_TAU_STEPS = 40  # Log-spaced time constant candidates
+THERMAL_HORIZON_TAUS = 6.0  # Prediction horizon in multiples of the slowest time constant
+THERMAL_HORIZON_STEPS = 256  # Prediction grid points
+THERMAL_REQUEST_INTERVAL = 0.25  # Temperature request period while waiting to settle (s)
+
 # Temperature Limits (°C)
 MIN_TEMPERATURE = -40.0
 MAX_TEMPERATURE = 125.0
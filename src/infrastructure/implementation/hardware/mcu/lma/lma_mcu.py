@@ -24,6 +24,19 @@ from domain.exceptions.eol_exceptions import (
     HardwareConnectionError,
     HardwareOperationError,
 )
+from infrastructure.implementation.hardware.mcu.lma.constants import (
+    TEMP_REQUEST_FRAME,
+    THERMAL_REQUEST_INTERVAL,
+)
+from infrastructure.implementation.hardware.mcu.lma.thermal_settle import (
+    ThermalEstimate,
+    ThermalSettleDetector,
+)
+from infrastructure.implementation.hardware.mcu.lma.transport import (
+    LMAFrame,
+    LMATransport,
+    parse_temperature,
+)
 
 
 # LMA MCU Constants
@@ -48,6 +61,7 @@ class LMAMCU(MCUService):
         bytesize: int = 8,
         stopbits: int = 1,
         parity: Optional[str] = None,
+        use_transport: bool = True,
     ):
         """Initialize Fast LMA MCU service
 
@@ -58,6 +72,8 @@ class LMAMCU(MCUService):
             bytesize: Data bits (default: 8)
             stopbits: Stop bits (default: 1)
             parity: Parity setting (default: None)
+            use_transport: Receive through the event-driven LMATransport (serial reactor)
+                thread instead of polling the port (default: True)
         """
         self.serial_conn: Optional[serial.Serial] = None
         self._port = port
@@ -86,6 +102,10 @@ class LMAMCU(MCUService):
         # Packet buffering for multi-response commands
         self._packet_buffer = []  # Store additional packets received during first response
 
+        # Event-driven receive path (serial reactor, frames matched by status code)
+        self._use_transport = use_transport
+        self._transport: Optional[LMATransport] = None
+
     async def connect(self) -> None:
         """Connect to MCU hardware using direct serial communication"""
         try:
@@ -101,6 +121,11 @@ class LMAMCU(MCUService):
                 timeout=self._timeout,
             )
 
+            if self._use_transport:
+                self._transport = LMATransport(self.serial_conn)
+                self._transport.add_listener(self._on_transport_frame)
+                self._transport.start()
+
             self._is_connected = True
             logger.info("Fast MCU connection successful")
 
@@ -115,6 +140,9 @@ class LMAMCU(MCUService):
         disconnect_error = None
 
         try:
+            if self._transport is not None:
+                self._transport.stop()
+
             if self.serial_conn and self.serial_conn.is_open:
                 try:
                     self.serial_conn.close()
@@ -130,6 +158,7 @@ class LMAMCU(MCUService):
 
         finally:
             # Always perform cleanup to prevent resource leaks
+            self._transport = None
             self.serial_conn = None
             self._is_connected = False
 
@@ -174,6 +203,11 @@ class LMAMCU(MCUService):
             packet_bytes = bytes.fromhex(packet_hex.replace(" ", ""))
             start_time = time.time()
 
+            if self._transport is not None:
+                logger.info(f"\033[95mPC -> MCU:\033[0m \033[95m{packet_hex} ({description})\033[0m")
+                frame = self._transport.request(packet_bytes, actual_timeout)
+                return self._transport_response(frame, description, start_time, actual_timeout)
+
             if self.serial_conn:
                 self.serial_conn.write(packet_bytes)
             else:
@@ -492,7 +526,101 @@ class LMAMCU(MCUService):
         self, packet_hex: str, description: str = "", timeout: Optional[float] = None
     ) -> Optional[bytes]:
         """Async wrapper for packet transmission"""
-        return self._send_packet_sync(packet_hex, description, timeout)
+        if self._transport is None:
+            return self._send_packet_sync(packet_hex, description, timeout)
+
+        # Transport: await the matching response without blocking the event loop
+        self._ensure_connected()
+        actual_timeout = timeout if timeout is not None else self._timeout
+        try:
+            packet_bytes = bytes.fromhex(packet_hex.replace(" ", ""))
+            start_time = time.time()
+            logger.info(f"\033[95mPC -> MCU:\033[0m \033[95m{packet_hex} ({description})\033[0m")
+            frame = await self._transport.request_async(packet_bytes, actual_timeout)
+        except Exception as e:
+            logger.error(f"Communication error: {e}")
+            raise HardwareOperationError("fast_lma_mcu", "_send_packet", str(e)) from e
+        return self._transport_response(frame, description, start_time, actual_timeout)
+
+    def _transport_response(
+        self, frame: Optional[LMAFrame], description: str, start_time: float, timeout: float
+    ) -> Optional[bytes]:
+        """Log a transport response like the polling path and return its packet bytes"""
+        if frame is None:
+            logger.warning(f"TIMEOUT with NO matching response received ({timeout}s)")
+            return None
+
+        response_time = (time.time() - start_time) * 1000
+        logger.info(
+            f"\033[92mPC <- MCU:\033[0m \033[92m{frame.raw.hex().upper()} (+{response_time:.1f}ms)\033[0m"
+        )
+        self._analyze_response_packet(frame.raw, description)
+        return frame.raw
+
+    def _on_transport_frame(self, frame: LMAFrame) -> None:
+        """Transport listener: keep the cached temperature current (reactor thread)"""
+        if frame.status == 0x07 and len(frame.data) >= 8:
+            ir_temp, outside_temp = parse_temperature(frame)
+            self._current_temperature = ir_temp
+            logger.debug(f"Temperature frame - IR: {ir_temp:.1f}°C, Outside: {outside_temp:.1f}°C")
+        else:
+            packet_type = self._classify_packet(frame.raw)
+            logger.debug(f"MCU frame received: {frame.raw.hex().upper()} ({packet_type})")
+
+    async def _wait_via_transport(
+        self,
+        timeout: float,
+        description: str,
+        quiet: bool,
+        expected_cmd: Optional[int],
+    ) -> Optional[bytes]:
+        """_wait_for_additional_response() on the transport - frames are pushed, not polled"""
+        if self._transport is None:
+            return None
+
+        if not quiet:
+            logger.info(
+                f"\033[95mWAITING for additional response: {description} (timeout: {timeout}s)\033[0m"
+            )
+
+        # Long heating/cooling waits keep requesting the temperature like the polling path
+        monitor_temperature = timeout > 10.0 and (
+            "temperature" in description.lower() or "cooling" in description.lower()
+        )
+        temp_request_interval = 1.0
+        start_time = time.time()
+        waiter = asyncio.wrap_future(self._transport.expect(expected_cmd))
+        try:
+            while True:
+                remaining = timeout - (time.time() - start_time)
+                if remaining <= 0:
+                    break
+                wait_time = remaining
+                if monitor_temperature:
+                    try:
+                        self._transport.send(TEMP_REQUEST_FRAME)
+                    except Exception as e:
+                        logger.warning(f"Failed to send temperature request: {e}")
+                    wait_time = min(remaining, temp_request_interval)
+
+                done, _ = await asyncio.wait({waiter}, timeout=wait_time)
+                if done:
+                    frame = waiter.result()
+                    elapsed_ms = (time.time() - start_time) * 1000
+                    logger.info(
+                        f"\033[92mPC <- MCU:\033[0m \033[92m{frame.raw.hex().upper()} "
+                        f"({self._classify_packet(frame.raw)}) @ +{elapsed_ms:.1f}ms\033[0m"
+                    )
+                    return frame.raw
+        finally:
+            if not waiter.done():
+                waiter.cancel()
+
+        if not quiet:
+            logger.warning(
+                f"ADDITIONAL_TIMEOUT with NO additional response data received ({timeout:.1f}s)"
+            )
+        return None
 
     async def _wait_for_additional_response(
         self,
@@ -518,6 +646,9 @@ class LMAMCU(MCUService):
         """
         self._ensure_connected()
 
+        if self._transport is not None:
+            return await self._wait_via_transport(timeout, description, quiet, expected_cmd)
+
         # First check if we have packets in the buffer from previous receive
         if self._packet_buffer:
             packet = self._packet_buffer.pop(0)
@@ -709,6 +840,20 @@ class LMAMCU(MCUService):
 
             # Wait for boot complete signal with proper packet parsing
             boot_timeout = 60.0  # 60 second timeout
+
+            if self._transport is not None:
+                frame = await self._transport.wait_for_async(0x00, boot_timeout)
+                if frame is None:
+                    raise HardwareOperationError(
+                        "fast_lma_mcu",
+                        "wait_boot_complete",
+                        "MCU boot complete signal timeout - no boot complete packet received",
+                    )
+                logger.info(
+                    f"\033[92mPC <- MCU:\033[0m \033[92m{frame.raw.hex().upper()} (boot complete confirmed)\033[0m"
+                )
+                logger.info("MCU boot complete confirmed")
+                return
             start_time = time.time()
             response_data = b""
 
@@ -1080,6 +1225,72 @@ class LMAMCU(MCUService):
             return None  # No temperature cached yet
         return self._current_temperature
 
+    async def wait_temperature_settled(
+        self,
+        target_temp: float,
+        tolerance: float,
+        timeout: float,
+        order: int = 1,
+        request_interval: float = THERMAL_REQUEST_INTERVAL,
+    ) -> Optional[ThermalEstimate]:
+        """
+        Wait until the temperature step response settles inside target +/- tolerance
+
+        Temperature is requested every request_interval. The serial reactor
+        only hands each response to a ThermalSettleDetector; the fit runs in a
+        worker thread from this coroutine, so a slow (order 2) fit never
+        delays frames of other devices on the shared reactor.
+
+        Args:
+            target_temp: Set-point temperature (°C)
+            tolerance: Allowed deviation from target (°C)
+            timeout: Maximum wait in seconds
+            order: Exponential terms in the response model (1 or 2)
+            request_interval: Temperature request period in seconds
+
+        Returns:
+            Latest estimate (settled=False on timeout), or None without the
+            transport or before enough samples
+        """
+        self._ensure_connected()
+        if self._transport is None:
+            return None
+
+        detector = ThermalSettleDetector(target_temp, tolerance, order=order)
+        listener = detector.attach(self._transport)
+        settled: Optional[ThermalEstimate] = None
+        start_time = time.time()
+        try:
+            while True:
+                remaining = timeout - (time.time() - start_time)
+                if remaining <= 0:
+                    break
+                try:
+                    self._transport.send(TEMP_REQUEST_FRAME)
+                except Exception as e:
+                    logger.warning(f"Failed to send temperature request: {e}")
+                settled = await detector.wait_settled(min(remaining, request_interval))
+                if settled is not None:
+                    break
+        finally:
+            self._transport.remove_listener(listener)
+
+        estimate = settled or detector.estimate()
+        elapsed = time.time() - start_time
+        if settled is not None:
+            logger.info(
+                f"Temperature settled at {target_temp:.1f}°C after {elapsed:.1f}s "
+                f"(predicted final {estimate.final_temperature:.2f}"
+                f"±{estimate.final_stderr:.2f}°C, {estimate.samples} samples)"
+            )
+        elif estimate is not None:
+            logger.warning(
+                f"Temperature not settled at {target_temp:.1f}°C within {timeout:.1f}s "
+                f"(predicted final {estimate.final_temperature:.2f}°C, "
+                f"time to band: {estimate.time_to_band})"
+            )
+        return estimate
+
     async def set_test_mode(self, mode: TestMode) -> None:
         """Set test mode"""
         self._ensure_connected()
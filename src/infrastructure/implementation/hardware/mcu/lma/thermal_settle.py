@@ -0,0 +1,296 @@
+"""
+LMA MCU Thermal Settle Detector
+
+Consumes the MCU temperature stream (LMATransport frames) after a set-point
+step and fits the response online instead of waiting out fixed retry delays:
+
+    order 1:  T(t) = T_final + c1 * exp(-t / tau1)
+    order 2:  T(t) = T_final + c1 * exp(-t / tau1) + c2 * exp(-t / tau2)
+
+The time constants are searched over a log-spaced grid, then a finer grid
+around the best candidate. For every candidate the linear coefficients come
+from the normal equations, solved for all candidates at once as one batched
+numpy problem, and the candidate with the smallest residual wins. The standard error of T_final gives a confidence
+margin, and evaluating the model forward predicts the time until the
+trajectory stays inside target +/- tolerance.
+
+The detector signals settled as soon as the latest sample is inside the band
+and the predicted trajectory - widened by the confidence margin - never
+leaves it again, which is usually well before a fixed wait would end.
+
+Frames arrive on the shared serial reactor thread, so on_frame() only
+appends the sample; the fit (milliseconds for order 1, tens of milliseconds
+for order 2) runs in a worker thread started by wait_settled().
+"""
+
+# Standard library imports
+from collections import deque
+from concurrent.futures import Future
+from dataclasses import dataclass
+import threading
+from typing import Any, Callable, Deque, List, Optional, Tuple
+
+# Third-party imports
+import asyncio
+import numpy as np
+
+# Local application imports
+from infrastructure.implementation.hardware.mcu.lma.constants import (
+    STATUS_TEMP_RESPONSE,
+    THERMAL_CONFIDENCE_Z,
+    THERMAL_FIT_WINDOW,
+    THERMAL_HORIZON_STEPS,
+    THERMAL_HORIZON_TAUS,
+    THERMAL_MIN_SAMPLES,
+    THERMAL_TAU_MAX,
+    THERMAL_TAU_MIN,
+    THERMAL_TAU_STEPS,
+)
+from infrastructure.implementation.hardware.mcu.lma.transport import LMAFrame, parse_temperature
+
+
+@dataclass(frozen=True)
+class ThermalEstimate:
+    """Fitted step response at the latest sample"""
+
+    final_temperature: float  # Predicted asymptote (°C)
+    final_stderr: float  # Standard error of final_temperature
+    time_constants: Tuple[float, ...]  # Fitted tau per exponential term (s)
+    residual_std: float  # Fit residual standard deviation (°C)
+    time_to_band: Optional[float]  # Seconds until inside the band for good (None = never)
+    settled: bool
+    samples: int
+    timestamp: float  # Time of the latest sample
+
+
+class ThermalSettleDetector:
+    """MCU 온도 스텝 응답 온라인 피팅 및 안정화 예측기"""
+
+    def __init__(
+        self,
+        target: float,
+        tolerance: float,
+        order: int = 1,
+        confidence_z: float = THERMAL_CONFIDENCE_Z,
+        window: float = THERMAL_FIT_WINDOW,
+        min_samples: int = THERMAL_MIN_SAMPLES,
+    ):
+        """
+        초기화
+
+        Args:
+            target: Set-point temperature (°C)
+            tolerance: Allowed deviation from target (°C)
+            order: Number of exponential terms in the response model (1 or 2)
+            confidence_z: Standard errors of the final temperature kept inside the band
+            window: Seconds of history used by the fit
+            min_samples: Samples required before settled can be signalled
+        """
+        if order not in (1, 2):
+            raise ValueError(f"order must be 1 or 2, got {order}")
+        if tolerance <= 0:
+            raise ValueError(f"tolerance must be positive, got {tolerance}")
+
+        self._order = order
+        self._confidence_z = confidence_z
+        self._window = window
+        self._min_samples = max(min_samples, order * 2 + 2)
+
+        taus = np.geomspace(THERMAL_TAU_MIN, THERMAL_TAU_MAX, THERMAL_TAU_STEPS)
+        if order == 1:
+            self._tau_sets = taus[:, None]
+        else:
+            first, second = np.triu_indices(len(taus), k=1)
+            self._tau_sets = np.stack([taus[first], taus[second]], axis=1)
+        # Multipliers spanning one coarse grid step either side of a candidate
+        step = np.linspace(-1.0, 1.0, 9) * np.log(taus[1] / taus[0])
+        grid = np.stack(np.meshgrid(*[step] * order, indexing="ij"), axis=-1)
+        self._refine_factors = np.exp(grid.reshape(-1, order))
+
+        self._lock = threading.Lock()  # Samples and results; never held during a fit
+        self._fit_lock = threading.Lock()  # One fit at a time
+        self._samples: Deque[Tuple[float, float]] = deque()
+        self._fitted = True  # No samples added since the last fit
+        self._waiters: List[Future] = []  # Resolved by the next sample
+        self.start_step(target, tolerance)
+
+    # ========================================================================
+    # Stream Attachment
+    # ========================================================================
+
+    def attach(self, transport: Any) -> Callable[[LMAFrame], None]:
+        """
+        Register on_frame() as a listener of an LMATransport
+
+        Returns:
+            The registered listener (for transport.remove_listener)
+        """
+        transport.add_listener(self.on_frame)
+        return self.on_frame
+
+    def on_frame(self, frame: LMAFrame) -> None:
+        """Record the IR temperature of a temperature response frame (no fit)"""
+        if frame.status == STATUS_TEMP_RESPONSE and len(frame.data) >= 8:
+            ir_temp, _ = parse_temperature(frame)
+            self.add_sample(frame.timestamp, ir_temp)
+
+    def start_step(self, target: float, tolerance: Optional[float] = None) -> None:
+        """Begin a new step (history before the set-point change is discarded)"""
+        with self._fit_lock, self._lock:
+            self._target = target
+            if tolerance is not None:
+                self._tolerance = tolerance
+            self._samples.clear()
+            self._fitted = True
+            self._estimate: Optional[ThermalEstimate] = None
+            self._settled: Optional[ThermalEstimate] = None
+
+    # ========================================================================
+    # Online Fit
+    # ========================================================================
+
+    def add_sample(self, timestamp: float, temperature: float) -> None:
+        """Append one sample without fitting (safe on the serial reactor thread)"""
+        with self._lock:
+            samples = self._samples
+            samples.append((timestamp, temperature))
+            while samples and samples[0][0] < timestamp - self._window:
+                samples.popleft()
+            self._fitted = False
+            waiters, self._waiters = self._waiters, []
+
+        for future in waiters:
+            if future.set_running_or_notify_cancel():
+                future.set_result(None)
+
+    def update(self, timestamp: float, temperature: float) -> Optional[ThermalEstimate]:
+        """Add one sample and refit in the calling thread"""
+        self.add_sample(timestamp, temperature)
+        return self.refit()
+
+    def refit(self) -> Optional[ThermalEstimate]:
+        """Fit the samples added since the last fit (blocking; keep off the reactor)"""
+        with self._fit_lock:
+            with self._lock:
+                if self._fitted:
+                    return self._estimate
+                data = np.array(self._samples, dtype=np.float64)
+                self._fitted = True
+
+            estimate = self._fit(data)
+            with self._lock:
+                self._estimate = estimate
+                if estimate is not None and estimate.settled and self._settled is None:
+                    self._settled = estimate
+            return estimate
+
+    def _fit(self, data: np.ndarray) -> Optional[ThermalEstimate]:
+        count = len(data)
+        params = self._order + 1
+        if count <= params + self._order:
+            return None
+
+        t = data[:, 0] - data[0, 0]
+        y = data[:, 1]
+
+        # Coarse grid, then a finer grid around the best candidate
+        coef, inverse, sse = self._solve(self._tau_sets, t, y)
+        best = int(np.argmin(sse))
+        tau_sets = self._tau_sets[best] * self._refine_factors
+        coef, inverse, sse = self._solve(tau_sets, t, y)
+        best = int(np.argmin(sse))
+        taus = tau_sets[best]
+        c = coef[best]
+        dof = max(count - params - self._order, 1)  # Taus are fitted parameters too
+        variance = sse[best] / dof
+        stderr = float(np.sqrt(max(variance * inverse[best, 0, 0], 0.0)))
+
+        # Model forward from the latest sample
+        horizon = THERMAL_HORIZON_TAUS * float(taus.max())
+        future_t = t[-1] + np.linspace(0.0, horizon, THERMAL_HORIZON_STEPS)
+        model = c[0] + (c[1:, None] * np.exp(-future_t[None, :] / taus[:, None])).sum(axis=0)
+        margin = self._confidence_z * stderr
+        inside = np.abs(model - self._target) + margin <= self._tolerance
+
+        if not inside[-1]:
+            time_to_band = None
+        else:
+            outside = np.flatnonzero(~inside)
+            time_to_band = 0.0 if len(outside) == 0 else float(future_t[outside[-1] + 1] - t[-1])
+
+        settled = bool(
+            count >= self._min_samples
+            and time_to_band == 0.0
+            and abs(y[-1] - self._target) <= self._tolerance
+        )
+        return ThermalEstimate(
+            final_temperature=float(c[0]),
+            final_stderr=stderr,
+            time_constants=tuple(float(tau) for tau in taus),
+            residual_std=float(np.sqrt(variance)),
+            time_to_band=time_to_band,
+            settled=settled,
+            samples=count,
+            timestamp=float(data[-1, 0]),
+        )
+
+    @staticmethod
+    def _solve(
+        tau_sets: np.ndarray, t: np.ndarray, y: np.ndarray
+    ) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+        """Least squares for every tau candidate at once: (coef, inverse, sse)"""
+        # Design matrices: (G, params, N)
+        basis = np.exp(-t[None, None, :] / tau_sets[:, :, None])
+        design = np.concatenate([np.ones((len(tau_sets), 1, len(t))), basis], axis=1)
+        normal = design @ design.transpose(0, 2, 1)
+        inverse = np.linalg.pinv(normal)  # Tolerates collinear long-tau candidates
+        coef = np.einsum("gij,gj->gi", inverse, design @ y)
+        residuals = y[None, :] - np.einsum("gi,gin->gn", coef, design)
+        return coef, inverse, np.einsum("gn,gn->g", residuals, residuals)
+
+    # ========================================================================
+    # Results
+    # ========================================================================
+
+    def estimate(self) -> Optional[ThermalEstimate]:
+        """Fit at the latest sample (None until enough samples)"""
+        return self._estimate
+
+    @property
+    def is_settled(self) -> bool:
+        """True once the fit has declared settled for the current step"""
+        return self._settled is not None
+
+    @property
+    def settled_at(self) -> Optional[float]:
+        """Timestamp of the sample that settled the current step"""
+        return None if self._settled is None else self._settled.timestamp
+
+    async def wait_settled(self, timeout: float) -> Optional[ThermalEstimate]:
+        """
+        Wait until the current step settles, fitting new samples in a worker thread
+
+        Samples that arrive during a fit are taken together by the next one.
+
+        Returns:
+            The settling estimate, or None on timeout
+        """
+        loop = asyncio.get_running_loop()
+        deadline = loop.time() + timeout
+        while self._settled is None:
+            arrived: Future = Future()
+            with self._lock:
+                pending = not self._fitted
+                if not pending:
+                    alive = [item for item in self._waiters if not item.cancelled()]
+                    self._waiters = alive + [arrived]
+            if pending:
+                await asyncio.to_thread(self.refit)
+                if self._settled is None and loop.time() >= deadline:
+                    return None
+                continue
+            try:
+                await asyncio.wait_for(asyncio.wrap_future(arrived), deadline - loop.time())
+            except asyncio.TimeoutError:
+                return None  # wait_for cancelled the wrapped future
+        return self._settled
@@ -0,0 +1,331 @@
+"""
+LMA MCU Event-Driven Transport
+
+Receives through the shared SerialReactor instead of polling in_waiting
+with sleeps: the port is registered with LMAFrameScanner as its framing
+plugin, so the reactor's select() loop (POSIX) or per-port reader thread
+(Windows) delivers complete frames. Received bytes are scanned for frames
+(STX FFFF + CMD + LEN + DATA + ETX FEFE): candidate STX positions of a
+whole read are found in one vectorized numpy pass, and each candidate is
+accepted only when its length byte is within MAX_DATA_SIZE and the ETX
+sits exactly where the length says. The protocol has no checksum,
+so length + ETX is the full frame validation.
+
+Complete frames are matched to waiters by status code - the MCU answers
+command N with status N - or kept in a bounded event queue for a later
+waiter. Temperature frames additionally update the latest temperature, and
+listeners see every frame, so status and temperature frames arrive without
+any polling delay.
+"""
+
+# Standard library imports
+from collections import deque
+from concurrent.futures import Future, TimeoutError as FutureTimeoutError
+import struct
+import threading
+from typing import Any, Callable, Deque, Dict, List, NamedTuple, Optional, Tuple
+
+# Third-party imports
+import asyncio
+from loguru import logger
+import numpy as np
+
+# Local application imports
+from driver.serial.reactor import ReactorFrame, SerialReactor, get_shared_reactor
+from infrastructure.implementation.hardware.mcu.lma.constants import (
+    ETX,
+    FRAME_ETX_SIZE,
+    FRAME_OVERHEAD,
+    MAX_DATA_SIZE,
+    STATUS_TEMP_RESPONSE,
+    STX,
+    TEMP_SCALE_FACTOR,
+    TRANSPORT_EVENT_CAPACITY,
+)
+
+_STX_BYTE = STX[0]
+_HEADER_SIZE = 4  # STX(2) + CMD(1) + LEN(1)
+
+
+class LMAFrame(NamedTuple):
+    """One received frame"""
+
+    status: int  # CMD byte (status code)
+    raw: bytes  # Complete frame including STX/ETX
+    timestamp: float  # time.monotonic() of the read that completed it
+
+    @property
+    def data(self) -> memoryview:
+        """Payload view into raw (no copy)"""
+        return memoryview(self.raw)[_HEADER_SIZE : len(self.raw) - FRAME_ETX_SIZE]
+
+
+def encode_frame(cmd: int, data: bytes = b"") -> bytes:
+    """Build a frame: STX + CMD + LEN + DATA + ETX"""
+    if len(data) > MAX_DATA_SIZE:
+        raise ValueError(f"Frame data too long: {len(data)} > {MAX_DATA_SIZE} bytes")
+    return STX + bytes([cmd, len(data)]) + data + ETX
+
+
+def parse_temperature(frame: LMAFrame) -> Tuple[float, float]:
+    """(ir_temp, outside_temp) in Celsius from a temperature response frame"""
+    ir_scaled, outside_scaled = struct.unpack(">II", frame.data[:8])
+    return ir_scaled / TEMP_SCALE_FACTOR, outside_scaled / TEMP_SCALE_FACTOR
+
+
+class LMAFrameScanner:
+    """LMA MCU 프레임 증분 스캐너 (STX 후보 벡터 탐색)"""
+
+    def __init__(self):
+        """초기화"""
+        self._buffer = bytearray()
+        self.frames = 0
+        self.errors = 0  # STX candidates rejected by length or ETX
+        self.discarded = 0  # Bytes dropped as noise
+
+    def feed(self, data: bytes) -> List[bytes]:
+        """
+        Append received bytes and extract every complete frame
+
+        Returns:
+            Complete frames in arrival order; incomplete trailing bytes are kept
+        """
+        buffer = self._buffer
+        buffer += data
+        size = len(buffer)
+        if size < FRAME_OVERHEAD:
+            return []
+
+        view = np.frombuffer(buffer, dtype=np.uint8)
+        candidates = np.flatnonzero((view[:-1] == _STX_BYTE) & (view[1:] == _STX_BYTE)).tolist()
+        del view  # Release the buffer export before the buffer is resized
+
+        frames: List[bytes] = []
+        consumed = 0  # End of the last extracted frame
+        pending: Optional[int] = None  # First candidate still waiting for bytes
+        for start in candidates:
+            if start < consumed:
+                continue  # FFFF inside the payload of an extracted frame
+            if start + _HEADER_SIZE > size:
+                pending = start if pending is None else pending
+                break
+            length = buffer[start + 3]
+            if length > MAX_DATA_SIZE:
+                self.errors += 1
+                continue
+            end = start + _HEADER_SIZE + length + FRAME_ETX_SIZE
+            if end > size:
+                pending = start if pending is None else pending
+                continue
+            if buffer[end - FRAME_ETX_SIZE : end] != ETX:
+                self.errors += 1
+                continue
+            frames.append(bytes(buffer[start:end]))
+            consumed = end
+            pending = None  # An earlier incomplete candidate was noise
+
+        if pending is not None:
+            cut = pending
+        elif buffer[-1] == _STX_BYTE:
+            cut = max(consumed, size - 1)  # Possible first STX byte
+        else:
+            cut = size
+        self.discarded += cut - sum(len(frame) for frame in frames)
+        self.frames += len(frames)
+        del buffer[:cut]
+        return frames
+
+
+class LMATransport:
+    """LMA MCU 이벤트 기반 송수신 (시리얼 리액터 + 상태 코드별 응답 매칭)"""
+
+    def __init__(
+        self,
+        port: Any,
+        event_capacity: int = TRANSPORT_EVENT_CAPACITY,
+        reactor: Optional[SerialReactor] = None,
+    ):
+        """
+        초기화
+
+        Args:
+            port: Open pyserial-like port (read, write, in_waiting, timeout)
+            event_capacity: Unclaimed frames kept for later waiters
+            reactor: Serial reactor receiving the port (defaults to the shared reactor)
+        """
+        self._port = port
+        self._reactor = reactor
+        self._name = f"LMA-MCU:{getattr(port, 'port', None) or hex(id(port))}"
+        self._scanner = LMAFrameScanner()
+        self._lock = threading.Lock()
+        self._waiters: Dict[Optional[int], Deque[Future]] = {}
+        self._events: Deque[LMAFrame] = deque(maxlen=event_capacity)
+        self._listeners: List[Callable[[LMAFrame], None]] = []
+        self._temperature: Optional[Tuple[float, float, float]] = None
+
+        self._saved_timeout: Optional[float] = None
+        self._read_errors = 0
+        self._running = False
+
+    # ========================================================================
+    # Reactor Registration
+    # ========================================================================
+
+    def start(self) -> None:
+        """Register the port with the reactor (the port timeout is changed meanwhile)"""
+        if self._running:
+            return
+        if self._reactor is None:
+            self._reactor = get_shared_reactor()
+        self._saved_timeout = self._port.timeout
+        self._reactor.add_port(self._name, self._port, self._scanner, listener=self._on_frame)
+        self._running = True
+        logger.info(f"LMA MCU transport started ({self._name})")
+
+    def stop(self) -> None:
+        """Remove the port from the reactor, fail pending waiters and restore the port timeout"""
+        if self._running:
+            self._running = False
+            stats = self._reactor.get_statistics().get(self._name)
+            if stats is not None:
+                self._read_errors += stats["read_errors"]
+            self._reactor.remove_port(self._name)
+        if self._saved_timeout is not None:
+            self._port.timeout = self._saved_timeout
+            self._saved_timeout = None
+
+        with self._lock:
+            waiters = [future for queue in self._waiters.values() for future in queue]
+            self._waiters.clear()
+        for future in waiters:
+            future.cancel()
+        logger.info("LMA MCU transport stopped")
+
+    @property
+    def is_running(self) -> bool:
+        return self._running
+
+    def _on_frame(self, frame: ReactorFrame) -> None:
+        raw = frame.data
+        self._dispatch(LMAFrame(raw[2], raw, frame.timestamp))
+
+    def _dispatch(self, frame: LMAFrame) -> None:
+        if frame.status == STATUS_TEMP_RESPONSE and len(frame.data) >= 8:
+            ir_temp, outside_temp = parse_temperature(frame)
+            self._temperature = (frame.timestamp, ir_temp, outside_temp)
+
+        with self._lock:
+            future = self._pop_waiter(frame.status) or self._pop_waiter(None)
+            if future is None:
+                self._events.append(frame)
+        if future is not None:
+            future.set_result(frame)
+
+        for listener in self._listeners:
+            try:
+                listener(frame)
+            except Exception as e:
+                logger.warning(f"LMA MCU frame listener failed: {e}")
+
+    def _pop_waiter(self, status: Optional[int]) -> Optional[Future]:
+        queue = self._waiters.get(status)
+        while queue:
+            future = queue.popleft()
+            if future.set_running_or_notify_cancel():
+                return future
+        return None
+
+    # ========================================================================
+    # Requests and Waits
+    # ========================================================================
+
+    def send(self, packet: bytes) -> None:
+        """Write a complete frame (serialized with other writers by the reactor)"""
+        if self._running:
+            self._reactor.send(self._name, packet)
+        else:
+            self._port.write(packet)
+
+    def expect(self, status: Optional[int], discard_buffered: bool = False) -> Future:
+        """
+        Future resolved with the next frame of a status (None = any status)
+
+        A matching frame already in the event queue resolves it immediately
+        unless discard_buffered drops such stale frames first.
+        """
+        future: Future = Future()
+        with self._lock:
+            for frame in list(self._events):
+                if status is None or frame.status == status:
+                    self._events.remove(frame)
+                    if not discard_buffered:
+                        future.set_running_or_notify_cancel()
+                        future.set_result(frame)
+                        return future
+            self._waiters.setdefault(status, deque()).append(future)
+        return future
+
+    def request(self, packet: bytes, timeout: float) -> Optional[LMAFrame]:
+        """Send a frame and wait for the response with the same status code"""
+        future = self.expect(packet[2], discard_buffered=True)
+        self.send(packet)
+        return self._result(future, timeout)
+
+    async def request_async(self, packet: bytes, timeout: float) -> Optional[LMAFrame]:
+        """request() for coroutines (the event loop is not blocked)"""
+        future = self.expect(packet[2], discard_buffered=True)
+        self.send(packet)
+        return await self._result_async(future, timeout)
+
+    def wait_for(self, status: Optional[int], timeout: float) -> Optional[LMAFrame]:
+        """Next frame of a status (buffered or arriving within timeout)"""
+        return self._result(self.expect(status), timeout)
+
+    async def wait_for_async(self, status: Optional[int], timeout: float) -> Optional[LMAFrame]:
+        """wait_for() for coroutines"""
+        return await self._result_async(self.expect(status), timeout)
+
+    def _result(self, future: Future, timeout: float) -> Optional[LMAFrame]:
+        try:
+            return future.result(timeout)
+        except FutureTimeoutError:
+            future.cancel()
+            return None
+
+    async def _result_async(self, future: Future, timeout: float) -> Optional[LMAFrame]:
+        try:
+            return await asyncio.wait_for(asyncio.wrap_future(future), timeout)
+        except asyncio.TimeoutError:
+            return None  # wait_for cancelled the wrapped future
+
+    # ========================================================================
+    # Listeners and Status
+    # ========================================================================
+
+    def add_listener(self, listener: Callable[[LMAFrame], None]) -> None:
+        """Call listener(frame) from the reactor for every frame"""
+        self._listeners = self._listeners + [listener]
+
+    def remove_listener(self, listener: Callable[[LMAFrame], None]) -> None:
+        self._listeners = [item for item in self._listeners if item != listener]
+
+    def latest_temperature(self) -> Optional[Tuple[float, float, float]]:
+        """(timestamp, ir_temp, outside_temp) of the newest temperature frame"""
+        return self._temperature
+
+    def get_statistics(self) -> Dict[str, Any]:
+        """Frame, scanner and error counters"""
+        with self._lock:
+            waiting = sum(len(queue) for queue in self._waiters.values())
+            buffered = len(self._events)
+        read_errors = self._read_errors
+        if self._running:
+            read_errors += self._reactor.get_statistics().get(self._name, {}).get("read_errors", 0)
+        return {
+            "frames": self._scanner.frames,
+            "frame_errors": self._scanner.errors,
+            "discarded_bytes": self._scanner.discarded,
+            "buffered_events": buffered,
+            "waiters": waiting,
+            "read_errors": read_errors,
+        }
@@ -9,7 +9,75 @@ try:
     from infrastructure.implementation.hardware.robot.ajinextek.ajinextek_robot import (
         AjinextekRobot,
     )
+    from infrastructure.implementation.hardware.robot.ajinextek.analog_output import (
+        AnalogOutputRamp,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.axl_bringup import (
+        AXLBringup,
+        BringupReport,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.axl_config_snapshot import (
+        AxisConfigSnapshot,
+        capture_snapshot,
+        diff_snapshots,
+        restore_snapshot,
+    )
     from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+    from infrastructure.implementation.hardware.robot.ajinextek.board_locks import (
+        BoardTopology,
+        ShardedAXL,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.cycle_trace import (
+        CycleTimeline,
+        TracingAXL,
+        WhatIf,
+        build_timeline,
+        load_trace,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.drive_monitor import (
+        DriveMonitorDrain,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.flash_store import (
+        BoardFlashStore,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.force_estimator import (
+        ForceEstimate,
+        ForceModel,
+        SensorlessForceEstimator,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.interlock import (
+        InterlockEngine,
+        InterlockRule,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.io_latency_probe import (
+        IOPoint,
+        LatencyHistogram,
+        LoopbackProbe,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.measurement_order import (
+        MeasurementPlan,
+        plan_measurements,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.multi_axis_jog import (
+        MultiAxisJogController,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.position_sampler import (
+        PositionSampler,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.process_image import (
+        ProcessImage,
+        ProcessImageScanner,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.recipe_plan import (
+        CompiledPlan,
+        RecipePlanCache,
+        compile_plan,
+        upload_plan,
+    )
+    from infrastructure.implementation.hardware.robot.ajinextek.sampling_scheduler import (
+        AxisOdometer,
+        SamplingScheduler,
+    )
     from infrastructure.implementation.hardware.robot.ajinextek.constants import (
         DLL_PATH,
         SERVO_OFF,
@@ -46,4 +114,45 @@ except ImportError as e:
 __all__ = []
 
 if _AJINEXTEK_AVAILABLE:
-    __all__.extend(["AjinextekRobot", "AXLWrapper"])
+    __all__.extend(
+        [
+            "AjinextekRobot",
+            "AnalogOutputRamp",
+            "AxisConfigSnapshot",
+            "AxisOdometer",
+            "AXLBringup",
+            "AXLWrapper",
+            "BoardFlashStore",
+            "BoardTopology",
+            "BringupReport",
+            "build_timeline",
+            "capture_snapshot",
+            "CompiledPlan",
+            "compile_plan",
+            "CycleTimeline",
+            "diff_snapshots",
+            "DriveMonitorDrain",
+            "ForceEstimate",
+            "ForceModel",
+            "InterlockEngine",
+            "InterlockRule",
+            "load_trace",
+            "IOPoint",
+            "LatencyHistogram",
+            "LoopbackProbe",
+            "MeasurementPlan",
+            "MultiAxisJogController",
+            "ProcessImage",
+            "plan_measurements",
+            "PositionSampler",
+            "ProcessImageScanner",
+            "RecipePlanCache",
+            "restore_snapshot",
+            "SamplingScheduler",
+            "SensorlessForceEstimator",
+            "ShardedAXL",
+            "TracingAXL",
+            "upload_plan",
+            "WhatIf",
+        ]
+    )
@@ -6,9 +6,8 @@ Implements the RobotService interface using AXL library.
 """
 
 # Standard library imports
-from pathlib import Path
 import time
-from typing import Any, Dict
+from typing import Any, Dict, Optional, Set, Tuple
 
 # Third-party imports
 import asyncio
@@ -25,9 +24,18 @@ from domain.exceptions.hardware_exceptions import (
     HardwareException,
 )
 from domain.exceptions.robot_exceptions import (
+    AXLError,
     RobotConnectionError,
     RobotMotionError,
 )
+from infrastructure.implementation.hardware.robot.ajinextek.axl_bringup import (
+    AXLBringup,
+    default_motion_settings_file,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_config_snapshot import (
+    AxisConfigSnapshot,
+    capture_snapshot,
+)
 from infrastructure.implementation.hardware.robot.ajinextek.constants import (
     HOME_ERR_AMP_FAULT,
     HOME_ERR_GNT_RANGE,
@@ -86,6 +94,11 @@ class AjinextekRobot(RobotService):
         )
 
         self._axl = AXLWrapper.get_instance()
+        self._bringup = AXLBringup.get_instance()
+
+        # Axis configuration captured on demand (see get_config_snapshot)
+        self._config_snapshot: Optional[AxisConfigSnapshot] = None
+        self._unsupported_config: Set[Tuple[int, str]] = set()
 
         logger.info("AjinextekRobotAdapter initialized")
 
@@ -114,46 +127,38 @@ class AjinextekRobot(RobotService):
             #         details=f"DLL path: {dll_info['dll_path']}, Available DLLs: {dll_info['available_dlls']}",
             #     )
 
-            # 중앙화된 연결 관리 사용 (서비스 이름으로 추적)
-            self._axl.connect(self._irq_no, service_name=self.SERVICE_NAME)
-
-            # Get board count for verification (with error handling)
+            # Wait for the background bring-up (open, topology, .mot parameters, servo check)
+            # without blocking the event loop, so other instruments connect meanwhile
             try:
-                board_count = self._axl.get_board_count()
-                logger.info(f"Board count detected: {board_count}")
-            except Exception as e:
-                logger.warning(f"Could not get board count: {e} (continuing anyway)")
-                board_count = 0  # Default value
+                report = await asyncio.wrap_future(
+                    self._bringup.start(self._irq_no, default_motion_settings_file())
+                )
+            except AXLError as e:
+                raise RobotConnectionError(
+                    f"AXL bring-up failed: {e}",
+                    "AJINEXTEK",
+                    details=f"Stage timings: {self._bringup.get_timings()}",
+                ) from e
 
-            # Get axis count from hardware (with error handling)
-            try:
-                self._axis_count = self._axl.get_axis_count()
-                logger.info(f"Detected axis count: {self._axis_count}")
-            except Exception as e:
-                logger.warning(f"Could not get axis count: {e} (using default: 1)")
-                self._axis_count = 1  # Default to single axis
+            # 중앙화된 연결 관리 사용 (서비스 이름으로 추적) - library is already open here
+            self._axl.connect(self._irq_no, service_name=self.SERVICE_NAME)
 
-            # Get library version for info
-            try:
-                self.version = self._axl.get_lib_version()
-                logger.info(f"AXL Library version: {self.version}")
-            except Exception:
-                pass  # Library version is not critical
+            self._axis_count = report.axis_count
+            self.version = report.version
+            logger.info(
+                f"AXL bring-up report: {report.board_count} board(s), {report.axis_count} axes, "
+                f"{report.open_attempts} open attempt(s), timings {report.timings}"
+            )
+            if self._axis_id in report.alarmed_axes:
+                logger.warning(f"Servo alarm active on axis {self._axis_id} after bring-up")
 
             # Initialize position tracking and servo state for single axis
             self._current_position = 0.0
             self._servo_state = False
 
-            # Software limits are now managed by robot controller via .mot file
-
-            # Load robot parameters from configuration file for this axis
-            await self._load_robot_parameters(self._axis_id)
-
-            # Motion parameters are now loaded from .prm file via AxmMotLoadParaAll
-            logger.info("Motion parameters initialized from .prm file")
-
             self._is_connected = True
             self._motion_status = MotionStatus.IDLE
+            self._unsupported_config.clear()
 
             logger.info(
                 f"AJINEXTEK robot controller connected successfully (IRQ: {self._irq_no}, Axis: {self._axis_id}, Total Axes: {self._axis_count})"
@@ -187,6 +192,9 @@ class AjinextekRobot(RobotService):
                     # 중앙화된 연결 해제 사용 (서비스 이름으로 추적)
                     self._axl.disconnect(service_name=self.SERVICE_NAME)
                     logger.debug("Ajinextek robot AXL disconnect completed")
+                    # Next connect() reloads the .mot parameters even if another
+                    # service keeps the library open
+                    self._bringup.invalidate()
                 except Exception as axl_error:
                     disconnect_error = axl_error
                     logger.warning(f"Error during Ajinextek robot AXL disconnect: {axl_error}")
@@ -201,6 +209,7 @@ class AjinextekRobot(RobotService):
             self._is_connected = False
             self._servo_state = False
             self._motion_status = MotionStatus.IDLE
+            self._config_snapshot = None
 
             if disconnect_error:
                 logger.warning(f"Ajinextek robot disconnected with errors: {disconnect_error}")
@@ -749,6 +758,9 @@ class AjinextekRobot(RobotService):
             status["axis_count"] = self._axis_count
             status["version"] = self.version
 
+            if self._config_snapshot is not None:
+                status["config_hash"] = self._config_snapshot.short_hash
+
             # Check actual hardware motion status
             try:
                 is_moving = await self.is_moving(axis_id)
@@ -770,6 +782,31 @@ class AjinextekRobot(RobotService):
 
         return status
 
+    async def get_config_snapshot(self, refresh: bool = False) -> AxisConfigSnapshot:
+        """
+        Configuration of all axes
+
+        Captured on the first call after connect and cached; get_status()
+        reports the cached hash without touching the driver. Getters the
+        hardware does not support are remembered and not called again until
+        the next connect.
+
+        Args:
+            refresh: Capture again (after changing axis parameters)
+
+        Returns:
+            Axis configuration snapshot (use .hash / .to_bytes() for records)
+
+        Raises:
+            RobotConnectionError: If robot is not connected
+        """
+        self._ensure_connected()
+        if refresh or self._config_snapshot is None:
+            self._config_snapshot = capture_snapshot(
+                self._axl, unsupported=self._unsupported_config
+            )
+        return self._config_snapshot
+
     async def get_load_ratio(self, axis: int, ratio_type: int = 0) -> float:
         """
         Get servo load ratio
@@ -881,13 +918,6 @@ class AjinextekRobot(RobotService):
                 "AJINEXTEK",
             )
 
-    # Legacy method kept for compatibility
-    async def _initialize_axl_library(self, irq_no: int, max_retries: int = 3) -> int:
-        """Initialize AXL library with retry logic (legacy compatibility method)"""
-        if self._axl.is_opened():
-            return AXT_RT_SUCCESS
-        return self._axl.open(irq_no)
-
     def _ensure_servo_enabled(self) -> None:
         """Ensure servo is enabled before motion operations"""
         if not self._servo_state:
@@ -1232,61 +1262,3 @@ class AjinextekRobot(RobotService):
             f"Timeout waiting for axis {axis} to stop after {timeout} seconds",
             "AJINEXTEK",
         )
-
-    async def _load_robot_parameters(self, axis_id: int) -> None:
-        """
-        Load robot parameters from AJINEXTEK standard parameter file using AxmMotLoadPara
-
-        Args:
-            axis_id: Axis number to load parameters for (this robot's assigned axis)
-
-        Raises:
-            RobotConnectionError: If parameter loading fails
-        """
-        try:
-            # Use absolute path to ensure file is found regardless of working directory
-            project_root = Path(__file__).parent.parent.parent.parent.parent.parent.parent
-            robot_motion_settings_file = (
-                project_root / "configuration" / "robot_motion_settings.mot"
-            )
-
-            if not robot_motion_settings_file.exists():
-                logger.error(f"Robot motion settings file not found: {robot_motion_settings_file}")
-                raise RobotConnectionError(
-                    f"Required robot motion settings file not found: {robot_motion_settings_file}",
-                    "AJINEXTEK",
-                    details=f"Motion settings file path: {robot_motion_settings_file}",
-                )
-
-            logger.info(
-                f"Loading robot motion settings from {robot_motion_settings_file} using AxmMotLoadParaAll"
-            )
-
-            # Load parameters for all axes using AJINEXTEK standard function
-            result = self._axl.load_para_all(str(robot_motion_settings_file))
-
-            if result != AXT_RT_SUCCESS:
-                error_msg = get_error_message(result)
-                logger.error(
-                    f"Failed to load motion settings from {robot_motion_settings_file}: {error_msg}"
-                )
-                raise RobotConnectionError(
-                    f"AxmMotLoadParaAll failed: {error_msg}",
-                    "AJINEXTEK",
-                    details=f"File: {robot_motion_settings_file}, Error: {result}",
-                )
-
-            logger.info(
-                f"Robot motion settings loaded successfully from {robot_motion_settings_file} for all axes"
-            )
-
-        except RobotConnectionError:
-            # Re-raise connection errors to preserve error context
-            raise
-        except Exception as e:
-            logger.error(f"Failed to load robot parameters: {e}")
-            raise RobotConnectionError(
-                f"Robot parameters loading failed: {e}",
-                "AJINEXTEK",
-                details=str(e),
-            ) from e
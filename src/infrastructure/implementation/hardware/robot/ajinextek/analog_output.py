@@ -0,0 +1,408 @@
+"""
+AJINEXTEK Analog Output Ramp Service
+
+Drives groups of analog output channels with per-channel slew-rate limiting.
+Setpoint changes only update targets; a timer thread advances every moving
+channel towards its target and writes all of them with a single
+AxaoWriteMultiVoltage call per tick, so many outputs ramp smoothly at once
+without one Python-timed driver call per channel and step.
+
+Output voltages are read back periodically with AxaoReadMultiVoltage, again
+one call for all configured channels.
+"""
+
+# Standard library imports
+from ctypes import c_double, c_long, wintypes
+from dataclasses import dataclass
+import threading
+import time
+from typing import Any, Dict, List, Mapping, Optional
+
+# Third-party imports
+from loguru import logger
+
+# Local application imports
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    AO_DEFAULT_READBACK_EVERY,
+    AO_DEFAULT_TICK_PERIOD,
+    AO_MAX_VOLT,
+    AO_MIN_VOLT,
+)
+
+
+@dataclass
+class _Channel:
+    """Per-channel ramp state"""
+
+    channel: int
+    current: float
+    target: float
+    slew_rate: Optional[float]  # V/s, None = step directly to the target
+    min_volt: float
+    max_volt: float
+    ramp_rate: Optional[float] = None  # Rate of an active ramp_to(), overrides slew_rate
+    readback: Optional[float] = None
+
+    @property
+    def settled(self) -> bool:
+        return self.current == self.target
+
+    def next_value(self, dt: float) -> float:
+        rate = self.ramp_rate if self.ramp_rate is not None else self.slew_rate
+        if rate is None:
+            return self.target
+        step = rate * dt
+        delta = self.target - self.current
+        if abs(delta) <= step:
+            return self.target
+        return self.current + (step if delta > 0 else -step)
+
+
+class AnalogOutputRamp:
+    """아날로그 출력 램프(slew-rate 제한) 서비스"""
+
+    def __init__(
+        self,
+        axl: Optional[Any] = None,
+        tick_period: float = AO_DEFAULT_TICK_PERIOD,
+        readback_every: int = AO_DEFAULT_READBACK_EVERY,
+    ):
+        """
+        초기화
+
+        Args:
+            axl: AXLWrapper instance (defaults to the process-wide singleton)
+            tick_period: Ramp timer period in seconds
+            readback_every: Read back all channels every N ticks (0 = never)
+        """
+        if axl is None:
+            # Local application imports
+            from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import (
+                AXLWrapper,
+            )
+
+            axl = AXLWrapper.get_instance()
+
+        self._axl = axl
+        self._tick_period = tick_period
+        self._readback_every = readback_every
+
+        self._channels: Dict[int, _Channel] = {}
+        self._lock = threading.Lock()
+        self._settled = threading.Condition(self._lock)
+
+        # Reused driver buffers, sized to the configured channel count
+        self._channel_buf: Any = (c_long * 0)()
+        self._volt_buf: Any = (c_double * 0)()
+        self._readback_channels: Any = (c_long * 0)()
+        self._readback_buf: Any = (c_double * 0)()
+
+        self._ticks = 0
+        self._writes = 0
+        self._readbacks = 0
+        self._errors = 0
+        self._last_tick: Optional[float] = None
+
+        self._stop_event = threading.Event()
+        self._thread: Optional[threading.Thread] = None
+
+    # ========================================================================
+    # Configuration
+    # ========================================================================
+
+    def configure_channel(
+        self,
+        channel: int,
+        slew_rate: Optional[float] = None,
+        min_volt: float = AO_MIN_VOLT,
+        max_volt: float = AO_MAX_VOLT,
+    ) -> None:
+        """
+        Add (or reconfigure) an output channel
+
+        The channel starts from its current output voltage, so configuring
+        does not cause a jump.
+
+        Args:
+            channel: Analog output channel number
+            slew_rate: Maximum rate of change in V/s (None = no limit)
+            min_volt: Lowest voltage a target may request
+            max_volt: Highest voltage a target may request
+
+        Raises:
+            ValueError: If the rate or limits are invalid
+            AXLError: If the current output cannot be read
+        """
+        if slew_rate is not None and slew_rate <= 0:
+            raise ValueError("Slew rate must be positive")
+        if min_volt >= max_volt:
+            raise ValueError("min_volt must be below max_volt")
+
+        channels = (c_long * 1)(channel)
+        volts = (c_double * 1)()
+        self._axl.ao_read_multi_voltage(channels, volts, 1)
+        current = min(max(volts[0], min_volt), max_volt)
+
+        with self._lock:
+            self._channels[channel] = _Channel(
+                channel=channel,
+                current=current,
+                target=current,
+                slew_rate=slew_rate,
+                min_volt=min_volt,
+                max_volt=max_volt,
+                readback=volts[0],
+            )
+            self._resize_buffers()
+        logger.info(
+            f"Analog output channel {channel} configured "
+            f"(slew: {slew_rate if slew_rate is not None else 'unlimited'} V/s, "
+            f"range: {min_volt}..{max_volt} V, current: {current:.3f} V)"
+        )
+
+    def remove_channel(self, channel: int) -> None:
+        """Stop ramping a channel (its output keeps the last written voltage)"""
+        with self._lock:
+            if self._channels.pop(channel, None) is not None:
+                self._resize_buffers()
+                self._settled.notify_all()
+
+    def _resize_buffers(self) -> None:
+        count = len(self._channels)
+        self._channel_buf = (c_long * count)()
+        self._volt_buf = (c_double * count)()
+        self._readback_channels = (c_long * count)(*sorted(self._channels))
+        self._readback_buf = (c_double * count)()
+
+    # ========================================================================
+    # Setpoints
+    # ========================================================================
+
+    def set_target(self, channel: int, volts: float) -> None:
+        """Ramp one channel to a voltage at its slew rate"""
+        self.set_targets({channel: volts})
+
+    def set_targets(self, targets: Mapping[int, float]) -> None:
+        """
+        Ramp several channels at their own slew rates
+
+        Raises:
+            KeyError: If a channel is not configured
+        """
+        with self._lock:
+            for channel, volts in targets.items():
+                state = self._channels[channel]
+                state.target = self._clamp(state, volts)
+                state.ramp_rate = None
+
+    def ramp_to(self, targets: Mapping[int, float], duration: float) -> None:
+        """
+        Ramp several channels so they all arrive together after duration seconds
+
+        A channel's slew rate still caps the ramp, so a channel whose step
+        cannot be covered in time arrives late.
+
+        Raises:
+            ValueError: If duration is not positive
+            KeyError: If a channel is not configured
+        """
+        if duration <= 0:
+            raise ValueError("Ramp duration must be positive")
+        with self._lock:
+            for channel, volts in targets.items():
+                state = self._channels[channel]
+                state.target = self._clamp(state, volts)
+                rate = abs(state.target - state.current) / duration
+                if state.slew_rate is not None:
+                    rate = min(rate, state.slew_rate)
+                state.ramp_rate = rate if rate > 0 else None
+
+    def write_now(self, values: Mapping[int, float]) -> None:
+        """
+        Step several channels immediately with one AxaoWriteMultiVoltage call
+
+        Raises:
+            KeyError: If a channel is not configured
+            AXLError: If the driver rejects the write
+        """
+        with self._lock:
+            states = [self._channels[channel] for channel in values]
+            count = len(states)
+            for i, state in enumerate(states):
+                self._channel_buf[i] = state.channel
+                self._volt_buf[i] = self._clamp(state, values[state.channel])
+            self._axl.ao_write_multi_voltage(self._channel_buf, self._volt_buf, count)
+            self._writes += 1
+            for i, state in enumerate(states):
+                state.current = state.target = self._volt_buf[i]
+                state.ramp_rate = None
+            self._settled.notify_all()
+
+    def write_digits(self, digits: Mapping[int, int]) -> None:
+        """
+        Write raw DAC codes with one AxaoWriteMultiDigit call
+
+        The resulting voltages are read back and become the channels' new
+        current value and target.
+
+        Raises:
+            KeyError: If a channel is not configured
+            AXLError: If the driver rejects the write
+        """
+        with self._lock:
+            states = [self._channels[channel] for channel in digits]
+            count = len(states)
+            codes = (wintypes.DWORD * count)(*(digits[s.channel] for s in states))
+            for i, state in enumerate(states):
+                self._channel_buf[i] = state.channel
+            self._axl.ao_write_multi_digit(self._channel_buf, codes, count)
+            self._axl.ao_read_multi_voltage(self._channel_buf, self._volt_buf, count)
+            self._writes += 1
+            self._readbacks += 1
+            for i, state in enumerate(states):
+                state.current = state.target = state.readback = self._volt_buf[i]
+                state.ramp_rate = None
+            self._settled.notify_all()
+
+    @staticmethod
+    def _clamp(state: _Channel, volts: float) -> float:
+        return min(max(float(volts), state.min_volt), state.max_volt)
+
+    # ========================================================================
+    # Ramp Timer
+    # ========================================================================
+
+    def start(self) -> None:
+        """Start the ramp timer thread"""
+        if self._thread is not None and self._thread.is_alive():
+            return
+        self._stop_event.clear()
+        self._last_tick = None
+        self._thread = threading.Thread(target=self._run, name="AXL-AnalogRamp", daemon=True)
+        self._thread.start()
+        logger.info(f"Analog output ramp started (tick: {self._tick_period * 1000:.1f} ms)")
+
+    def stop(self) -> None:
+        """Stop the ramp timer (outputs hold their last written voltage)"""
+        self._stop_event.set()
+        if self._thread is not None:
+            self._thread.join(timeout=2.0)
+            self._thread = None
+        logger.info("Analog output ramp stopped")
+
+    @property
+    def is_running(self) -> bool:
+        return self._thread is not None and self._thread.is_alive()
+
+    def _run(self) -> None:
+        next_tick = time.monotonic()
+        while not self._stop_event.is_set():
+            now = time.monotonic()
+            # Cap dt so a stalled thread does not turn into one large step
+            dt = self._tick_period if self._last_tick is None else now - self._last_tick
+            self._last_tick = now
+            self.tick_once(min(dt, 4 * self._tick_period))
+
+            next_tick += self._tick_period
+            delay = next_tick - time.monotonic()
+            if delay < 0:
+                # Overrun - resynchronize instead of bursting
+                next_tick = time.monotonic()
+                delay = 0
+            self._stop_event.wait(delay)
+
+    def tick_once(self, dt: Optional[float] = None) -> int:
+        """
+        Advance every moving channel by one step
+
+        Args:
+            dt: Elapsed time in seconds (None = tick period)
+
+        Returns:
+            Number of channels written this tick
+        """
+        if dt is None:
+            dt = self._tick_period
+
+        with self._lock:
+            self._ticks += 1
+            moving: List[_Channel] = [s for s in self._channels.values() if not s.settled]
+            count = len(moving)
+            if count:
+                for i, state in enumerate(moving):
+                    self._channel_buf[i] = state.channel
+                    self._volt_buf[i] = state.next_value(dt)
+                try:
+                    self._axl.ao_write_multi_voltage(self._channel_buf, self._volt_buf, count)
+                except Exception as e:
+                    self._errors += 1
+                    if self._errors == 1 or self._errors % 100 == 0:
+                        logger.warning(f"Analog output ramp write failed: {e}")
+                    return 0
+                self._writes += 1
+                for i, state in enumerate(moving):
+                    state.current = self._volt_buf[i]
+                    if state.settled:
+                        state.ramp_rate = None
+                if all(s.settled for s in self._channels.values()):
+                    self._settled.notify_all()
+
+            if self._readback_every and self._ticks % self._readback_every == 0:
+                self._read_back()
+            return count
+
+    def _read_back(self) -> None:
+        count = len(self._readback_channels)
+        if count == 0:
+            return
+        try:
+            self._axl.ao_read_multi_voltage(self._readback_channels, self._readback_buf, count)
+        except Exception as e:
+            self._errors += 1
+            if self._errors == 1 or self._errors % 100 == 0:
+                logger.warning(f"Analog output read-back failed: {e}")
+            return
+        self._readbacks += 1
+        for i in range(count):
+            state = self._channels.get(self._readback_channels[i])
+            if state is not None:
+                state.readback = self._readback_buf[i]
+
+    def wait_settled(self, timeout: Optional[float] = None) -> bool:
+        """
+        Block until every channel has reached its target
+
+        Returns:
+            True if settled, False on timeout
+        """
+        with self._settled:
+            return self._settled.wait_for(
+                lambda: all(s.settled for s in self._channels.values()), timeout
+            )
+
+    # ========================================================================
+    # Status
+    # ========================================================================
+
+    def get_outputs(self) -> Dict[int, Dict[str, Optional[float]]]:
+        """Current, target and last read-back voltage per channel"""
+        with self._lock:
+            return {
+                channel: {
+                    "current": state.current,
+                    "target": state.target,
+                    "readback": state.readback,
+                }
+                for channel, state in sorted(self._channels.items())
+            }
+
+    def get_stats(self) -> Dict[str, int]:
+        """Tick, driver write/read-back and error counters"""
+        with self._lock:
+            return {
+                "channels": len(self._channels),
+                "ticks": self._ticks,
+                "writes": self._writes,
+                "readbacks": self._readbacks,
+                "errors": self._errors,
+            }
@@ -0,0 +1,381 @@
+"""
+AJINEXTEK AXL Background Bring-up
+
+Runs the slow AXL start-up work - library open, topology discovery, motion
+parameter load and servo readiness check - on a background thread started as
+early as possible in the process. Services await a readiness future instead of
+doing blocking AXL calls on the event loop, so serial and TCP instrument
+connections proceed in parallel with motion bring-up.
+
+AxlOpen failures are retried with a backoff chosen from the returned
+AXT_FUNC_RESULT: transient codes (network, not yet initialized) back off
+exponentially, hardware/version mismatches fail immediately.
+"""
+
+# Standard library imports
+from concurrent.futures import Future
+from dataclasses import dataclass, field
+from pathlib import Path
+import random
+import threading
+import time
+from typing import Any, Dict, List, Optional, Tuple
+
+# Third-party imports
+from loguru import logger
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLConnectionError, AXLError
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    BRINGUP_BACKOFF_FACTOR,
+    BRINGUP_BACKOFF_JITTER,
+    BRINGUP_OPEN_DEADLINE,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.error_codes import (
+    AXT_RT_NETWORK_ERROR,
+    AXT_RT_NOT_INITIAL,
+    AXT_RT_NOT_OPEN,
+    AXT_RT_OPEN_ALREADY,
+    AXT_RT_OPEN_ERROR,
+    AXT_RT_SUCCESS,
+    get_error_message,
+)
+
+# Retry policy per AxlOpen result: (initial delay, max delay) in seconds.
+# Codes not listed here are treated as permanent and fail the bring-up at once.
+OPEN_RETRY_POLICY: Dict[int, Tuple[float, float]] = {
+    AXT_RT_OPEN_ERROR: (0.02, 0.5),  # Driver still loading
+    AXT_RT_NOT_OPEN: (0.05, 1.0),  # Initialization failed, usually a busy driver
+    AXT_RT_NOT_INITIAL: (0.05, 1.0),  # Serial module not initialized yet
+    AXT_RT_NETWORK_ERROR: (0.2, 2.0),  # SIIIH/EtherCAT link still negotiating
+}
+
+STAGE_OPEN = "open"
+STAGE_TOPOLOGY = "topology"
+STAGE_PARAMETERS = "parameters"
+STAGE_SERVO_READY = "servo_ready"
+
+
+def default_motion_settings_file() -> Path:
+    """Motion parameter file loaded with AxmMotLoadParaAll"""
+    project_root = Path(__file__).parent.parent.parent.parent.parent.parent.parent
+    return project_root / "configuration" / "robot_motion_settings.mot"
+
+
+@dataclass
+class BringupReport:
+    """Result of a completed bring-up"""
+
+    irq_no: int
+    board_count: int = 0
+    axis_count: int = 0
+    version: str = "Unknown"
+    parameter_file: Optional[str] = None
+    alarmed_axes: List[int] = field(default_factory=list)
+    open_attempts: int = 0
+    open_results: List[int] = field(default_factory=list)  # AxlOpen result per attempt
+    timings: Dict[str, float] = field(default_factory=dict)  # Stage name -> seconds
+
+    @property
+    def total_time(self) -> float:
+        return sum(self.timings.values())
+
+
+class AXLBringup:
+    """AXL 라이브러리 백그라운드 초기화 서비스"""
+
+    _instance: Optional["AXLBringup"] = None
+    _instance_lock = threading.Lock()
+
+    def __init__(self, axl: Optional[Any] = None, open_deadline: float = BRINGUP_OPEN_DEADLINE):
+        """
+        초기화
+
+        Args:
+            axl: AXLWrapper instance (defaults to the process-wide singleton)
+            open_deadline: Seconds to keep retrying transient AxlOpen failures
+        """
+        self._axl = axl
+        self._open_deadline = open_deadline
+
+        self._lock = threading.Lock()
+        self._ready: Optional[Future] = None
+        self._opened: Optional[Future] = None
+        self._thread: Optional[threading.Thread] = None
+        self._timings: Dict[str, float] = {}
+        self._current_stage: Optional[str] = None
+
+    @classmethod
+    def get_instance(cls) -> "AXLBringup":
+        """
+        싱글톤 인스턴스 반환.
+
+        Returns:
+            Process-wide bring-up instance
+        """
+        with cls._instance_lock:
+            if cls._instance is None:
+                cls._instance = cls()
+            return cls._instance
+
+    @classmethod
+    def reset_for_testing(cls) -> None:
+        """
+        테스트용 싱글톤 리셋.
+
+        주의: 이 메서드는 테스트 목적으로만 사용하세요.
+        """
+        with cls._instance_lock:
+            cls._instance = None
+
+    # ========================================================================
+    # Public API
+    # ========================================================================
+
+    def start(
+        self,
+        irq_no: int = 7,
+        parameter_file: Optional[Path] = None,
+        check_servo: bool = True,
+    ) -> Future:
+        """
+        Start the bring-up thread unless one is running or already succeeded
+
+        A failed bring-up, or a successful one whose library has since been
+        closed, is restarted.
+
+        Args:
+            irq_no: IRQ number passed to AxlOpen
+            parameter_file: Motion parameter file (None = default settings file,
+                use an empty Path to skip the parameter stage)
+            check_servo: Read servo alarms of every detected axis
+
+        Returns:
+            Readiness future resolving to a BringupReport
+        """
+        with self._lock:
+            if self._ready is not None and not self._needs_restart():
+                return self._ready
+
+            self._ready = Future()
+            self._opened = Future()
+            self._timings = {}
+            self._thread = threading.Thread(
+                target=self._run,
+                args=(irq_no, parameter_file, check_servo, self._ready, self._opened),
+                name="AXL-Bringup",
+                daemon=True,
+            )
+            self._thread.start()
+            logger.info(f"AXL background bring-up started (IRQ: {irq_no})")
+            return self._ready
+
+    def opened_future(self, irq_no: int = 7) -> Future:
+        """
+        Future that resolves once the library is open (before parameters/servo stages)
+
+        Services that only need an open library (e.g. DIO) wait on this one.
+        """
+        self.start(irq_no)
+        assert self._opened is not None
+        return self._opened
+
+    def invalidate(self) -> None:
+        """
+        Forget a completed bring-up so the next start() runs every stage again
+
+        Called on disconnect: the library may stay open for other services, but
+        a reconnect must still reload the motion parameter file. A bring-up in
+        progress is left alone.
+        """
+        with self._lock:
+            if self._ready is not None and self._ready.done():
+                self._ready = None
+                self._opened = None
+
+    @property
+    def ready(self) -> Optional[Future]:
+        return self._ready
+
+    @property
+    def current_stage(self) -> Optional[str]:
+        return self._current_stage
+
+    def get_timings(self) -> Dict[str, float]:
+        """Per-stage timings of the latest bring-up (completed stages only)"""
+        return dict(self._timings)
+
+    # ========================================================================
+    # Bring-up Thread
+    # ========================================================================
+
+    def _needs_restart(self) -> bool:
+        if self._ready is None:
+            return True
+        if not self._ready.done():
+            return False
+        if self._ready.exception() is not None:
+            return True
+        try:
+            return not self._get_axl().is_opened()
+        except AXLError:
+            return True
+
+    def _get_axl(self) -> Any:
+        if self._axl is None:
+            # Local application imports
+            from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import (
+                AXLWrapper,
+            )
+
+            self._axl = AXLWrapper.get_instance()
+        return self._axl
+
+    def _run(
+        self,
+        irq_no: int,
+        parameter_file: Optional[Path],
+        check_servo: bool,
+        ready: Future,
+        opened: Future,
+    ) -> None:
+        report = BringupReport(irq_no=irq_no)
+        try:
+            axl = self._get_axl()
+
+            self._stage(STAGE_OPEN, report, lambda: self._open_with_retry(axl, irq_no, report))
+            opened.set_result(report)
+
+            self._stage(STAGE_TOPOLOGY, report, lambda: self._read_topology(axl, report))
+
+            if parameter_file is None:
+                parameter_file = default_motion_settings_file()
+            if str(parameter_file) not in ("", "."):
+                self._stage(
+                    STAGE_PARAMETERS,
+                    report,
+                    lambda: self._load_parameters(axl, Path(parameter_file), report),
+                )
+
+            if check_servo:
+                self._stage(STAGE_SERVO_READY, report, lambda: self._check_servo(axl, report))
+
+            self._current_stage = None
+            logger.info(
+                f"AXL bring-up completed in {report.total_time * 1000:.1f} ms "
+                f"({', '.join(f'{k}: {v * 1000:.1f} ms' for k, v in report.timings.items())})"
+            )
+            ready.set_result(report)
+
+        except Exception as e:
+            logger.error(f"AXL bring-up failed at stage '{self._current_stage}': {e}")
+            if not opened.done():
+                opened.set_exception(e)
+            ready.set_exception(e)
+
+    def _stage(self, name: str, report: BringupReport, func) -> None:
+        self._current_stage = name
+        start = time.perf_counter()
+        try:
+            func()
+        finally:
+            elapsed = time.perf_counter() - start
+            report.timings[name] = elapsed
+            self._timings[name] = elapsed
+
+    def _open_with_retry(self, axl: Any, irq_no: int, report: BringupReport) -> None:
+        """AxlOpen with result-code driven backoff"""
+        deadline = time.monotonic() + self._open_deadline
+        delays: Dict[int, float] = {}
+        while True:
+            # Hold the connection lock per attempt so concurrent AXLWrapper.connect()
+            # calls see a consistent opened state, but not across the backoff sleep;
+            # the ref count is left to the services.
+            with axl._connection_lock:  # pylint: disable=protected-access
+                if axl.is_opened():
+                    report.open_results.append(AXT_RT_OPEN_ALREADY)
+                    return
+                result = axl.open(irq_no)
+            report.open_attempts += 1
+            report.open_results.append(result)
+
+            if result in (AXT_RT_SUCCESS, AXT_RT_OPEN_ALREADY):
+                if report.open_attempts > 1:
+                    logger.info(f"AxlOpen succeeded after {report.open_attempts} attempts")
+                return
+
+            policy = OPEN_RETRY_POLICY.get(result)
+            if policy is None:
+                raise AXLConnectionError(get_error_message(result), result, "AxlOpen")
+
+            # Back off per code: a different failure restarts at its own initial delay
+            initial, maximum = policy
+            previous = delays.get(result)
+            if previous is None:
+                delay = initial
+            else:
+                delay = min(previous * BRINGUP_BACKOFF_FACTOR, maximum)
+            delays[result] = delay
+            delay *= 1.0 + random.uniform(0.0, BRINGUP_BACKOFF_JITTER)
+
+            if time.monotonic() + delay > deadline:
+                raise AXLConnectionError(
+                    f"{get_error_message(result)} "
+                    f"(gave up after {report.open_attempts} attempts)",
+                    result,
+                    "AxlOpen",
+                )
+
+            logger.debug(
+                f"AxlOpen returned {result} ({get_error_message(result)}), "
+                f"retrying in {delay * 1000:.0f} ms"
+            )
+            time.sleep(delay)
+
+    def _read_topology(self, axl: Any, report: BringupReport) -> None:
+        try:
+            report.board_count = axl.get_board_count()
+        except Exception as e:
+            logger.warning(f"Could not get board count: {e}")
+
+        try:
+            report.axis_count = axl.get_axis_count()
+        except Exception as e:
+            logger.warning(f"Could not get axis count: {e} (using default: 1)")
+            report.axis_count = 1
+
+        try:
+            report.version = axl.get_lib_version()
+        except Exception:
+            pass  # Library version is not critical
+
+        logger.info(
+            f"AXL topology: {report.board_count} board(s), {report.axis_count} axis(es), "
+            f"library {report.version}"
+        )
+
+    def _load_parameters(self, axl: Any, parameter_file: Path, report: BringupReport) -> None:
+        if not parameter_file.exists():
+            raise AXLError(
+                f"Required robot motion settings file not found: {parameter_file}",
+                0,
+                "AxmMotLoadParaAll",
+            )
+
+        result = axl.load_para_all(str(parameter_file))
+        if result != AXT_RT_SUCCESS:
+            raise AXLError(get_error_message(result), result, "AxmMotLoadParaAll")
+
+        report.parameter_file = str(parameter_file)
+        logger.info(f"Robot motion settings loaded from {parameter_file}")
+
+    def _check_servo(self, axl: Any, report: BringupReport) -> None:
+        for axis in range(report.axis_count):
+            try:
+                if axl.read_servo_alarm(axis):
+                    report.alarmed_axes.append(axis)
+            except Exception as e:
+                logger.warning(f"Could not read servo alarm of axis {axis}: {e}")
+
+        if report.alarmed_axes:
+            logger.warning(f"Servo alarm active on axes {report.alarmed_axes}")
@@ -0,0 +1,422 @@
+"""
+AJINEXTEK AXL Axis Configuration Snapshot
+
+Captures every configurable parameter of every axis (motion, limit and soft
+limit signals, in-position/alarm levels, homing, torque limits and backlash
+compensation) into a compact versioned binary blob with a SHA-256 hash.
+
+Compared with AxmMotSaveParaAll/AxmMotLoadParaAll this avoids the text .mot
+round trip through the disk: a test record can store just the hash, restoring
+writes only the parameters that differ from the board, and two blobs can be
+diffed parameter by parameter.
+
+Blob layout (little endian):
+    header   4s magic, H version, H axis count, H parameter count
+    per axis H axis number, I presence mask (bit i = CONFIG_PARAMETERS[i]),
+             packed values of the present parameters in table order
+"""
+
+# Standard library imports
+from dataclasses import dataclass, field
+import hashlib
+import struct
+from typing import Any, Dict, Iterable, List, Optional, Set, Tuple, Union
+
+# Third-party imports
+from loguru import logger
+
+# Local application imports
+from domain.exceptions.robot_exceptions import (
+    AXLConfigurationError,
+    AXLError,
+    AXLMotionError,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_parameter_cache import (
+    PARAM_ABS_REL_MODE,
+    PARAM_ACCEL_UNIT,
+    PARAM_BACKLASH,
+    PARAM_BACKLASH_ENABLE,
+    PARAM_HOME_METHOD,
+    PARAM_HOME_VEL,
+    PARAM_INPOS,
+    PARAM_LIMIT,
+    PARAM_MAX_VEL,
+    PARAM_MIN_VEL,
+    PARAM_MOVE_UNIT_PER_PULSE,
+    PARAM_PROFILE_MODE,
+    PARAM_PULSE_OUT_METHOD,
+    PARAM_SERVO_ALARM,
+    PARAM_SOFT_LIMIT,
+    PARAM_TORQUE_LIMIT,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.error_codes import (
+    AXT_RT_SUCCESS,
+    get_error_message,
+)
+
+SNAPSHOT_MAGIC = b"AXCS"
+SNAPSHOT_VERSION = 1
+
+_HEADER = struct.Struct("<4sHHH")
+_AXIS_HEADER = struct.Struct("<HI")
+
+
+@dataclass(frozen=True)
+class ConfigParameter:
+    """One Set/Get parameter pair of the snapshot table"""
+
+    name: str
+    fields: Tuple[str, ...]
+    fmt: str  # struct format of the values, without byte order
+    getter: str  # AXLWrapper method
+    setter: str  # AXLWrapper method, called with the values in field order
+    function: str  # AXL setter name for error reports
+
+    @property
+    def packer(self) -> struct.Struct:
+        return struct.Struct("<" + self.fmt)
+
+
+# Restore order matters: units and pulse output before anything expressed in them.
+# New parameters may only be appended (the presence mask indexes this table).
+CONFIG_PARAMETERS: Tuple[ConfigParameter, ...] = (
+    ConfigParameter(
+        PARAM_PULSE_OUT_METHOD,
+        ("method",),
+        "I",
+        "get_pulse_out_method",
+        "set_pulse_out_method",
+        "AxmMotSetPulseOutMethod",
+    ),
+    ConfigParameter(
+        PARAM_MOVE_UNIT_PER_PULSE,
+        ("unit", "pulse"),
+        "di",
+        "get_move_unit_per_pulse",
+        "set_move_unit_per_pulse",
+        "AxmMotSetMoveUnitPerPulse",
+    ),
+    ConfigParameter(
+        PARAM_ABS_REL_MODE,
+        ("mode",),
+        "I",
+        "get_abs_rel_mode",
+        "set_abs_rel_mode",
+        "AxmMotSetAbsRelMode",
+    ),
+    ConfigParameter(
+        PARAM_MAX_VEL, ("max_vel",), "d", "get_max_vel", "set_max_vel", "AxmMotSetMaxVel"
+    ),
+    ConfigParameter(
+        PARAM_MIN_VEL, ("min_vel",), "d", "get_min_vel", "set_min_vel", "AxmMotSetMinVel"
+    ),
+    ConfigParameter(
+        PARAM_ACCEL_UNIT,
+        ("unit",),
+        "I",
+        "get_accel_unit",
+        "set_accel_unit",
+        "AxmMotSetAccelUnit",
+    ),
+    ConfigParameter(
+        PARAM_PROFILE_MODE,
+        ("mode",),
+        "I",
+        "get_profile_mode",
+        "set_profile_mode",
+        "AxmMotSetProfileMode",
+    ),
+    ConfigParameter(
+        PARAM_LIMIT,
+        ("pos_level", "neg_level", "stop_mode"),
+        "III",
+        "get_limit_config",
+        "set_limit_config",
+        "AxmSignalSetLimit",
+    ),
+    ConfigParameter(
+        PARAM_SOFT_LIMIT,
+        ("use", "stop_mode", "selection", "positive_pos", "negative_pos"),
+        "IIIdd",
+        "get_soft_limit",
+        "set_soft_limit",
+        "AxmSignalSetSoftLimit",
+    ),
+    ConfigParameter(
+        PARAM_INPOS,
+        ("level",),
+        "I",
+        "get_inpos_level",
+        "set_inpos_level",
+        "AxmSignalSetInpos",
+    ),
+    ConfigParameter(
+        PARAM_SERVO_ALARM,
+        ("level",),
+        "I",
+        "get_servo_alarm_level",
+        "set_servo_alarm_level",
+        "AxmSignalSetServoAlarm",
+    ),
+    ConfigParameter(
+        PARAM_TORQUE_LIMIT,
+        ("plus", "minus"),
+        "dd",
+        "get_torque_limit",
+        "set_torque_limit",
+        "AxmMotSetTorqueLimit",
+    ),
+    ConfigParameter(
+        PARAM_HOME_METHOD,
+        ("direction", "signal", "z_phase", "clear_time", "offset"),
+        "iIIdd",
+        "home_get_method",
+        "home_set_method",
+        "AxmHomeSetMethod",
+    ),
+    ConfigParameter(
+        PARAM_HOME_VEL,
+        ("vel_first", "vel_second", "vel_third", "vel_last", "accel_first", "accel_second"),
+        "6d",
+        "home_get_vel",
+        "home_set_vel",
+        "AxmHomeSetVel",
+    ),
+    ConfigParameter(
+        PARAM_BACKLASH,
+        ("direction", "amount"),
+        "id",
+        "get_backlash",
+        "set_backlash",
+        "AxmCompensationSetBacklash",
+    ),
+    ConfigParameter(
+        PARAM_BACKLASH_ENABLE,
+        ("enable",),
+        "I",
+        "is_backlash_enabled",
+        "enable_backlash",
+        "AxmCompensationEnableBacklash",
+    ),
+)
+
+
+@dataclass(frozen=True)
+class ConfigDifference:
+    """One field that differs between two snapshots"""
+
+    axis: int
+    parameter: str
+    field_name: str
+    before: Any
+    after: Any
+
+    def __str__(self) -> str:
+        return f"axis {self.axis} {self.parameter}.{self.field_name}: {self.before} -> {self.after}"
+
+
+@dataclass
+class AxisConfigSnapshot:
+    """Configuration of all axes, keyed by axis number and parameter name"""
+
+    axes: Dict[int, Dict[str, Tuple]] = field(default_factory=dict)
+
+    def to_bytes(self) -> bytes:
+        """Serialize to the versioned binary blob"""
+        chunks = [
+            _HEADER.pack(SNAPSHOT_MAGIC, SNAPSHOT_VERSION, len(self.axes), len(CONFIG_PARAMETERS))
+        ]
+        for axis_no in sorted(self.axes):
+            values = self.axes[axis_no]
+            mask = 0
+            packed = []
+            for index, param in enumerate(CONFIG_PARAMETERS):
+                if param.name in values:
+                    mask |= 1 << index
+                    packed.append(param.packer.pack(*values[param.name]))
+            chunks.append(_AXIS_HEADER.pack(axis_no, mask))
+            chunks.extend(packed)
+        return b"".join(chunks)
+
+    @classmethod
+    def from_bytes(cls, blob: bytes) -> "AxisConfigSnapshot":
+        """
+        Parse a blob produced by to_bytes()
+
+        Raises:
+            AXLConfigurationError: If the blob is not a snapshot of a supported version
+        """
+        try:
+            magic, version, axis_count, param_count = _HEADER.unpack_from(blob, 0)
+            if magic != SNAPSHOT_MAGIC:
+                raise AXLConfigurationError("Not an axis configuration snapshot")
+            if version != SNAPSHOT_VERSION or param_count > len(CONFIG_PARAMETERS):
+                raise AXLConfigurationError(
+                    f"Unsupported snapshot version {version} ({param_count} parameters)"
+                )
+
+            offset = _HEADER.size
+            axes: Dict[int, Dict[str, Tuple]] = {}
+            for _ in range(axis_count):
+                axis_no, mask = _AXIS_HEADER.unpack_from(blob, offset)
+                offset += _AXIS_HEADER.size
+                values: Dict[str, Tuple] = {}
+                for index, param in enumerate(CONFIG_PARAMETERS[:param_count]):
+                    if mask & (1 << index):
+                        values[param.name] = param.packer.unpack_from(blob, offset)
+                        offset += param.packer.size
+                axes[axis_no] = values
+        except struct.error as e:
+            raise AXLConfigurationError(f"Truncated axis configuration snapshot: {e}") from e
+
+        if offset != len(blob):
+            raise AXLConfigurationError(
+                f"Axis configuration snapshot has {len(blob) - offset} trailing bytes"
+            )
+        return cls(axes)
+
+    @property
+    def hash(self) -> str:
+        """SHA-256 of the blob (hex) - identical configurations hash identically"""
+        return hashlib.sha256(self.to_bytes()).hexdigest()
+
+    @property
+    def short_hash(self) -> str:
+        """First 12 hex digits of the hash, for logs and test records"""
+        return self.hash[:12]
+
+    def diff(self, other: "AxisConfigSnapshot") -> List[ConfigDifference]:
+        """Fields that differ from this snapshot (before) to other (after)"""
+        return diff_snapshots(self, other)
+
+
+SnapshotLike = Union[AxisConfigSnapshot, bytes]
+
+
+def _as_snapshot(snapshot: SnapshotLike) -> AxisConfigSnapshot:
+    if isinstance(snapshot, AxisConfigSnapshot):
+        return snapshot
+    return AxisConfigSnapshot.from_bytes(snapshot)
+
+
+def _read(
+    axl: Any,
+    axis_no: int,
+    param: ConfigParameter,
+    unsupported: Optional[Set[Tuple[int, str]]] = None,
+) -> Optional[Tuple]:
+    """Current values of a parameter normalized to the blob types (None if unsupported)"""
+    if unsupported is not None and (axis_no, param.name) in unsupported:
+        return None
+    try:
+        raw = getattr(axl, param.getter)(axis_no)
+    except (AXLError, AttributeError) as e:
+        # AttributeError: function missing from this AXL.dll version
+        logger.debug(f"Axis {axis_no} {param.name} not captured: {e}")
+        if unsupported is not None:
+            unsupported.add((axis_no, param.name))
+        return None
+    values = raw if isinstance(raw, tuple) else (raw,)
+    return param.packer.unpack(param.packer.pack(*values))
+
+
+def capture_snapshot(
+    axl: Any,
+    axes: Optional[Iterable[int]] = None,
+    refresh: bool = False,
+    unsupported: Optional[Set[Tuple[int, str]]] = None,
+) -> AxisConfigSnapshot:
+    """
+    Read the configuration of every axis
+
+    Values come through the AXLWrapper parameter cache, which is cleared on
+    open and parameter loads, so repeated captures cost no driver calls.
+
+    Args:
+        axl: AXLWrapper instance
+        axes: Axes to capture (None = all axes reported by AxmInfoGetAxisCount)
+        refresh: Drop the parameter cache first (board changed outside this process)
+        unsupported: Caller-owned set of (axis, parameter) whose getter failed;
+            those are skipped and new failures are added, so unsupported
+            getters are not retried on every capture
+
+    Returns:
+        Snapshot; parameters the hardware does not support are left out
+    """
+    if refresh:
+        axl.invalidate_parameter_cache()
+
+    axis_list = range(axl.get_axis_count()) if axes is None else axes
+    snapshot = AxisConfigSnapshot()
+    for axis_no in axis_list:
+        values: Dict[str, Tuple] = {}
+        for param in CONFIG_PARAMETERS:
+            current = _read(axl, axis_no, param, unsupported)
+            if current is not None:
+                values[param.name] = current
+        snapshot.axes[axis_no] = values
+    return snapshot
+
+
+def restore_snapshot(axl: Any, snapshot: SnapshotLike) -> int:
+    """
+    Write a snapshot back to the board, skipping parameters that already match
+
+    Args:
+        axl: AXLWrapper instance
+        snapshot: Snapshot or blob to restore
+
+    Returns:
+        Number of setter calls issued
+
+    Raises:
+        AXLMotionError: If a setter fails
+    """
+    target = _as_snapshot(snapshot)
+    writes = 0
+    for axis_no in sorted(target.axes):
+        values = target.axes[axis_no]
+        for param in CONFIG_PARAMETERS:
+            wanted = values.get(param.name)
+            if wanted is None or _read(axl, axis_no, param) == wanted:
+                continue
+            result = getattr(axl, param.setter)(axis_no, *wanted)
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    f"{get_error_message(result)} (axis {axis_no}, {param.name})",
+                    result,
+                    param.function,
+                )
+            writes += 1
+
+    logger.info(f"Axis configuration {target.short_hash} restored with {writes} write(s)")
+    return writes
+
+
+def diff_snapshots(before: SnapshotLike, after: SnapshotLike) -> List[ConfigDifference]:
+    """
+    Symbolic difference of two snapshots
+
+    Parameters present in only one snapshot are reported with field_name "*" and
+    None on the missing side.
+    """
+    a = _as_snapshot(before)
+    b = _as_snapshot(after)
+    differences: List[ConfigDifference] = []
+    for axis_no in sorted(set(a.axes) | set(b.axes)):
+        values_a = a.axes.get(axis_no, {})
+        values_b = b.axes.get(axis_no, {})
+        for param in CONFIG_PARAMETERS:
+            old = values_a.get(param.name)
+            new = values_b.get(param.name)
+            if old == new:
+                continue
+            if old is None or new is None:
+                differences.append(ConfigDifference(axis_no, param.name, "*", old, new))
+                continue
+            for name, old_value, new_value in zip(param.fields, old, new):
+                if old_value != new_value:
+                    differences.append(
+                        ConfigDifference(axis_no, param.name, name, old_value, new_value)
+                    )
+    return differences
@@ -0,0 +1,118 @@
+"""
+AJINEXTEK AXL Motion Parameter Cache
+
+Write-through per-axis cache for the AxmMotSet*/Get*, AxmSignalSet*/Get*,
+AxmHomeSet*/Get* and AxmCompensation* parameter families. A setter whose value
+matches the cached one is answered without a driver call, and getters are
+served from the cache once a value is known.
+
+The cache only knows what went through AXLWrapper, so it is cleared whenever
+the board may hold different values: parameter file loads, library open and
+close (reconnect / handle recovery) and failed setter calls.
+"""
+
+# Standard library imports
+import threading
+from typing import Dict, Optional, Tuple
+
+# Parameter names (one entry per Set/Get function pair)
+PARAM_PULSE_OUT_METHOD = "pulse_out_method"
+PARAM_MOVE_UNIT_PER_PULSE = "move_unit_per_pulse"
+PARAM_ABS_REL_MODE = "abs_rel_mode"
+PARAM_MAX_VEL = "max_vel"
+PARAM_MIN_VEL = "min_vel"
+PARAM_ACCEL_UNIT = "accel_unit"
+PARAM_PROFILE_MODE = "profile_mode"
+PARAM_LIMIT = "limit"
+PARAM_SOFT_LIMIT = "soft_limit"
+PARAM_INPOS = "inpos"
+PARAM_SERVO_ALARM = "servo_alarm"
+PARAM_TORQUE_LIMIT = "torque_limit"
+PARAM_HOME_METHOD = "home_method"
+PARAM_HOME_VEL = "home_vel"
+PARAM_BACKLASH = "backlash"
+PARAM_BACKLASH_ENABLE = "backlash_enable"
+
+
+class AxisParameterCache:
+    """축별 모션 파라미터 write-through 캐시"""
+
+    def __init__(self) -> None:
+        """초기화"""
+        self._lock = threading.Lock()
+        self._values: Dict[Tuple[int, str], Tuple] = {}
+        self._hits = 0
+        self._misses = 0
+        self._suppressed_writes = 0
+        self._invalidations = 0
+
+    def lookup(self, axis_no: int, name: str) -> Optional[Tuple]:
+        """
+        Cached value of a parameter for a getter
+
+        Returns:
+            Cached value tuple, or None on a miss (caller reads the driver and stores it)
+        """
+        with self._lock:
+            value = self._values.get((axis_no, name))
+            if value is None:
+                self._misses += 1
+            else:
+                self._hits += 1
+            return value
+
+    def is_current(self, axis_no: int, name: str, value: Tuple) -> bool:
+        """
+        Check whether a setter would write the value already on the board
+
+        Returns:
+            True if the write can be skipped
+        """
+        with self._lock:
+            if self._values.get((axis_no, name)) == value:
+                self._hits += 1
+                self._suppressed_writes += 1
+                return True
+            self._misses += 1
+            return False
+
+    def store(self, axis_no: int, name: str, value: Tuple) -> None:
+        """Record a value after a successful driver write or read"""
+        with self._lock:
+            self._values[(axis_no, name)] = value
+
+    def invalidate(self, axis_no: Optional[int] = None, name: Optional[str] = None) -> None:
+        """
+        Drop cached values
+
+        Args:
+            axis_no: Axis to clear (None = all axes)
+            name: Parameter to clear (None = all parameters of the selected axes)
+        """
+        with self._lock:
+            if axis_no is None and name is None:
+                self._values.clear()
+            else:
+                for key in list(self._values):
+                    if (axis_no is None or key[0] == axis_no) and (name is None or key[1] == name):
+                        del self._values[key]
+            self._invalidations += 1
+
+    def get_stats(self) -> Dict[str, int]:
+        """Hit/miss counters and current entry count"""
+        with self._lock:
+            return {
+                "hits": self._hits,
+                "misses": self._misses,
+                "suppressed_writes": self._suppressed_writes,
+                "invalidations": self._invalidations,
+                "entries": len(self._values),
+            }
+
+    def reset_stats(self) -> None:
+        """Zero the counters (cached values are kept)"""
+        with self._lock:
+            self._hits = 0
+            self._misses = 0
+            self._suppressed_writes = 0
+            self._invalidations = 0
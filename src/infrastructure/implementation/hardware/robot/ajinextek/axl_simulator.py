@@ -0,0 +1,1811 @@
+"""
+AJINEXTEK AXL Library Simulator
+
+Stand-in for AXL.dll that AXLWrapper can drive in place of the real library
+(AXL_SIMULATOR=true). Functions take the same arguments the wrapper passes
+through ctypes - plain numbers, ctypes arrays and byref() outputs - and
+return AXT_FUNC_RESULT codes.
+
+Each call is charged a latency from a LatencyModel and counted per function
+name, so benchmarks can report FFI call counts and driver time alongside
+wall-clock cycle times. Axis motion follows trapezoidal profiles in real time
+(optionally accelerated by time_scale) and DIO modules keep bit images that
+tests can drive with set_input(). Analog output channels hold the last
+written voltage, clamped to their range; analog inputs and axis universal
+inputs are driven with set_analog_input() / set_universal_input(). The servo load ratio reflects an
+axial load set with set_external_force() plus friction while moving.
+
+A DUT plant (dut_model.py) attached with attach_dut() adds the reaction
+force of a spring-loaded device under test to that load, following the axis
+position, and read_loadcell() returns the same force with loadcell noise.
+
+The actual position follows the command exactly unless set_following_lag()
+makes it trail by velocity x lag; AxmStatusReadMotionInfo returns command
+and actual position from the same instant.
+
+Loopback wiring (wire_loopback()) copies an output bit to an input bit after
+a delay, on a timer thread, as a cable from an output to an input would. DIO
+input edges - wired or driven with set_input() - call the module's interrupt
+callback (AxdiInterruptSetModule) when enabled for that edge.
+
+Every board has a data flash (AxlSetDataFlash / AxlGetDataFlash) that starts
+erased (0xFF). A write arriving while the previous one is still programming
+(flash_write_time) is rejected with AXT_RT_DATA_FLASH_BUSY.
+"""
+
+# Standard library imports
+from collections import Counter
+from dataclasses import dataclass, field
+import functools
+import math
+from pathlib import Path
+import random
+import threading
+import time
+from typing import Any, Callable, Dict, List, Optional, Sequence, Tuple
+
+# Local application imports
+from infrastructure.implementation.hardware.digital_io.ajinextek.constants import (
+    DOWN_EDGE,
+    MODULE_ID_SIO_DI16,
+    MODULE_ID_SIO_DO16,
+    UP_EDGE,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    ACCEL_UNIT_SEC,
+    DATA_FLASH_PAGE_COUNT,
+    DATA_FLASH_PAGE_SIZE,
+    DATA_FLASH_WRITE_TIME,
+    HOME_ERR_AMP_FAULT,
+    HOME_ERR_USER_BREAK,
+    HOME_SEARCHING,
+    HOME_SUCCESS,
+    MECH_SIG_ALARM,
+    MECH_SIG_INPOS,
+    MECH_SIG_NELM,
+    MECH_SIG_PELM,
+    MOTION_INFO_ACT_POS,
+    MOTION_INFO_CMD_POS,
+    MOTION_INFO_MECH_SIG,
+    MOTION_INFO_UNIV_IO,
+    POS_ABS,
+    SCAN_DWORD_BITS,
+    SERVO_ON,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.dut_model import DUTModel, DUTPlant
+from infrastructure.implementation.hardware.robot.ajinextek.error_codes import (
+    AXT_RT_AIO_INVALID_CHANNEL_NO,
+    AXT_RT_AIO_INVALID_VALUE,
+    AXT_RT_BAD_PARAMETER,
+    AXT_RT_DATA_FLASH_BUSY,
+    AXT_RT_DIO_INVALID_MODULE_NO,
+    AXT_RT_DIO_INVALID_OFFSET_NO,
+    AXT_RT_DIO_INVALID_VALUE,
+    AXT_RT_INVALID_BOARD_NO,
+    AXT_RT_MOTION_ERROR_IN_ALARM,
+    AXT_RT_MOTION_ERROR_IN_MOTION,
+    AXT_RT_MOTION_HOME_SEARCHING,
+    AXT_RT_MOTION_INVALID_AXIS_NO,
+    AXT_RT_MOTION_INVALID_METHOD,
+    AXT_RT_MOTION_INVALID_FILE_LOAD,
+    AXT_RT_MOTION_INVALID_FILE_SAVE,
+    AXT_RT_MOTION_INVALID_VELOCITY,
+    AXT_RT_NOT_OPEN,
+    AXT_RT_OPEN_ALREADY,
+    AXT_RT_SUCCESS,
+)
+
+# Call latency classes
+CALL_OPEN = "open"
+CALL_STATUS = "status"
+CALL_COMMAND = "command"
+CALL_MOTION = "motion"
+CALL_IO = "io"
+CALL_FILE = "file"
+
+SIM_LIB_VERSION = "Sim 4.5.0"
+SIM_LOOPBACK_DELAY = 0.5e-3  # Default output-to-input delay of a wired loopback (s)
+LOOPBACK_DIO = "dio"  # Loopback endpoint on a DIO module: (LOOPBACK_DIO, module, offset)
+LOOPBACK_AXIS = "axis"  # Endpoint on an axis universal IO: (LOOPBACK_AXIS, axis, bit)
+SIM_AXIS_MODULE_ID = 0xC3  # Module ID reported by AxmInfoGetAxis
+SIM_AO_DIGIT_MAX = 0xFFFF  # 16-bit DAC
+SIM_HOME_SEARCH_SPAN = 2000.0  # Distance covered at the second home velocity (unit)
+SIM_LOAD_RATIO_PER_NEWTON = 0.05  # Reference torque load ratio (%) per newton of axial force
+SIM_FRICTION_LOAD_RATIO = 1.5  # Coulomb friction load ratio (%) while moving
+
+
+@dataclass
+class LatencyModel:
+    """Per-call driver latency (seconds) by call class"""
+
+    open: float = 0.25  # AxlOpen board scan
+    status: float = 15e-6  # Memory-mapped status reads
+    command: float = 40e-6  # Parameter/signal writes
+    motion: float = 0.9e-3  # Motion starts wait for the next SIIIH cycle (0.888 ms)
+    io: float = 20e-6  # DIO bit/byte access
+    file: float = 0.12  # AxmMotLoadParaAll / SaveParaAll
+    jitter: float = 0.1  # Relative uniform jitter
+
+    @classmethod
+    def zero(cls) -> "LatencyModel":
+        """No latency - for functional tests"""
+        return cls(open=0.0, status=0.0, command=0.0, motion=0.0, io=0.0, file=0.0, jitter=0.0)
+
+    def delay(self, kind: str) -> float:
+        base = getattr(self, kind)
+        if base <= 0:
+            return 0.0
+        return base * (1.0 + random.uniform(-self.jitter, self.jitter))
+
+
+class _Profile:
+    """Piecewise constant-acceleration motion from (p0, v0) at t0"""
+
+    def __init__(self, t0: float, p0: float, v0: float, phases: List[Tuple[float, float]]):
+        self.t0 = t0
+        self.p0 = p0
+        self.v0 = v0
+        self.phases = phases  # (duration, signed acceleration)
+        self.duration = sum(d for d, _ in phases)
+
+    def state(self, t: float) -> Tuple[float, float, bool]:
+        """(position, velocity, finished) at profile time t"""
+        elapsed = max(0.0, t - self.t0)
+        p, v = self.p0, self.v0
+        for duration, accel in self.phases:
+            dt = min(elapsed, duration)
+            if math.isinf(dt):
+                dt = elapsed
+            p += v * dt + 0.5 * accel * dt * dt
+            v += accel * dt
+            elapsed -= dt
+            if elapsed <= 0:
+                break
+        return p, v, t - self.t0 >= self.duration
+
+
+def _trapezoid(
+    distance: float, vel: float, accel: float, decel: float
+) -> List[Tuple[float, float]]:
+    """Phases of a rest-to-rest move over a signed distance"""
+    d = abs(distance)
+    if d == 0:
+        return []
+    sign = 1.0 if distance > 0 else -1.0
+    d_acc = vel * vel / (2 * accel)
+    d_dec = vel * vel / (2 * decel)
+    if d_acc + d_dec > d:
+        vel = math.sqrt(2 * d * accel * decel / (accel + decel))
+        d_acc = vel * vel / (2 * accel)
+        d_dec = vel * vel / (2 * decel)
+    t_flat = (d - d_acc - d_dec) / vel
+    return [(vel / accel, sign * accel), (t_flat, 0.0), (vel / decel, -sign * decel)]
+
+
+@dataclass
+class _SimAxis:
+    """Simulated servo axis"""
+
+    servo_on: bool = False
+    alarm: bool = False
+    position: float = 0.0
+    act_offset: float = 0.0  # act_pos - cmd_pos after AxmStatusSetActPos
+    following_lag: float = 0.0  # Position loop lag: act_pos trails by velocity x lag (s)
+    profile: Optional[_Profile] = None
+    homing: bool = False
+    home_result: int = HOME_SUCCESS
+    pos_limit: bool = False
+    neg_limit: bool = False
+    override_max_vel: float = 0.0
+    torque_limit: Tuple[float, float] = (300.0, 300.0)  # Not part of the .mot file
+    jerk: Tuple[float, float] = (0.0, 0.0)  # S-curve accel/decel jerk (%), not simulated
+    backlash: Tuple[int, float] = (0, 0.0)
+    backlash_enabled: bool = False
+    external_force: float = 0.0  # Axial load on the axis (N), see set_external_force()
+    dut: Optional[DUTPlant] = None  # Device under test in the axis path, see attach_dut()
+    load_ratio_mon: int = 0  # AxmStatusSetReadServoLoadRatio selection
+    universal_inputs: int = 0  # AxmSignalReadInput bits
+    universal_outputs: int = 0  # AxmSignalWriteOutput bits
+    trigger_positions: List[float] = field(default_factory=list)  # AxmTriggerOnlyAbs
+    torque_at_pos: Dict[float, Tuple[float, float, int]] = field(default_factory=dict)
+
+    # Parameters (AxmMot*/AxmSignal*/AxmHome* and .mot file)
+    params: Dict[str, float] = field(
+        default_factory=lambda: {
+            "PULSE_OUT_METHOD": 4,
+            "INPOSITION": 2,
+            "ALARM": 1,
+            "MIN_VELOCITY": 1.0,
+            "MAX_VELOCITY": 700000.0,
+            "MOVE_PULSE": 1.0,
+            "MOVE_UNIT": 1.0,
+            "INIT_ABSRELMODE": POS_ABS,
+            "INIT_PROFILEMODE": 0,
+            "MOVE_ACC_UNIT": 0,
+            "HOME_DIR": 0,
+            "HOME_LEVEL": 1,
+            "HOME_SIGNAL": 4,
+            "ZPHASE_USE": 0,
+            "HOME_FIRST_VELOCITY": 10000.0,
+            "HOME_SECOND_VELOCITY": 2000.0,
+            "HOME_THIRD_VELOCITY": 1000.0,
+            "HOME_LAST_VELOCITY": 1000.0,
+            "HOME_FIRST_ACCEL": 40000.0,
+            "HOME_SECOND_ACCEL": 20000.0,
+            "HOME_END_CLEAR_TIME": 1000.0,
+            "HOME_END_OFFSET": 0.0,
+            "POS_END_LIMIT": 0,
+            "NEG_END_LIMIT": 0,
+            "END_LIMIT_STOP_MODE": 0,
+            "NEG_SOFT_LIMIT": -134217728.0,
+            "POS_SOFT_LIMIT": 134217727.0,
+            "SOFT_LIMIT_SEL": 0,
+            "SOFT_LIMIT_STOP_MODE": 0,
+            "SOFT_LIMIT_ENABLE": 0,
+        }
+    )
+
+
+@dataclass
+class _SimModule:
+    """Simulated DIO module"""
+
+    module_id: int
+    inputs: int
+    outputs: int
+    input_bits: int = 0
+    output_bits: int = 0
+    input_levels: int = 0xFFFFFFFF  # 1 = active high
+    output_levels: int = 0xFFFFFFFF
+    interrupt_enabled: bool = False
+    rising_edges: int = 0  # Input bits interrupting on a rising edge
+    falling_edges: int = 0  # Input bits interrupting on a falling edge
+
+
+@dataclass
+class _Loopback:
+    """Output bit wired back to an input bit"""
+
+    output: Tuple[str, int, int]
+    input: Tuple[str, int, int]
+    delay: float
+    level: Optional[bool] = None  # Last level sent down the wire
+
+
+@dataclass
+class _SimAnalogOut:
+    """Simulated analog output channel"""
+
+    volt: float = 0.0
+    min_volt: float = -10.0
+    max_volt: float = 10.0
+
+
+def _ffi(kind: str) -> Callable:
+    """Mark a method as a library entry point (latency + call accounting)"""
+
+    def decorator(func: Callable) -> Callable:
+        name = func.__name__
+
+        @functools.wraps(func)
+        def wrapper(self: "SimulatedAXL", *args: Any) -> Any:
+            self._charge(name, kind)
+            with self._lock:
+                return func(self, *args)
+
+        return wrapper
+
+    return decorator
+
+
+def _val(arg: Any) -> Any:
+    """Plain value of a number or ctypes scalar"""
+    return getattr(arg, "value", arg)
+
+
+def _out(ref: Any, value: Any) -> None:
+    """Write through a byref() or pointer argument"""
+    target = getattr(ref, "_obj", None)
+    if target is None:
+        target = ref.contents if hasattr(ref, "contents") else ref
+    if isinstance(target.value, int):
+        value = int(value)  # .mot values are parsed as floats
+    target.value = value
+
+
+def _interrupt_flag(offset: int) -> int:
+    """DWORD interrupt flag of an input: its bit within the offset's 32-point group"""
+    return 1 << offset % SCAN_DWORD_BITS
+
+
+class SimulatedAXL:
+    """AXL.dll 시뮬레이터"""
+
+    def __init__(
+        self,
+        axis_count: int = 2,
+        dio_modules: Optional[Sequence[Tuple[int, int, int]]] = None,
+        latency: Optional[LatencyModel] = None,
+        time_scale: float = 1.0,
+        ao_channels: int = 4,
+        ai_channels: int = 4,
+        board_count: int = 1,
+    ):
+        """
+        초기화
+
+        Args:
+            axis_count: Number of simulated servo axes
+            dio_modules: (module_id, input count, output count) per DIO module
+            latency: Call latency model (None = LatencyModel defaults)
+            ao_channels: Number of analog output channels
+            ai_channels: Number of analog input channels
+            time_scale: Motion/homing speed-up factor (call latencies are not scaled)
+            board_count: Boards the axes and DIO modules are split across (in order)
+        """
+        if dio_modules is None:
+            dio_modules = [(MODULE_ID_SIO_DI16, 16, 0), (MODULE_ID_SIO_DO16, 0, 16)]
+
+        self.latency = latency or LatencyModel()
+        self.time_scale = time_scale
+        self.board_count = board_count
+
+        self._axes = [_SimAxis() for _ in range(axis_count)]
+        self._modules = [_SimModule(mid, ins, outs) for mid, ins, outs in dio_modules]
+        self._analog_outputs = [_SimAnalogOut() for _ in range(ao_channels)]
+        self._analog_inputs = [0.0] * ai_channels
+        self._seq_maps: Dict[int, List[int]] = {}
+        self._seq_nodes: Dict[int, List[Tuple[float, ...]]] = {}
+        self._seq_building: Dict[int, List[Tuple[float, ...]]] = {}
+        # (module, table) -> [(x, y, pulses, interval)]
+        self._counter_triggers: Dict[Tuple[int, int], List[Tuple[float, ...]]] = {}
+        self._flash = [
+            bytearray(b"\xff" * DATA_FLASH_PAGE_COUNT * DATA_FLASH_PAGE_SIZE)
+            for _ in range(board_count)
+        ]
+        self._flash_wear = [[0] * DATA_FLASH_PAGE_COUNT for _ in range(board_count)]
+        self._flash_ready = [0.0] * board_count
+        self._interrupt_procs: Dict[int, Any] = {}
+        self._last_interrupt = (0, 0)
+        self._loopbacks: List[_Loopback] = []
+        self.flash_write_time = DATA_FLASH_WRITE_TIME
+        self._opened = False
+        self._lock = threading.RLock()
+
+        self._counts: Counter = Counter()
+        self._driver_time = 0.0
+        self._count_lock = threading.Lock()
+
+    # ========================================================================
+    # Accounting
+    # ========================================================================
+
+    def _charge(self, name: str, kind: str) -> None:
+        delay = self.latency.delay(kind)
+        with self._count_lock:
+            self._counts[name] += 1
+            self._driver_time += delay
+        if delay >= 1e-3:
+            time.sleep(delay)
+        elif delay > 0:
+            end = time.perf_counter() + delay
+            while time.perf_counter() < end:
+                pass
+
+    @property
+    def call_counts(self) -> Dict[str, int]:
+        with self._count_lock:
+            return dict(self._counts)
+
+    @property
+    def total_calls(self) -> int:
+        with self._count_lock:
+            return sum(self._counts.values())
+
+    @property
+    def driver_time(self) -> float:
+        """Accumulated simulated call latency (s)"""
+        return self._driver_time
+
+    def reset_counters(self) -> None:
+        with self._count_lock:
+            self._counts.clear()
+            self._driver_time = 0.0
+
+    # ========================================================================
+    # Test Hooks
+    # ========================================================================
+
+    def set_input(self, module_no: int, offset: int, value: bool) -> None:
+        """Drive a raw input bit (fires the module interrupt on an enabled edge)"""
+        with self._lock:
+            proc = self._drive_input(module_no, offset, value)
+        if proc is not None:
+            proc(module_no, _interrupt_flag(offset))
+
+    def wire_loopback(
+        self,
+        output: Tuple[str, int, int],
+        input: Tuple[str, int, int],
+        delay: float = SIM_LOOPBACK_DELAY,
+    ) -> None:
+        """Copy an output bit to an input bit after delay (LOOPBACK_DIO / LOOPBACK_AXIS ends)"""
+        with self._lock:
+            wire = _Loopback(tuple(output), tuple(input), delay)
+            wire.level = self._loopback_output(wire.output)
+            self._loopback_input(wire.input, wire.level)  # Cable connects without delay
+            self._loopbacks.append(wire)
+
+    def get_output(self, module_no: int, offset: int) -> bool:
+        """Raw output bit as written by the application"""
+        with self._lock:
+            return bool(self._modules[module_no].output_bits >> offset & 1)
+
+    def inject_alarm(self, axis_no: int, alarm: bool = True) -> None:
+        """Raise or clear a servo amplifier alarm (servo drops out, motion stops)"""
+        with self._lock:
+            axis = self._axes[axis_no]
+            axis.alarm = alarm
+            if alarm:
+                self._halt(axis)
+                axis.servo_on = False
+                if axis.homing:
+                    axis.homing = False
+                    axis.home_result = HOME_ERR_AMP_FAULT
+
+    def get_flash_wear(self, board_no: int = 0) -> List[int]:
+        """Writes per data flash page of a board"""
+        with self._lock:
+            return list(self._flash_wear[board_no])
+
+    def corrupt_flash(self, board_no: int, page_addr: int, offset: int) -> None:
+        """Flip the bits of one data flash byte (a torn or decayed write)"""
+        with self._lock:
+            self._flash[board_no][page_addr * DATA_FLASH_PAGE_SIZE + offset] ^= 0xFF
+
+    def get_axis_param(self, axis_no: int, key: str) -> float:
+        with self._lock:
+            return self._axes[axis_no].params[key]
+
+    def set_universal_input(self, axis_no: int, bit: int, value: bool) -> None:
+        """Drive a universal input bit of an axis"""
+        with self._lock:
+            axis = self._axes[axis_no]
+            if value:
+                axis.universal_inputs |= 1 << bit
+            else:
+                axis.universal_inputs &= ~(1 << bit)
+
+    def set_analog_input(self, channel_no: int, volts: float) -> None:
+        """Drive an analog input channel"""
+        with self._lock:
+            self._analog_inputs[channel_no] = volts
+
+    def set_following_lag(self, axis_no: int, lag: float) -> None:
+        """Let the actual position trail the command by velocity x lag (s)"""
+        with self._lock:
+            self._axes[axis_no].following_lag = lag
+
+    def set_external_force(self, axis_no: int, force: float) -> None:
+        """Apply an axial load (N) that shows up in the servo load ratio"""
+        with self._lock:
+            self._axes[axis_no].external_force = force
+
+    def attach_dut(
+        self,
+        axis_no: int,
+        model: DUTModel,
+        temperature: Optional[float] = None,
+        seed: int = 0,
+    ) -> DUTPlant:
+        """Put a DUT in the path of an axis; its reaction force loads the servo"""
+        plant = DUTPlant(model, temperature=temperature, seed=seed)
+        with self._lock:
+            self._axes[axis_no].dut = plant
+        return plant
+
+    def detach_dut(self, axis_no: int) -> None:
+        with self._lock:
+            self._axes[axis_no].dut = None
+
+    def set_dut_temperature(self, axis_no: int, temperature: float) -> None:
+        """Change the DUT temperature (scales its stiffness)"""
+        with self._lock:
+            plant = self._axes[axis_no].dut
+            if plant is None:
+                raise ValueError(f"No DUT attached to axis {axis_no}")
+            plant.temperature = temperature
+
+    def read_loadcell(self, axis_no: int) -> float:
+        """Loadcell stand-in: DUT force at the current axis position, with noise (N)"""
+        with self._lock:
+            axis = self._axes[axis_no]
+            if axis.dut is None:
+                return 0.0
+            position, _ = self._update(axis)
+            return axis.dut.loadcell(position)
+
+    def get_seq_nodes(self, seq_map_no: int) -> List[Tuple[float, ...]]:
+        """Nodes committed with AxmSeqEndNode: positions, then vel, acc, dec, next vel"""
+        with self._lock:
+            return list(self._seq_nodes.get(seq_map_no, []))
+
+    def get_trigger_positions(self, axis_no: int) -> List[float]:
+        with self._lock:
+            return list(self._axes[axis_no].trigger_positions)
+
+    def get_torque_at_pos(self, axis_no: int) -> Dict[float, Tuple[float, float, int]]:
+        """Torque limit switch points: position -> (plus, minus, target)"""
+        with self._lock:
+            return dict(self._axes[axis_no].torque_at_pos)
+
+    def get_counter_triggers(
+        self, module_no: int, table_pos: int = 0
+    ) -> List[Tuple[float, ...]]:
+        """Counter table trigger points: (x, y, pulses, interval)"""
+        with self._lock:
+            return list(self._counter_triggers.get((module_no, table_pos), []))
+
+    def get_analog_output(self, channel_no: int) -> float:
+        """Voltage currently driven on an analog output channel"""
+        with self._lock:
+            return self._analog_outputs[channel_no].volt
+
+    # ========================================================================
+    # Internal Motion Model
+    # ========================================================================
+
+    def _now(self) -> float:
+        return time.monotonic() * self.time_scale
+
+    def _axis(self, axis_no: Any) -> Optional[_SimAxis]:
+        axis_no = _val(axis_no)
+        if 0 <= axis_no < len(self._axes):
+            return self._axes[axis_no]
+        return None
+
+    def _update(self, axis: _SimAxis) -> Tuple[float, float]:
+        """Advance an axis to now and return (position, velocity)"""
+        if axis.profile is None:
+            return axis.position, 0.0
+        p, v, done = axis.profile.state(self._now())
+        if done:
+            axis.position = p
+            axis.profile = None
+            if axis.homing:
+                axis.homing = False
+                axis.home_result = HOME_SUCCESS
+                axis.position = axis.params["HOME_END_OFFSET"]
+                axis.act_offset = 0.0
+            return axis.position, 0.0
+        return p, v
+
+    def _act_pos(self, axis: _SimAxis) -> float:
+        position, velocity = self._update(axis)
+        return position + axis.act_offset - velocity * axis.following_lag
+
+    def _halt(self, axis: _SimAxis) -> None:
+        axis.position, _ = self._update(axis)
+        axis.profile = None
+
+    def _accels(
+        self, axis: _SimAxis, vel: float, accel: float, decel: float
+    ) -> Tuple[float, float]:
+        if axis.params["MOVE_ACC_UNIT"] == ACCEL_UNIT_SEC:
+            accel = vel / accel if accel > 0 else math.inf
+            decel = vel / decel if decel > 0 else math.inf
+        return accel, decel
+
+    def _start_move(self, axis: Optional[_SimAxis], target: float, vel, accel, decel) -> int:
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        vel, accel, decel = abs(_val(vel)), abs(_val(accel)), abs(_val(decel))
+        if vel <= 0 or accel <= 0 or decel <= 0:
+            return AXT_RT_MOTION_INVALID_VELOCITY
+        if axis.alarm:
+            return AXT_RT_MOTION_ERROR_IN_ALARM
+        if not axis.servo_on:
+            return AXT_RT_MOTION_INVALID_METHOD  # Drive not ready for motion
+        if axis.homing:
+            return AXT_RT_MOTION_HOME_SEARCHING
+        position, velocity = self._update(axis)
+        if velocity != 0.0:
+            return AXT_RT_MOTION_ERROR_IN_MOTION
+        vel = min(vel, axis.params["MAX_VELOCITY"])
+        accel, decel = self._accels(axis, vel, accel, decel)
+        if axis.params["INIT_ABSRELMODE"] != POS_ABS:
+            target = position + target
+        axis.position = position
+        phases = _trapezoid(target - position, vel, accel, decel)
+        axis.profile = _Profile(self._now(), position, 0.0, phases)
+        return AXT_RT_SUCCESS
+
+    def _start_vel(self, axis: Optional[_SimAxis], vel, accel, decel) -> int:
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        vel, accel = _val(vel), abs(_val(accel))
+        if axis.alarm:
+            return AXT_RT_MOTION_ERROR_IN_ALARM
+        if not axis.servo_on:
+            return AXT_RT_MOTION_INVALID_METHOD
+        if accel <= 0:
+            return AXT_RT_MOTION_INVALID_VELOCITY
+        position, velocity = self._update(axis)
+        accel, _ = self._accels(axis, abs(vel), accel, abs(_val(decel)) or accel)
+        dv = vel - velocity
+        phases = [(abs(dv) / accel, math.copysign(accel, dv)), (math.inf, 0.0)]
+        axis.profile = _Profile(self._now(), position, velocity, phases)
+        return AXT_RT_SUCCESS
+
+    def _decel_stop(self, axis: Optional[_SimAxis], decel: float) -> int:
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        position, velocity = self._update(axis)
+        if velocity == 0.0 or decel <= 0 or math.isinf(decel):
+            axis.position = position
+            axis.profile = None
+        else:
+            phases = [(abs(velocity) / decel, -math.copysign(decel, velocity))]
+            axis.profile = _Profile(self._now(), position, velocity, phases)
+        if axis.homing:
+            axis.homing = False
+            axis.home_result = HOME_ERR_USER_BREAK
+        return AXT_RT_SUCCESS
+
+    # ========================================================================
+    # Library (Axl*)
+    # ========================================================================
+
+    @_ffi(CALL_OPEN)
+    def AxlOpen(self, irq_no: Any) -> int:  # noqa: N802
+        if self._opened:
+            return AXT_RT_OPEN_ALREADY
+        self._opened = True
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxlClose(self) -> int:  # noqa: N802
+        self._opened = False
+        return 1  # TRUE
+
+    @_ffi(CALL_STATUS)
+    def AxlIsOpened(self) -> int:  # noqa: N802
+        return 1 if self._opened else 0
+
+    @_ffi(CALL_STATUS)
+    def AxlGetBoardCount(self, count) -> int:  # noqa: N802
+        _out(count, self.board_count)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxlGetLibVersion(self, buffer) -> int:  # noqa: N802
+        buffer.value = SIM_LIB_VERSION.encode("ascii")
+        return AXT_RT_SUCCESS
+
+    def _flash_span(self, board_no, page_addr, count) -> Tuple[int, int, slice]:
+        """(result, board, byte span) of a data flash access"""
+        board, page, n = _val(board_no), _val(page_addr), _val(count)
+        if not 0 <= board < self.board_count:
+            return AXT_RT_INVALID_BOARD_NO, board, slice(0)
+        if not (0 <= page < DATA_FLASH_PAGE_COUNT and 1 <= n <= DATA_FLASH_PAGE_SIZE):
+            return AXT_RT_BAD_PARAMETER, board, slice(0)
+        start = page * DATA_FLASH_PAGE_SIZE
+        return AXT_RT_SUCCESS, board, slice(start, start + n)
+
+    @_ffi(CALL_COMMAND)
+    def AxlSetDataFlash(self, board_no, page_addr, count, data) -> int:  # noqa: N802
+        result, board, span = self._flash_span(board_no, page_addr, count)
+        if result != AXT_RT_SUCCESS:
+            return result
+        now = time.perf_counter()
+        if now < self._flash_ready[board]:
+            return AXT_RT_DATA_FLASH_BUSY
+        self._flash[board][span] = bytes(data)[: _val(count)]
+        self._flash_wear[board][_val(page_addr)] += 1
+        self._flash_ready[board] = now + self.flash_write_time
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxlGetDataFlash(self, board_no, page_addr, count, data) -> int:  # noqa: N802
+        result, board, span = self._flash_span(board_no, page_addr, count)
+        if result != AXT_RT_SUCCESS:
+            return result
+        data[: _val(count)] = self._flash[board][span]
+        return AXT_RT_SUCCESS
+
+    # ========================================================================
+    # Motion Info / Parameters (AxmInfo*, AxmMot*)
+    # ========================================================================
+
+    @_ffi(CALL_STATUS)
+    def AxmInfoGetAxisCount(self, count) -> int:  # noqa: N802
+        if not self._opened:
+            return AXT_RT_NOT_OPEN
+        _out(count, len(self._axes))
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmInfoGetAxis(self, axis_no, board_no, module_pos, module_id) -> int:  # noqa: N802
+        if self._axis(axis_no) is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        board, position = self._board_of(_val(axis_no), len(self._axes))
+        _out(board_no, board)
+        _out(module_pos, position)
+        _out(module_id, SIM_AXIS_MODULE_ID)
+        return AXT_RT_SUCCESS
+
+    def _board_of(self, index: int, total: int) -> Tuple[int, int]:
+        """(board, position on the board) of the index-th of total devices"""
+        board = index * self.board_count // max(total, 1)
+        first = -(-board * total // self.board_count)  # ceil
+        return board, index - first
+
+    def _set_param(self, axis_no, key: str, value) -> int:
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        axis.params[key] = _val(value)
+        return AXT_RT_SUCCESS
+
+    def _get_param(self, axis_no, key: str, out) -> int:
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        _out(out, axis.params[key])
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmMotSetPulseOutMethod(self, axis_no, method) -> int:  # noqa: N802
+        return self._set_param(axis_no, "PULSE_OUT_METHOD", method)
+
+    @_ffi(CALL_STATUS)
+    def AxmMotGetPulseOutMethod(self, axis_no, method) -> int:  # noqa: N802
+        return self._get_param(axis_no, "PULSE_OUT_METHOD", method)
+
+    @_ffi(CALL_COMMAND)
+    def AxmMotSetMoveUnitPerPulse(self, axis_no, unit, pulse) -> int:  # noqa: N802
+        result = self._set_param(axis_no, "MOVE_UNIT", unit)
+        return result or self._set_param(axis_no, "MOVE_PULSE", pulse)
+
+    @_ffi(CALL_STATUS)
+    def AxmMotGetMoveUnitPerPulse(self, axis_no, unit, pulse) -> int:  # noqa: N802
+        result = self._get_param(axis_no, "MOVE_UNIT", unit)
+        return result or self._get_param(axis_no, "MOVE_PULSE", pulse)
+
+    @_ffi(CALL_COMMAND)
+    def AxmMotSetAbsRelMode(self, axis_no, mode) -> int:  # noqa: N802
+        return self._set_param(axis_no, "INIT_ABSRELMODE", mode)
+
+    @_ffi(CALL_STATUS)
+    def AxmMotGetAbsRelMode(self, axis_no, mode) -> int:  # noqa: N802
+        return self._get_param(axis_no, "INIT_ABSRELMODE", mode)
+
+    @_ffi(CALL_COMMAND)
+    def AxmMotSetMaxVel(self, axis_no, max_vel) -> int:  # noqa: N802
+        return self._set_param(axis_no, "MAX_VELOCITY", max_vel)
+
+    @_ffi(CALL_STATUS)
+    def AxmMotGetMaxVel(self, axis_no, max_vel) -> int:  # noqa: N802
+        return self._get_param(axis_no, "MAX_VELOCITY", max_vel)
+
+    @_ffi(CALL_COMMAND)
+    def AxmMotSetMinVel(self, axis_no, min_vel) -> int:  # noqa: N802
+        return self._set_param(axis_no, "MIN_VELOCITY", min_vel)
+
+    @_ffi(CALL_STATUS)
+    def AxmMotGetMinVel(self, axis_no, min_vel) -> int:  # noqa: N802
+        return self._get_param(axis_no, "MIN_VELOCITY", min_vel)
+
+    @_ffi(CALL_COMMAND)
+    def AxmMotSetAccelUnit(self, axis_no, unit) -> int:  # noqa: N802
+        return self._set_param(axis_no, "MOVE_ACC_UNIT", unit)
+
+    @_ffi(CALL_STATUS)
+    def AxmMotGetAccelUnit(self, axis_no, unit) -> int:  # noqa: N802
+        return self._get_param(axis_no, "MOVE_ACC_UNIT", unit)
+
+    @_ffi(CALL_COMMAND)
+    def AxmMotSetProfileMode(self, axis_no, mode) -> int:  # noqa: N802
+        return self._set_param(axis_no, "INIT_PROFILEMODE", mode)
+
+    @_ffi(CALL_STATUS)
+    def AxmMotGetProfileMode(self, axis_no, mode) -> int:  # noqa: N802
+        return self._get_param(axis_no, "INIT_PROFILEMODE", mode)
+
+    @_ffi(CALL_COMMAND)
+    def AxmMotSetAccelJerk(self, axis_no, jerk) -> int:  # noqa: N802
+        return self._set_jerk(axis_no, 0, jerk)
+
+    @_ffi(CALL_STATUS)
+    def AxmMotGetAccelJerk(self, axis_no, jerk) -> int:  # noqa: N802
+        return self._get_jerk(axis_no, 0, jerk)
+
+    @_ffi(CALL_COMMAND)
+    def AxmMotSetDecelJerk(self, axis_no, jerk) -> int:  # noqa: N802
+        return self._set_jerk(axis_no, 1, jerk)
+
+    @_ffi(CALL_STATUS)
+    def AxmMotGetDecelJerk(self, axis_no, jerk) -> int:  # noqa: N802
+        return self._get_jerk(axis_no, 1, jerk)
+
+    def _set_jerk(self, axis_no: Any, index: int, jerk: Any) -> int:
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        value = _val(jerk)
+        if not 0.0 <= value <= 100.0:
+            return AXT_RT_MOTION_INVALID_METHOD
+        values = list(axis.jerk)
+        values[index] = value
+        axis.jerk = (values[0], values[1])
+        return AXT_RT_SUCCESS
+
+    def _get_jerk(self, axis_no: Any, index: int, jerk: Any) -> int:
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        _out(jerk, axis.jerk[index])
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_FILE)
+    def AxmMotLoadParaAll(self, file_path) -> int:  # noqa: N802
+        path = Path(bytes(_val(file_path)).decode("utf-8", errors="replace"))
+        try:
+            text = path.read_text(encoding="utf-8", errors="replace")
+        except OSError:
+            return AXT_RT_MOTION_INVALID_FILE_LOAD
+
+        axis: Optional[_SimAxis] = None
+        for line in text.splitlines():
+            if ":" not in line or "=" not in line or line.startswith("#"):
+                continue
+            key, value = line.split(":", 1)[1].split("=", 1)
+            key = key.strip().rstrip(".")
+            try:
+                number = float(value)
+            except ValueError:
+                continue
+            if key == "AXIS_NO":
+                axis = self._axis(int(number))
+            elif axis is not None:
+                axis.params[key] = number
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_FILE)
+    def AxmMotSaveParaAll(self, file_path) -> int:  # noqa: N802
+        path = Path(bytes(_val(file_path)).decode("utf-8", errors="replace"))
+        lines = ["### Motion Parameter File ####" + "=" * 55]
+        for axis_no, axis in enumerate(self._axes):
+            lines.append(f"00:{'AXIS_NO.':<20}={axis_no}")
+            for index, (key, value) in enumerate(sorted(axis.params.items()), start=1):
+                lines.append(f"{index:02d}:{key + '.':<20}={value:f}")
+            lines.append("#" + "=" * 55)
+        try:
+            path.write_text("\n".join(lines) + "\n", encoding="utf-8")
+        except OSError:
+            return AXT_RT_MOTION_INVALID_FILE_SAVE
+        return AXT_RT_SUCCESS
+
+    # ========================================================================
+    # Signals (AxmSignal*)
+    # ========================================================================
+
+    @_ffi(CALL_COMMAND)
+    def AxmSignalServoOn(self, axis_no, on_off) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        on = _val(on_off) == SERVO_ON
+        if not on:
+            self._halt(axis)
+        axis.servo_on = on and not axis.alarm
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmSignalIsServoOn(self, axis_no, status) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        _out(status, 1 if axis.servo_on else 0)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmSignalReadServoAlarm(self, axis_no, status) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        _out(status, 1 if axis.alarm else 0)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_IO)
+    def AxmSignalReadInput(self, axis_no, value) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        _out(value, axis.universal_inputs)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_IO)
+    def AxmSignalReadOutput(self, axis_no, value) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        _out(value, axis.universal_outputs)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_IO)
+    def AxmSignalWriteOutput(self, axis_no, value) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        axis.universal_outputs = _val(value)
+        self._propagate_loopbacks()
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_IO)
+    def AxmSignalWriteOutputBit(self, axis_no, bit_no, on_off) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        if _val(on_off):
+            axis.universal_outputs |= 1 << _val(bit_no)
+        else:
+            axis.universal_outputs &= ~(1 << _val(bit_no))
+        self._propagate_loopbacks()
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_IO)
+    def AxmSignalReadInputBit(self, axis_no, bit_no, value) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        _out(value, axis.universal_inputs >> _val(bit_no) & 1)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmSignalServoAlarmReset(self, axis_no, on_off) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        if _val(on_off):
+            axis.alarm = False
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmSignalReadLimit(self, axis_no, pos_limit, neg_limit) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        _out(pos_limit, 1 if axis.pos_limit else 0)
+        _out(neg_limit, 1 if axis.neg_limit else 0)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmSignalSetLimit(self, axis_no, stop_mode, pos_level, neg_level) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        axis.params["END_LIMIT_STOP_MODE"] = _val(stop_mode)
+        axis.params["POS_END_LIMIT"] = _val(pos_level)
+        axis.params["NEG_END_LIMIT"] = _val(neg_level)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmSignalGetLimit(self, axis_no, stop_mode, pos_level, neg_level) -> int:  # noqa: N802
+        result = self._get_param(axis_no, "END_LIMIT_STOP_MODE", stop_mode)
+        result = result or self._get_param(axis_no, "POS_END_LIMIT", pos_level)
+        return result or self._get_param(axis_no, "NEG_END_LIMIT", neg_level)
+
+    @_ffi(CALL_COMMAND)
+    def AxmSignalSetSoftLimit(  # noqa: N802
+        self, axis_no, use, stop_mode, selection, pos_pos, neg_pos
+    ) -> int:
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        axis.params["SOFT_LIMIT_ENABLE"] = _val(use)
+        axis.params["SOFT_LIMIT_STOP_MODE"] = _val(stop_mode)
+        axis.params["SOFT_LIMIT_SEL"] = _val(selection)
+        axis.params["POS_SOFT_LIMIT"] = _val(pos_pos)
+        axis.params["NEG_SOFT_LIMIT"] = _val(neg_pos)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmSignalGetSoftLimit(  # noqa: N802
+        self, axis_no, use, stop_mode, selection, pos_pos, neg_pos
+    ) -> int:
+        result = self._get_param(axis_no, "SOFT_LIMIT_ENABLE", use)
+        result = result or self._get_param(axis_no, "SOFT_LIMIT_STOP_MODE", stop_mode)
+        result = result or self._get_param(axis_no, "SOFT_LIMIT_SEL", selection)
+        result = result or self._get_param(axis_no, "POS_SOFT_LIMIT", pos_pos)
+        return result or self._get_param(axis_no, "NEG_SOFT_LIMIT", neg_pos)
+
+    @_ffi(CALL_COMMAND)
+    def AxmSignalSetInpos(self, axis_no, use) -> int:  # noqa: N802
+        return self._set_param(axis_no, "INPOSITION", use)
+
+    @_ffi(CALL_STATUS)
+    def AxmSignalGetInpos(self, axis_no, use) -> int:  # noqa: N802
+        return self._get_param(axis_no, "INPOSITION", use)
+
+    @_ffi(CALL_COMMAND)
+    def AxmSignalSetServoAlarm(self, axis_no, use) -> int:  # noqa: N802
+        return self._set_param(axis_no, "ALARM", use)
+
+    @_ffi(CALL_STATUS)
+    def AxmSignalGetServoAlarm(self, axis_no, use) -> int:  # noqa: N802
+        return self._get_param(axis_no, "ALARM", use)
+
+    # ========================================================================
+    # Torque Limit and Compensation (AxmMotSetTorqueLimit, AxmCompensation*)
+    # ========================================================================
+
+    @_ffi(CALL_COMMAND)
+    def AxmMotSetTorqueLimit(self, axis_no, plus_limit, minus_limit) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        axis.torque_limit = (_val(plus_limit), _val(minus_limit))
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmMotGetTorqueLimit(self, axis_no, plus_limit, minus_limit) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        _out(plus_limit, axis.torque_limit[0])
+        _out(minus_limit, axis.torque_limit[1])
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmCompensationSetBacklash(self, axis_no, direction, backlash) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        axis.backlash = (_val(direction), _val(backlash))
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmCompensationGetBacklash(self, axis_no, direction, backlash) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        _out(direction, axis.backlash[0])
+        _out(backlash, axis.backlash[1])
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmCompensationEnableBacklash(self, axis_no, enable) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        axis.backlash_enabled = bool(_val(enable))
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmCompensationIsEnableBacklash(self, axis_no, enable) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        _out(enable, 1 if axis.backlash_enabled else 0)
+        return AXT_RT_SUCCESS
+
+    # ========================================================================
+    # Status (AxmStatus*)
+    # ========================================================================
+
+    @_ffi(CALL_STATUS)
+    def AxmStatusReadInMotion(self, axis_no, status) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        self._update(axis)
+        _out(status, 1 if axis.profile is not None else 0)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmStatusGetCmdPos(self, axis_no, position) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        _out(position, self._update(axis)[0])
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmStatusGetActPos(self, axis_no, position) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        _out(position, self._act_pos(axis))
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmStatusReadMotionInfo(self, axis_no, info) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        info = getattr(info, "_obj", info)
+        mask = info.dwMask
+        position, _ = self._update(axis)
+        if mask & MOTION_INFO_CMD_POS:
+            info.dCmdPos = position
+        if mask & MOTION_INFO_ACT_POS:
+            info.dActPos = self._act_pos(axis)
+        if mask & MOTION_INFO_MECH_SIG:
+            info.dwMechSig = (
+                (MECH_SIG_PELM if axis.pos_limit else 0)
+                | (MECH_SIG_NELM if axis.neg_limit else 0)
+                | (MECH_SIG_ALARM if axis.alarm else 0)
+                | (MECH_SIG_INPOS if axis.profile is None else 0)
+            )
+        if mask & MOTION_INFO_UNIV_IO:
+            info.dwInput = axis.universal_inputs
+            info.dwOutput = axis.universal_outputs
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmStatusSetCmdPos(self, axis_no, position) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        self._halt(axis)
+        axis.act_offset += axis.position - _val(position)
+        axis.position = _val(position)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmStatusSetActPos(self, axis_no, position) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        axis.act_offset = _val(position) - self._update(axis)[0]
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmStatusReadVel(self, axis_no, velocity) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        _out(velocity, self._update(axis)[1])
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmStatusSetReadServoLoadRatio(self, axis_no, sel_mon) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        axis.load_ratio_mon = _val(sel_mon)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmStatusReadServoLoadRatio(self, axis_no, ratio) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        # Reference torque: axial load (external and DUT reaction) plus Coulomb friction
+        # against the direction of travel
+        position, velocity = self._update(axis)
+        force = axis.external_force
+        if axis.dut is not None:
+            force += axis.dut.model.direction * axis.dut.force(position)
+        load = force * SIM_LOAD_RATIO_PER_NEWTON if axis.servo_on else 0.0
+        if velocity != 0.0:
+            load += math.copysign(SIM_FRICTION_LOAD_RATIO, velocity)
+        _out(ratio, load)
+        return AXT_RT_SUCCESS
+
+    # ========================================================================
+    # Motion (AxmMove*, AxmOverride*)
+    # ========================================================================
+
+    @_ffi(CALL_MOTION)
+    def AxmMoveStartPos(self, axis_no, position, vel, accel, decel) -> int:  # noqa: N802
+        return self._start_move(self._axis(axis_no), _val(position), vel, accel, decel)
+
+    @_ffi(CALL_MOTION)
+    def AxmMoveVel(self, axis_no, vel, accel, decel) -> int:  # noqa: N802
+        return self._start_vel(self._axis(axis_no), vel, accel, decel)
+
+    @_ffi(CALL_COMMAND)
+    def AxmMoveStop(self, axis_no, decel) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        _, decel = self._accels(axis, abs(self._update(axis)[1]) or 1.0, 1.0, abs(_val(decel)))
+        return self._decel_stop(axis, decel)
+
+    @_ffi(CALL_COMMAND)
+    def AxmMoveSStop(self, axis_no) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        return self._decel_stop(axis, axis.params["HOME_FIRST_ACCEL"])
+
+    @_ffi(CALL_COMMAND)
+    def AxmMoveEStop(self, axis_no) -> int:  # noqa: N802
+        return self._decel_stop(self._axis(axis_no), math.inf)
+
+    @_ffi(CALL_MOTION)
+    def AxmMoveMultiPos(self, count, axes, positions, vels, accels, decels) -> int:  # noqa: N802
+        for i in range(_val(count)):
+            result = self._start_move(
+                self._axis(axes[i]), positions[i], vels[i], accels[i], decels[i]
+            )
+            if result != AXT_RT_SUCCESS:
+                return result
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmMoveMultiStop(self, count, axes, decels) -> int:  # noqa: N802
+        for i in range(_val(count)):
+            self._decel_stop(self._axis(axes[i]), abs(decels[i]))
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmMoveMultiSStop(self, count, axes) -> int:  # noqa: N802
+        for i in range(_val(count)):
+            axis = self._axis(axes[i])
+            if axis is not None:
+                self._decel_stop(axis, axis.params["HOME_FIRST_ACCEL"])
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmMoveMultiEStop(self, count, axes) -> int:  # noqa: N802
+        for i in range(_val(count)):
+            self._decel_stop(self._axis(axes[i]), math.inf)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_MOTION)
+    def AxmMoveStartMultiVel(self, count, axes, vels, accels, decels) -> int:  # noqa: N802
+        for i in range(_val(count)):
+            result = self._start_vel(self._axis(axes[i]), vels[i], accels[i], decels[i])
+            if result != AXT_RT_SUCCESS:
+                return result
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_MOTION)
+    def AxmMoveStartMultiVelEx(  # noqa: N802
+        self, count, axes, vels, accels, decels, sync_mode
+    ) -> int:
+        return self.AxmMoveStartMultiVel.__wrapped__(self, count, axes, vels, accels, decels)
+
+    @_ffi(CALL_COMMAND)
+    def AxmOverrideSetMaxVel(self, axis_no, max_vel) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        axis.override_max_vel = _val(max_vel)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmOverrideMultiVel(self, count, axes, vels) -> int:  # noqa: N802
+        for i in range(_val(count)):
+            axis = self._axis(axes[i])
+            if axis is None:
+                return AXT_RT_MOTION_INVALID_AXIS_NO
+            _, velocity = self._update(axis)
+            if axis.profile is None or velocity == 0.0:
+                continue
+            accel = axis.params["HOME_FIRST_ACCEL"]
+            self._start_vel(axis, math.copysign(abs(vels[i]), velocity), accel, accel)
+        return AXT_RT_SUCCESS
+
+    # ========================================================================
+    # Homing (AxmHome*)
+    # ========================================================================
+
+    @_ffi(CALL_COMMAND)
+    def AxmHomeSetMethod(  # noqa: N802
+        self, axis_no, home_dir, signal, z_phase, clr_time, offset
+    ) -> int:
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        axis.params["HOME_DIR"] = _val(home_dir)
+        axis.params["HOME_SIGNAL"] = _val(signal)
+        axis.params["ZPHASE_USE"] = _val(z_phase)
+        axis.params["HOME_END_CLEAR_TIME"] = _val(clr_time)
+        axis.params["HOME_END_OFFSET"] = _val(offset)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmHomeGetMethod(  # noqa: N802
+        self, axis_no, home_dir, signal, z_phase, clr_time, offset
+    ) -> int:
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        p = axis.params
+        _out(home_dir, p["HOME_DIR"])
+        _out(signal, p["HOME_SIGNAL"])
+        _out(z_phase, p["ZPHASE_USE"])
+        _out(clr_time, p["HOME_END_CLEAR_TIME"])
+        _out(offset, p["HOME_END_OFFSET"])
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmHomeSetVel(self, axis_no, v1, v2, v3, v_last, acc1, acc2) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        axis.params["HOME_FIRST_VELOCITY"] = _val(v1)
+        axis.params["HOME_SECOND_VELOCITY"] = _val(v2)
+        axis.params["HOME_THIRD_VELOCITY"] = _val(v3)
+        axis.params["HOME_LAST_VELOCITY"] = _val(v_last)
+        axis.params["HOME_FIRST_ACCEL"] = _val(acc1)
+        axis.params["HOME_SECOND_ACCEL"] = _val(acc2)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmHomeGetVel(self, axis_no, v1, v2, v3, v_last, acc1, acc2) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        p = axis.params
+        _out(v1, p["HOME_FIRST_VELOCITY"])
+        _out(v2, p["HOME_SECOND_VELOCITY"])
+        _out(v3, p["HOME_THIRD_VELOCITY"])
+        _out(v_last, p["HOME_LAST_VELOCITY"])
+        _out(acc1, p["HOME_FIRST_ACCEL"])
+        _out(acc2, p["HOME_SECOND_ACCEL"])
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_MOTION)
+    def AxmHomeSetStart(self, axis_no) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        if not axis.servo_on or axis.alarm:
+            axis.home_result = HOME_ERR_AMP_FAULT
+            return AXT_RT_SUCCESS
+        position, velocity = self._update(axis)
+        if velocity != 0.0:
+            return AXT_RT_MOTION_ERROR_IN_MOTION
+
+        # Fast approach to the sensor, slow search over the sensor span, then
+        # the end-clear dwell (HOME_END_CLEAR_TIME is in ms)
+        p = axis.params
+        phases = _trapezoid(
+            -position, p["HOME_FIRST_VELOCITY"], p["HOME_FIRST_ACCEL"], p["HOME_FIRST_ACCEL"]
+        )
+        search_time = SIM_HOME_SEARCH_SPAN / max(p["HOME_SECOND_VELOCITY"], 1.0)
+        phases += [(search_time, 0.0), (p["HOME_END_CLEAR_TIME"] / 1000.0, 0.0)]
+        axis.profile = _Profile(self._now(), position, 0.0, phases)
+        axis.homing = True
+        axis.home_result = HOME_SEARCHING
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmHomeGetResult(self, axis_no, result) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        self._update(axis)
+        _out(result, axis.home_result)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxmHomeGetRate(self, axis_no, main_step, step) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        self._update(axis)
+        if axis.homing and axis.profile is not None and axis.profile.duration > 0:
+            rate = int(100 * (self._now() - axis.profile.t0) / axis.profile.duration)
+        else:
+            rate = 100 if axis.home_result == HOME_SUCCESS else 0
+        _out(main_step, min(rate, 100))
+        _out(step, min(rate, 100))
+        return AXT_RT_SUCCESS
+
+    # ========================================================================
+    # Digital I/O (Axd*)
+    # ========================================================================
+
+    def _module(self, module_no) -> Optional[_SimModule]:
+        module_no = _val(module_no)
+        if 0 <= module_no < len(self._modules):
+            return self._modules[module_no]
+        return None
+
+    def _read_bits(self, module_no, offset, width: int, out, inputs: bool) -> int:
+        module = self._module(module_no)
+        if module is None:
+            return AXT_RT_DIO_INVALID_MODULE_NO
+        count = module.inputs if inputs else module.outputs
+        shift = _val(offset) * width
+        if shift >= max(count, 1) or shift < 0:
+            return AXT_RT_DIO_INVALID_OFFSET_NO
+        if inputs:
+            # Active-low inputs read inverted
+            bits = ~(module.input_bits ^ module.input_levels)
+        else:
+            bits = module.output_bits
+        _out(out, (bits >> shift) & ((1 << width) - 1))
+        return AXT_RT_SUCCESS
+
+    def _write_bits(self, module_no, offset, width: int, value) -> int:
+        module = self._module(module_no)
+        if module is None:
+            return AXT_RT_DIO_INVALID_MODULE_NO
+        shift = _val(offset) * width
+        if shift >= max(module.outputs, 1) or shift < 0:
+            return AXT_RT_DIO_INVALID_OFFSET_NO
+        mask = ((1 << width) - 1) << shift
+        module.output_bits = (module.output_bits & ~mask) | ((_val(value) << shift) & mask)
+        self._propagate_loopbacks()
+        return AXT_RT_SUCCESS
+
+    def _drive_input(self, module_no: int, offset: int, value: bool) -> Optional[Any]:
+        """Set a raw DIO input bit; returns the interrupt callback to run for the edge"""
+        module = self._modules[module_no]
+        bit = 1 << offset
+        was = bool(module.input_bits & bit)
+        if value:
+            module.input_bits |= bit
+        else:
+            module.input_bits &= ~bit
+        edges = module.rising_edges if value else module.falling_edges
+        if was == bool(value) or not module.interrupt_enabled or not edges & bit:
+            return None
+        self._last_interrupt = (module_no, _interrupt_flag(offset))
+        return self._interrupt_procs.get(module_no)
+
+    def _propagate_loopbacks(self) -> None:
+        """Send changed loopback output levels down their wires"""
+        for wire in self._loopbacks:
+            level = self._loopback_output(wire.output)
+            if level != wire.level:
+                wire.level = level
+                timer = threading.Timer(wire.delay, self._deliver_loopback, (wire.input, level))
+                timer.daemon = True
+                timer.start()
+
+    def _deliver_loopback(self, target: Tuple[str, int, int], level: bool) -> None:
+        with self._lock:
+            proc = self._loopback_input(target, level)
+        if proc is not None:
+            proc(target[1], _interrupt_flag(target[2]))
+
+    def _loopback_output(self, point: Tuple[str, int, int]) -> bool:
+        kind, index, bit = point
+        if kind == LOOPBACK_DIO:
+            return bool(self._modules[index].output_bits >> bit & 1)
+        return bool(self._axes[index].universal_outputs >> bit & 1)
+
+    def _loopback_input(self, point: Tuple[str, int, int], level: bool) -> Optional[Any]:
+        kind, index, bit = point
+        if kind == LOOPBACK_DIO:
+            return self._drive_input(index, bit, level)
+        if level:
+            self._axes[index].universal_inputs |= 1 << bit
+        else:
+            self._axes[index].universal_inputs &= ~(1 << bit)
+        return None
+
+    @_ffi(CALL_STATUS)
+    def AxdInfoIsDIOModule(self, status) -> int:  # noqa: N802
+        _out(status, 1 if self._modules else 0)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxdInfoGetModuleCount(self, count) -> int:  # noqa: N802
+        _out(count, len(self._modules))
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxdInfoGetModuleNo(self, board_no, module_pos, module_no) -> int:  # noqa: N802
+        location = (_val(board_no), _val(module_pos))
+        for index in range(len(self._modules)):
+            if self._board_of(index, len(self._modules)) == location:
+                _out(module_no, index)
+                return AXT_RT_SUCCESS
+        return AXT_RT_DIO_INVALID_MODULE_NO
+
+    @_ffi(CALL_STATUS)
+    def AxdInfoGetInputCount(self, module_no, count) -> int:  # noqa: N802
+        module = self._module(module_no)
+        if module is None:
+            return AXT_RT_DIO_INVALID_MODULE_NO
+        _out(count, module.inputs)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxdInfoGetOutputCount(self, module_no, count) -> int:  # noqa: N802
+        module = self._module(module_no)
+        if module is None:
+            return AXT_RT_DIO_INVALID_MODULE_NO
+        _out(count, module.outputs)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxdInfoGetModule(self, module_no, board_no, module_pos, module_id) -> int:  # noqa: N802
+        module = self._module(module_no)
+        if module is None:
+            return AXT_RT_DIO_INVALID_MODULE_NO
+        board, position = self._board_of(_val(module_no), len(self._modules))
+        _out(board_no, board)
+        _out(module_pos, position)
+        _out(module_id, module.module_id)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxdInfoGetModuleStatus(self, module_no) -> int:  # noqa: N802
+        if self._module(module_no) is None:
+            return AXT_RT_DIO_INVALID_MODULE_NO
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_IO)
+    def AxdiReadInportBit(self, module_no, offset, value) -> int:  # noqa: N802
+        return self._read_bits(module_no, offset, 1, value, True)
+
+    @_ffi(CALL_IO)
+    def AxdiReadInportByte(self, module_no, offset, value) -> int:  # noqa: N802
+        return self._read_bits(module_no, offset, 8, value, True)
+
+    @_ffi(CALL_IO)
+    def AxdiReadInportWord(self, module_no, offset, value) -> int:  # noqa: N802
+        return self._read_bits(module_no, offset, 16, value, True)
+
+    @_ffi(CALL_IO)
+    def AxdiReadInportDword(self, module_no, offset, value) -> int:  # noqa: N802
+        return self._read_bits(module_no, offset, 32, value, True)
+
+    @_ffi(CALL_IO)
+    def AxdoReadOutportBit(self, module_no, offset, value) -> int:  # noqa: N802
+        return self._read_bits(module_no, offset, 1, value, False)
+
+    @_ffi(CALL_IO)
+    def AxdoReadOutportByte(self, module_no, offset, value) -> int:  # noqa: N802
+        return self._read_bits(module_no, offset, 8, value, False)
+
+    @_ffi(CALL_IO)
+    def AxdoReadOutportWord(self, module_no, offset, value) -> int:  # noqa: N802
+        return self._read_bits(module_no, offset, 16, value, False)
+
+    @_ffi(CALL_IO)
+    def AxdoReadOutportDword(self, module_no, offset, value) -> int:  # noqa: N802
+        return self._read_bits(module_no, offset, 32, value, False)
+
+    @_ffi(CALL_IO)
+    def AxdoWriteOutportBit(self, module_no, offset, value) -> int:  # noqa: N802
+        return self._write_bits(module_no, offset, 1, value)
+
+    @_ffi(CALL_IO)
+    def AxdoWriteOutportByte(self, module_no, offset, value) -> int:  # noqa: N802
+        return self._write_bits(module_no, offset, 8, value)
+
+    @_ffi(CALL_IO)
+    def AxdoWriteOutportWord(self, module_no, offset, value) -> int:  # noqa: N802
+        return self._write_bits(module_no, offset, 16, value)
+
+    @_ffi(CALL_IO)
+    def AxdoWriteOutportDword(self, module_no, offset, value) -> int:  # noqa: N802
+        return self._write_bits(module_no, offset, 32, value)
+
+    @_ffi(CALL_COMMAND)
+    def AxdiInterruptSetModule(self, module_no, hwnd, message, proc, event) -> int:  # noqa: N802
+        if self._module(module_no) is None:
+            return AXT_RT_DIO_INVALID_MODULE_NO
+        if proc is None:
+            self._interrupt_procs.pop(_val(module_no), None)
+        else:
+            self._interrupt_procs[_val(module_no)] = proc
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxdiInterruptSetModuleEnable(self, module_no, use) -> int:  # noqa: N802
+        module = self._module(module_no)
+        if module is None:
+            return AXT_RT_DIO_INVALID_MODULE_NO
+        module.interrupt_enabled = bool(_val(use))
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxdiInterruptEdgeSetBit(self, module_no, offset, mode, value) -> int:  # noqa: N802
+        module = self._module(module_no)
+        if module is None:
+            return AXT_RT_DIO_INVALID_MODULE_NO
+        if not 0 <= _val(offset) < module.inputs:
+            return AXT_RT_DIO_INVALID_OFFSET_NO
+        bit = 1 << _val(offset)
+        name = {UP_EDGE: "rising_edges", DOWN_EDGE: "falling_edges"}.get(_val(mode))
+        if name is None:  # Only DOWN_EDGE(0) / UP_EDGE(1); both edges take two calls
+            return AXT_RT_DIO_INVALID_VALUE
+        mask = getattr(module, name)
+        setattr(module, name, mask | bit if _val(value) else mask & ~bit)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxdiInterruptRead(self, module_no, flag) -> int:  # noqa: N802
+        _out(module_no, self._last_interrupt[0])
+        _out(flag, self._last_interrupt[1])
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxdiLevelSetInportBit(self, module_no, offset, level) -> int:  # noqa: N802
+        module = self._module(module_no)
+        if module is None:
+            return AXT_RT_DIO_INVALID_MODULE_NO
+        bit = 1 << _val(offset)
+        if _val(level):
+            module.input_levels |= bit
+        else:
+            module.input_levels &= ~bit
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxdiLevelGetInportBit(self, module_no, offset, level) -> int:  # noqa: N802
+        module = self._module(module_no)
+        if module is None:
+            return AXT_RT_DIO_INVALID_MODULE_NO
+        _out(level, module.input_levels >> _val(offset) & 1)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxdoLevelSetOutportBit(self, module_no, offset, level) -> int:  # noqa: N802
+        module = self._module(module_no)
+        if module is None:
+            return AXT_RT_DIO_INVALID_MODULE_NO
+        bit = 1 << _val(offset)
+        module.output_levels = (
+            module.output_levels | bit if _val(level) else module.output_levels & ~bit
+        )
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxdoLevelGetOutportBit(self, module_no, offset, level) -> int:  # noqa: N802
+        module = self._module(module_no)
+        if module is None:
+            return AXT_RT_DIO_INVALID_MODULE_NO
+        _out(level, module.output_levels >> _val(offset) & 1)
+        return AXT_RT_SUCCESS
+
+    # ========================================================================
+    # Analog Output (Axao*)
+    # ========================================================================
+
+    def _analog_out(self, channel_no) -> Optional[_SimAnalogOut]:
+        index = _val(channel_no)
+        if 0 <= index < len(self._analog_outputs):
+            return self._analog_outputs[index]
+        return None
+
+    @_ffi(CALL_STATUS)
+    def AxaoInfoGetChannelCount(self, count) -> int:  # noqa: N802
+        _out(count, len(self._analog_outputs))
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxaoSetRange(self, channel_no, min_volt, max_volt) -> int:  # noqa: N802
+        channel = self._analog_out(channel_no)
+        if channel is None:
+            return AXT_RT_AIO_INVALID_CHANNEL_NO
+        if _val(min_volt) >= _val(max_volt):
+            return AXT_RT_AIO_INVALID_VALUE
+        channel.min_volt = _val(min_volt)
+        channel.max_volt = _val(max_volt)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_STATUS)
+    def AxaoGetRange(self, channel_no, min_volt, max_volt) -> int:  # noqa: N802
+        channel = self._analog_out(channel_no)
+        if channel is None:
+            return AXT_RT_AIO_INVALID_CHANNEL_NO
+        _out(min_volt, channel.min_volt)
+        _out(max_volt, channel.max_volt)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_IO)
+    def AxaoWriteMultiVoltage(self, size, channels, volts) -> int:  # noqa: N802
+        with self._lock:
+            targets = [self._analog_out(channels[i]) for i in range(_val(size))]
+            if any(channel is None for channel in targets):
+                return AXT_RT_AIO_INVALID_CHANNEL_NO
+            for i, channel in enumerate(targets):
+                channel.volt = min(max(volts[i], channel.min_volt), channel.max_volt)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_IO)
+    def AxaoWriteMultiDigit(self, size, channels, digits) -> int:  # noqa: N802
+        with self._lock:
+            targets = [self._analog_out(channels[i]) for i in range(_val(size))]
+            if any(channel is None for channel in targets):
+                return AXT_RT_AIO_INVALID_CHANNEL_NO
+            for i, channel in enumerate(targets):
+                if not 0 <= digits[i] <= SIM_AO_DIGIT_MAX:
+                    return AXT_RT_AIO_INVALID_VALUE
+                span = channel.max_volt - channel.min_volt
+                channel.volt = channel.min_volt + span * digits[i] / SIM_AO_DIGIT_MAX
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_IO)
+    def AxaoReadMultiVoltage(self, size, channels, volts) -> int:  # noqa: N802
+        with self._lock:
+            for i in range(_val(size)):
+                channel = self._analog_out(channels[i])
+                if channel is None:
+                    return AXT_RT_AIO_INVALID_CHANNEL_NO
+                volts[i] = channel.volt
+        return AXT_RT_SUCCESS
+
+    # ========================================================================
+    # Analog Input (Axai*)
+    # ========================================================================
+
+    @_ffi(CALL_IO)
+    def AxaiSwReadMultiVoltage(self, size, channels, volts) -> int:  # noqa: N802
+        for i in range(_val(size)):
+            channel = channels[i]
+            if not 0 <= channel < len(self._analog_inputs):
+                return AXT_RT_AIO_INVALID_CHANNEL_NO
+            volts[i] = self._analog_inputs[channel]
+        return AXT_RT_SUCCESS
+
+    # ========================================================================
+    # Sequence and Trigger Tables (AxmSeq*, AxmTriggerOnlyAbs, AxcTable*)
+    # ========================================================================
+
+    @_ffi(CALL_COMMAND)
+    def AxmSeqSetAxisMap(self, seq_map_no, size, axes) -> int:  # noqa: N802
+        axis_list = [axes[i] for i in range(_val(size))]
+        if any(self._axis(axis_no) is None for axis_no in axis_list):
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        self._seq_maps[_val(seq_map_no)] = axis_list
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmSeqBeginNode(self, seq_map_no) -> int:  # noqa: N802
+        if _val(seq_map_no) not in self._seq_maps:
+            return AXT_RT_MOTION_INVALID_METHOD
+        self._seq_building[_val(seq_map_no)] = []
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmSeqAddNode(  # noqa: N802
+        self, seq_map_no, positions, velocity, acceleration, deceleration, next_velocity
+    ) -> int:
+        nodes = self._seq_building.get(_val(seq_map_no))
+        if nodes is None:
+            return AXT_RT_MOTION_INVALID_METHOD
+        width = len(self._seq_maps[_val(seq_map_no)])
+        profile = (_val(velocity), _val(acceleration), _val(deceleration), _val(next_velocity))
+        nodes.append(tuple(positions[i] for i in range(width)) + profile)
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmSeqEndNode(self, seq_map_no) -> int:  # noqa: N802
+        nodes = self._seq_building.pop(_val(seq_map_no), None)
+        if nodes is None:
+            return AXT_RT_MOTION_INVALID_METHOD
+        self._seq_nodes[_val(seq_map_no)] = nodes
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmTriggerOnlyAbs(self, axis_no, count, positions) -> int:  # noqa: N802
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        axis.trigger_positions = [positions[i] for i in range(_val(count))]
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxmMotSetTorqueLimitAtPos(  # noqa: N802
+        self, axis_no, plus_limit, minus_limit, position, target
+    ) -> int:
+        axis = self._axis(axis_no)
+        if axis is None:
+            return AXT_RT_MOTION_INVALID_AXIS_NO
+        axis.torque_at_pos[_val(position)] = (_val(plus_limit), _val(minus_limit), _val(target))
+        return AXT_RT_SUCCESS
+
+    @_ffi(CALL_COMMAND)
+    def AxcTableSetTriggerData(  # noqa: N802
+        self, module_no, table_pos, count, points, pulse_counts, intervals
+    ) -> int:
+        table = [
+            (points[2 * i], points[2 * i + 1], pulse_counts[i], intervals[i])
+            for i in range(_val(count))
+        ]
+        self._counter_triggers[(_val(module_no), _val(table_pos))] = table
+        return AXT_RT_SUCCESS
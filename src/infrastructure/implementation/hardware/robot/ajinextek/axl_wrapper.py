@@ -13,15 +13,36 @@ from ctypes import c_char_p, c_double, c_long, c_ulong, POINTER, wintypes
 from pathlib import Path
 import platform
 import threading
-from typing import Any, List, Optional, Set, Tuple
+from typing import Any, Callable, Dict, List, Optional, Set, Tuple
 
 # Local application imports
 from domain.exceptions.robot_exceptions import (
     AXLError,
+    AXLFunctionNotAvailableError,
     AXLMotionError,
 )
+from infrastructure.implementation.hardware.robot.ajinextek.axl_parameter_cache import (
+    PARAM_ABS_REL_MODE,
+    PARAM_ACCEL_UNIT,
+    PARAM_BACKLASH,
+    PARAM_BACKLASH_ENABLE,
+    PARAM_HOME_METHOD,
+    PARAM_HOME_VEL,
+    PARAM_INPOS,
+    PARAM_LIMIT,
+    PARAM_MAX_VEL,
+    PARAM_MIN_VEL,
+    PARAM_MOVE_UNIT_PER_PULSE,
+    PARAM_PROFILE_MODE,
+    PARAM_PULSE_OUT_METHOD,
+    PARAM_SERVO_ALARM,
+    PARAM_SOFT_LIMIT,
+    PARAM_TORQUE_LIMIT,
+    AxisParameterCache,
+)
 from infrastructure.implementation.hardware.robot.ajinextek.constants import (
     DLL_PATH,
+    SEQ_NODE_PROFILE_FIELDS,
 )
 from infrastructure.implementation.hardware.robot.ajinextek.error_codes import (
     AXT_RT_SUCCESS,
@@ -94,6 +115,23 @@ else:
 
     FuncType = CFUNCTYPE
 
+# void AXT_INTERRUPT_PROC(long lActiveNo, DWORD uFlag)
+AXT_INTERRUPT_PROC = FuncType(None, c_long, wintypes.DWORD)
+
+
+class MOTION_INFO(ctypes.Structure):  # noqa: N801
+    """AxmStatusReadMotionInfo snapshot; dwMask selects the fields read (MOTION_INFO_*)"""
+
+    _fields_ = [
+        ("dCmdPos", c_double),
+        ("dActPos", c_double),
+        ("dwMechSig", wintypes.DWORD),
+        ("dwDrvStat", wintypes.DWORD),
+        ("dwInput", wintypes.DWORD),
+        ("dwOutput", wintypes.DWORD),
+        ("dwMask", wintypes.DWORD),
+    ]
+
 
 class AXLWrapper:
     """Wrapper class for AXL library functions."""
@@ -125,11 +163,29 @@ class AXLWrapper:
         self._connection_lock: threading.RLock = threading.RLock()
         self._connected_services: Set[str] = set()
 
+        # Write-through motion parameter cache (cleared on open/close/parameter load)
+        self._param_cache = AxisParameterCache()
+
+        # Interrupt callbacks handed to the library (kept alive while registered)
+        self._interrupt_procs: Dict[int, Any] = {}
+
+        # Simulated library (benchmarks/tests) - takes precedence over the real DLL
+        # Standard library imports
+        import os
+
+        if os.getenv("AXL_SIMULATOR", "").lower() == "true":
+            # Local application imports
+            from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+                SimulatedAXL,
+            )
+
+            print("Warning: Running against the simulated AXL library (no hardware control)")
+            self.dll = SimulatedAXL()
+            AXLWrapper._initialized = True
+            return
+
         if not self.is_windows:
             # For development/testing, we can create a mock wrapper that simulates the DLL loading
-            # Standard library imports
-            import os
-
             if os.getenv("AXL_MOCK_MODE", "").lower() == "true":
                 print("Warning: Running in AXL mock mode (no actual hardware control)")
                 self.dll = None  # Mock mode - no DLL
@@ -208,6 +264,20 @@ class AXLWrapper:
         except AttributeError:
             missing_functions.append("AxlGetLibVersion")
 
+        # AxlSetDataFlash
+        try:
+            self.dll.AxlSetDataFlash.argtypes = [c_long, c_long, c_long, POINTER(ctypes.c_ubyte)]
+            self.dll.AxlSetDataFlash.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxlSetDataFlash")
+
+        # AxlGetDataFlash
+        try:
+            self.dll.AxlGetDataFlash.argtypes = [c_long, c_long, c_long, POINTER(ctypes.c_ubyte)]
+            self.dll.AxlGetDataFlash.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxlGetDataFlash")
+
         # === Motion Functions ===
         # AxmInfoGetAxisCount
         try:
@@ -216,6 +286,18 @@ class AXLWrapper:
         except AttributeError:
             missing_functions.append("AxmInfoGetAxisCount")
 
+        # AxmInfoGetAxis
+        try:
+            self.dll.AxmInfoGetAxis.argtypes = [
+                c_long,
+                POINTER(c_long),
+                POINTER(c_long),
+                POINTER(wintypes.DWORD),
+            ]
+            self.dll.AxmInfoGetAxis.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmInfoGetAxis")
+
         # AxmMotSetPulseOutMethod
         try:
             self.dll.AxmMotSetPulseOutMethod.argtypes = [
@@ -226,6 +308,13 @@ class AXLWrapper:
         except AttributeError:
             missing_functions.append("AxmMotSetPulseOutMethod")
 
+        # AxmMotGetPulseOutMethod
+        try:
+            self.dll.AxmMotGetPulseOutMethod.argtypes = [c_long, POINTER(c_ulong)]
+            self.dll.AxmMotGetPulseOutMethod.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmMotGetPulseOutMethod")
+
         # AxmMotSetMoveUnitPerPulse
         try:
             self.dll.AxmMotSetMoveUnitPerPulse.argtypes = [
@@ -237,6 +326,17 @@ class AXLWrapper:
         except AttributeError:
             missing_functions.append("AxmMotSetMoveUnitPerPulse")
 
+        # AxmMotGetMoveUnitPerPulse
+        try:
+            self.dll.AxmMotGetMoveUnitPerPulse.argtypes = [
+                c_long,
+                POINTER(c_double),
+                POINTER(c_long),
+            ]
+            self.dll.AxmMotGetMoveUnitPerPulse.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmMotGetMoveUnitPerPulse")
+
         # AxmSignalServoOn
         try:
             self.dll.AxmSignalServoOn.argtypes = [
@@ -344,29 +444,53 @@ class AXLWrapper:
         # AxmHomeSetMethod
         try:
             self.dll.AxmHomeSetMethod.argtypes = [
-                c_long,
-                c_long,
-                c_long,
-                c_long,
-                c_double,
+                c_long,  # lAxisNo
+                c_long,  # lHmDir
+                c_ulong,  # uHomeSignal
+                c_ulong,  # uZphas
+                c_double,  # dHomeClrTime
+                c_double,  # dHomeOffset
             ]
             self.dll.AxmHomeSetMethod.restype = c_long
         except AttributeError:
             missing_functions.append("AxmHomeSetMethod")
 
+        # AxmHomeGetMethod
+        try:
+            self.dll.AxmHomeGetMethod.argtypes = [
+                c_long,
+                POINTER(c_long),
+                POINTER(c_ulong),
+                POINTER(c_ulong),
+                POINTER(c_double),
+                POINTER(c_double),
+            ]
+            self.dll.AxmHomeGetMethod.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmHomeGetMethod")
+
         # AxmHomeSetVel
         try:
             self.dll.AxmHomeSetVel.argtypes = [
-                c_long,
-                c_double,
-                c_double,
-                c_double,
-                c_double,
+                c_long,  # lAxisNo
+                c_double,  # dVelFirst
+                c_double,  # dVelSecond
+                c_double,  # dVelThird
+                c_double,  # dVelLast
+                c_double,  # dAccFirst
+                c_double,  # dAccSecond
             ]
             self.dll.AxmHomeSetVel.restype = c_long
         except AttributeError:
             missing_functions.append("AxmHomeSetVel")
 
+        # AxmHomeGetVel
+        try:
+            self.dll.AxmHomeGetVel.argtypes = [c_long] + [POINTER(c_double)] * 6
+            self.dll.AxmHomeGetVel.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmHomeGetVel")
+
         # AxmHomeSetStart
         try:
             self.dll.AxmHomeSetStart.argtypes = [c_long]
@@ -399,6 +523,41 @@ class AXLWrapper:
         except AttributeError:
             missing_functions.append("AxmSignalReadServoAlarm")
 
+        # AxmSignalReadInput - Universal inputs of an axis
+        try:
+            self.dll.AxmSignalReadInput.argtypes = [c_long, POINTER(wintypes.DWORD)]
+            self.dll.AxmSignalReadInput.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmSignalReadInput")
+
+        # AxmSignalReadOutput - Universal outputs of an axis
+        try:
+            self.dll.AxmSignalReadOutput.argtypes = [c_long, POINTER(wintypes.DWORD)]
+            self.dll.AxmSignalReadOutput.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmSignalReadOutput")
+
+        # AxmSignalWriteOutput
+        try:
+            self.dll.AxmSignalWriteOutput.argtypes = [c_long, wintypes.DWORD]
+            self.dll.AxmSignalWriteOutput.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmSignalWriteOutput")
+
+        # AxmSignalWriteOutputBit
+        try:
+            self.dll.AxmSignalWriteOutputBit.argtypes = [c_long, c_long, wintypes.DWORD]
+            self.dll.AxmSignalWriteOutputBit.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmSignalWriteOutputBit")
+
+        # AxmSignalReadInputBit
+        try:
+            self.dll.AxmSignalReadInputBit.argtypes = [c_long, c_long, POINTER(wintypes.DWORD)]
+            self.dll.AxmSignalReadInputBit.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmSignalReadInputBit")
+
         # AxmSignalServoAlarmReset
         try:
             self.dll.AxmSignalServoAlarmReset.argtypes = [
@@ -423,15 +582,68 @@ class AXLWrapper:
         # AxmSignalSetLimit
         try:
             self.dll.AxmSignalSetLimit.argtypes = [
-                c_long,
-                c_long,
-                c_long,
-                c_long,
+                c_long,  # lAxisNo
+                c_ulong,  # uStopMode
+                c_ulong,  # uPositiveLevel
+                c_ulong,  # uNegativeLevel
             ]
             self.dll.AxmSignalSetLimit.restype = c_long
         except AttributeError:
             missing_functions.append("AxmSignalSetLimit")
 
+        # AxmSignalGetLimit
+        try:
+            self.dll.AxmSignalGetLimit.argtypes = [
+                c_long,
+                POINTER(c_ulong),
+                POINTER(c_ulong),
+                POINTER(c_ulong),
+            ]
+            self.dll.AxmSignalGetLimit.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmSignalGetLimit")
+
+        # AxmSignalSetSoftLimit / AxmSignalGetSoftLimit
+        try:
+            self.dll.AxmSignalSetSoftLimit.argtypes = [
+                c_long,  # lAxisNo
+                c_ulong,  # uUse
+                c_ulong,  # uStopMode
+                c_ulong,  # uSelection (0: command, 1: actual position)
+                c_double,  # dPositivePos
+                c_double,  # dNegativePos
+            ]
+            self.dll.AxmSignalSetSoftLimit.restype = wintypes.DWORD
+            self.dll.AxmSignalGetSoftLimit.argtypes = [
+                c_long,
+                POINTER(c_ulong),
+                POINTER(c_ulong),
+                POINTER(c_ulong),
+                POINTER(c_double),
+                POINTER(c_double),
+            ]
+            self.dll.AxmSignalGetSoftLimit.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmSignalSetSoftLimit")
+
+        # AxmSignalSetInpos / AxmSignalGetInpos
+        try:
+            self.dll.AxmSignalSetInpos.argtypes = [c_long, c_ulong]
+            self.dll.AxmSignalSetInpos.restype = wintypes.DWORD
+            self.dll.AxmSignalGetInpos.argtypes = [c_long, POINTER(c_ulong)]
+            self.dll.AxmSignalGetInpos.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmSignalSetInpos")
+
+        # AxmSignalSetServoAlarm / AxmSignalGetServoAlarm
+        try:
+            self.dll.AxmSignalSetServoAlarm.argtypes = [c_long, c_ulong]
+            self.dll.AxmSignalSetServoAlarm.restype = wintypes.DWORD
+            self.dll.AxmSignalGetServoAlarm.argtypes = [c_long, POINTER(c_ulong)]
+            self.dll.AxmSignalGetServoAlarm.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmSignalSetServoAlarm")
+
         # AxmMotSetAbsRelMode
         try:
             self.dll.AxmMotSetAbsRelMode.argtypes = [
@@ -496,14 +708,73 @@ class AXLWrapper:
         # AxmMoveMultiStop
         try:
             self.dll.AxmMoveMultiStop.argtypes = [
+                c_long,
                 POINTER(c_long),
                 POINTER(c_double),
-                c_long,
             ]
             self.dll.AxmMoveMultiStop.restype = c_long
         except AttributeError:
             missing_functions.append("AxmMoveMultiStop")
 
+        # AxmMoveMultiSStop - Synchronized smooth stop
+        try:
+            self.dll.AxmMoveMultiSStop.argtypes = [c_long, POINTER(c_long)]
+            self.dll.AxmMoveMultiSStop.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmMoveMultiSStop")
+
+        # AxmMoveMultiEStop - Synchronized emergency stop
+        try:
+            self.dll.AxmMoveMultiEStop.argtypes = [c_long, POINTER(c_long)]
+            self.dll.AxmMoveMultiEStop.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmMoveMultiEStop")
+
+        # AxmMoveStartMultiVel
+        try:
+            self.dll.AxmMoveStartMultiVel.argtypes = [
+                c_long,
+                POINTER(c_long),
+                POINTER(c_double),
+                POINTER(c_double),
+                POINTER(c_double),
+            ]
+            self.dll.AxmMoveStartMultiVel.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmMoveStartMultiVel")
+
+        # AxmMoveStartMultiVelEx
+        try:
+            self.dll.AxmMoveStartMultiVelEx.argtypes = [
+                c_long,
+                POINTER(c_long),
+                POINTER(c_double),
+                POINTER(c_double),
+                POINTER(c_double),
+                wintypes.DWORD,
+            ]
+            self.dll.AxmMoveStartMultiVelEx.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmMoveStartMultiVelEx")
+
+        # AxmOverrideSetMaxVel
+        try:
+            self.dll.AxmOverrideSetMaxVel.argtypes = [c_long, c_double]
+            self.dll.AxmOverrideSetMaxVel.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmOverrideSetMaxVel")
+
+        # AxmOverrideMultiVel
+        try:
+            self.dll.AxmOverrideMultiVel.argtypes = [
+                c_long,
+                POINTER(c_long),
+                POINTER(c_double),
+            ]
+            self.dll.AxmOverrideMultiVel.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmOverrideMultiVel")
+
         # === Parameter Loading/Saving Functions ===
         # AxmMotLoadParaAll
         try:
@@ -579,6 +850,66 @@ class AXLWrapper:
         except AttributeError:
             missing_functions.append("AxmMotGetProfileMode")
 
+        # AxmMotSetAccelJerk
+        try:
+            self.dll.AxmMotSetAccelJerk.argtypes = [c_long, c_double]
+            self.dll.AxmMotSetAccelJerk.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmMotSetAccelJerk")
+
+        # AxmMotGetAccelJerk
+        try:
+            self.dll.AxmMotGetAccelJerk.argtypes = [c_long, POINTER(c_double)]
+            self.dll.AxmMotGetAccelJerk.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmMotGetAccelJerk")
+
+        # AxmMotSetDecelJerk
+        try:
+            self.dll.AxmMotSetDecelJerk.argtypes = [c_long, c_double]
+            self.dll.AxmMotSetDecelJerk.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmMotSetDecelJerk")
+
+        # AxmMotGetDecelJerk
+        try:
+            self.dll.AxmMotGetDecelJerk.argtypes = [c_long, POINTER(c_double)]
+            self.dll.AxmMotGetDecelJerk.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmMotGetDecelJerk")
+
+        # AxmMotSetTorqueLimit / AxmMotGetTorqueLimit
+        try:
+            self.dll.AxmMotSetTorqueLimit.argtypes = [c_long, c_double, c_double]
+            self.dll.AxmMotSetTorqueLimit.restype = wintypes.DWORD
+            self.dll.AxmMotGetTorqueLimit.argtypes = [c_long, POINTER(c_double), POINTER(c_double)]
+            self.dll.AxmMotGetTorqueLimit.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmMotSetTorqueLimit")
+
+        # === Compensation Functions ===
+        # AxmCompensationSetBacklash / AxmCompensationGetBacklash
+        try:
+            self.dll.AxmCompensationSetBacklash.argtypes = [c_long, c_long, c_double]
+            self.dll.AxmCompensationSetBacklash.restype = wintypes.DWORD
+            self.dll.AxmCompensationGetBacklash.argtypes = [
+                c_long,
+                POINTER(c_long),
+                POINTER(c_double),
+            ]
+            self.dll.AxmCompensationGetBacklash.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmCompensationSetBacklash")
+
+        # AxmCompensationEnableBacklash / AxmCompensationIsEnableBacklash
+        try:
+            self.dll.AxmCompensationEnableBacklash.argtypes = [c_long, c_ulong]
+            self.dll.AxmCompensationEnableBacklash.restype = wintypes.DWORD
+            self.dll.AxmCompensationIsEnableBacklash.argtypes = [c_long, POINTER(c_ulong)]
+            self.dll.AxmCompensationIsEnableBacklash.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmCompensationEnableBacklash")
+
         # === Digital I/O Functions ===
         # Board and Module Information Functions
         try:
@@ -734,7 +1065,7 @@ class AXLWrapper:
                 c_long,
                 wintypes.HWND,
                 wintypes.DWORD,
-                FuncType(None),
+                AXT_INTERRUPT_PROC,
                 POINTER(wintypes.HANDLE),
             ]
             self.dll.AxdiInterruptSetModule.restype = wintypes.DWORD
@@ -759,11 +1090,126 @@ class AXLWrapper:
             missing_functions.append("AxdiInterruptEdgeSetBit")
 
         try:
-            self.dll.AxdiInterruptRead.argtypes = [c_long, POINTER(wintypes.DWORD)]
+            self.dll.AxdiInterruptRead.argtypes = [POINTER(c_long), POINTER(wintypes.DWORD)]
             self.dll.AxdiInterruptRead.restype = wintypes.DWORD
         except AttributeError:
             missing_functions.append("AxdiInterruptRead")
 
+        # === Analog Output Functions ===
+        try:
+            self.dll.AxaoInfoGetChannelCount.argtypes = [POINTER(c_long)]
+            self.dll.AxaoInfoGetChannelCount.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxaoInfoGetChannelCount")
+
+        try:
+            self.dll.AxaoSetRange.argtypes = [c_long, c_double, c_double]
+            self.dll.AxaoSetRange.restype = wintypes.DWORD
+            self.dll.AxaoGetRange.argtypes = [c_long, POINTER(c_double), POINTER(c_double)]
+            self.dll.AxaoGetRange.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxaoSetRange")
+
+        try:
+            self.dll.AxaoWriteMultiVoltage.argtypes = [c_long, POINTER(c_long), POINTER(c_double)]
+            self.dll.AxaoWriteMultiVoltage.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxaoWriteMultiVoltage")
+
+        try:
+            self.dll.AxaoWriteMultiDigit.argtypes = [
+                c_long,
+                POINTER(c_long),
+                POINTER(wintypes.DWORD),
+            ]
+            self.dll.AxaoWriteMultiDigit.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxaoWriteMultiDigit")
+
+        try:
+            self.dll.AxaoReadMultiVoltage.argtypes = [c_long, POINTER(c_long), POINTER(c_double)]
+            self.dll.AxaoReadMultiVoltage.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxaoReadMultiVoltage")
+
+        # === Analog Input Functions ===
+        # AxaiSwReadMultiVoltage
+        try:
+            self.dll.AxaiSwReadMultiVoltage.argtypes = [c_long, POINTER(c_long), POINTER(c_double)]
+            self.dll.AxaiSwReadMultiVoltage.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxaiSwReadMultiVoltage")
+
+        # === Sequence / Trigger Table Functions ===
+        # AxmSeqSetAxisMap
+        try:
+            self.dll.AxmSeqSetAxisMap.argtypes = [c_long, c_long, POINTER(c_long)]
+            self.dll.AxmSeqSetAxisMap.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmSeqSetAxisMap")
+
+        # AxmSeqBeginNode
+        try:
+            self.dll.AxmSeqBeginNode.argtypes = [c_long]
+            self.dll.AxmSeqBeginNode.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmSeqBeginNode")
+
+        # AxmSeqAddNode
+        try:
+            self.dll.AxmSeqAddNode.argtypes = [
+                c_long,
+                POINTER(c_double),
+                c_double,
+                c_double,
+                c_double,
+                c_double,
+            ]
+            self.dll.AxmSeqAddNode.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmSeqAddNode")
+
+        # AxmSeqEndNode
+        try:
+            self.dll.AxmSeqEndNode.argtypes = [c_long]
+            self.dll.AxmSeqEndNode.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmSeqEndNode")
+
+        # AxmTriggerOnlyAbs
+        try:
+            self.dll.AxmTriggerOnlyAbs.argtypes = [c_long, c_long, POINTER(c_double)]
+            self.dll.AxmTriggerOnlyAbs.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmTriggerOnlyAbs")
+
+        # AxmMotSetTorqueLimitAtPos
+        try:
+            self.dll.AxmMotSetTorqueLimitAtPos.argtypes = [
+                c_long,
+                c_double,
+                c_double,
+                c_double,
+                c_long,
+            ]
+            self.dll.AxmMotSetTorqueLimitAtPos.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmMotSetTorqueLimitAtPos")
+
+        # AxcTableSetTriggerData (counter module position trigger table)
+        try:
+            self.dll.AxcTableSetTriggerData.argtypes = [
+                c_long,
+                c_long,
+                c_long,
+                POINTER(c_double),
+                POINTER(c_long),
+                POINTER(c_double),
+            ]
+            self.dll.AxcTableSetTriggerData.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxcTableSetTriggerData")
+
         # === Servo Monitoring Functions ===
         # AxmStatusSetReadServoLoadRatio
         try:
@@ -786,6 +1232,59 @@ class AXLWrapper:
         except AttributeError:
             missing_functions.append("AxmStatusReadTorque")
 
+        # AxmStatusReadVel
+        try:
+            self.dll.AxmStatusReadVel.argtypes = [c_long, POINTER(c_double)]
+            self.dll.AxmStatusReadVel.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmStatusReadVel")
+
+        # AxmStatusSetMon - Drive parameter monitor selection
+        try:
+            self.dll.AxmStatusSetMon.argtypes = [
+                c_long,
+                wintypes.DWORD,
+                wintypes.DWORD,
+                wintypes.DWORD,
+                wintypes.DWORD,
+                wintypes.DWORD,
+            ]
+            self.dll.AxmStatusSetMon.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmStatusSetMon")
+
+        # AxmStatusGetMon
+        try:
+            self.dll.AxmStatusGetMon.argtypes = [c_long] + [POINTER(wintypes.DWORD)] * 5
+            self.dll.AxmStatusGetMon.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmStatusGetMon")
+
+        # AxmStatusReadMon - Latest monitored values
+        try:
+            self.dll.AxmStatusReadMon.argtypes = [c_long] + [POINTER(wintypes.DWORD)] * 5
+            self.dll.AxmStatusReadMon.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmStatusReadMon")
+
+        # AxmStatusReadMonEx - Buffered monitor data drain
+        try:
+            self.dll.AxmStatusReadMonEx.argtypes = [
+                c_long,
+                POINTER(c_long),
+                POINTER(wintypes.DWORD),
+            ]
+            self.dll.AxmStatusReadMonEx.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmStatusReadMonEx")
+
+        # AxmStatusReadMotionInfo - Status values of one controller cycle (dwMask)
+        try:
+            self.dll.AxmStatusReadMotionInfo.argtypes = [c_long, POINTER(MOTION_INFO)]
+            self.dll.AxmStatusReadMotionInfo.restype = wintypes.DWORD
+        except AttributeError:
+            missing_functions.append("AxmStatusReadMotionInfo")
+
         # Log all missing functions at once (if any)
         if missing_functions:
             # Third-party imports
@@ -796,6 +1295,54 @@ class AXLWrapper:
                 "AxmStatusReadTorque",  # Only available in specific hardware (MLII, SIIIH)
                 "AxmStatusReadServoLoadRatio",  # Advanced monitoring feature
                 "AxmStatusSetReadServoLoadRatio",  # Advanced monitoring feature
+                "AxmStatusSetMon",  # SIIIH drive monitor only
+                "AxmStatusGetMon",  # SIIIH drive monitor only
+                "AxmStatusReadMon",  # SIIIH drive monitor only
+                "AxmStatusReadMonEx",  # SIIIH drive monitor only
+                "AxmStatusReadMotionInfo",  # Newer library versions only
+                "AxmMotSetTorqueLimit",  # Servo drives with torque limit support only
+                "AxmCompensationSetBacklash",  # Newer library versions only
+                "AxmCompensationEnableBacklash",  # Newer library versions only
+                "AxaoInfoGetChannelCount",  # AIO modules only
+                "AxaoSetRange",  # AIO modules only
+                "AxaoWriteMultiVoltage",  # AIO modules only
+                "AxaoWriteMultiDigit",  # AIO modules only
+                "AxaoReadMultiVoltage",  # AIO modules only
+                "AxaiSwReadMultiVoltage",  # AIO modules only
+                "AxmSeqSetAxisMap",  # Sequence motion (newer library versions only)
+                "AxmSeqBeginNode",  # Sequence motion (newer library versions only)
+                "AxmSeqAddNode",  # Sequence motion (newer library versions only)
+                "AxmSeqEndNode",  # Sequence motion (newer library versions only)
+                "AxmTriggerOnlyAbs",  # Trigger output boards only
+                "AxmMotSetTorqueLimitAtPos",  # Servo drives with torque limit support only
+                "AxcTableSetTriggerData",  # Counter modules only
+                "AxlSetDataFlash",  # PCI-R1604 (RTEX master) boards only
+                "AxlGetDataFlash",  # PCI-R1604 (RTEX master) boards only
+                "AxmHomeGetMethod",  # Not in older library versions
+                "AxmHomeGetVel",  # Not in older library versions
+                "AxmInfoGetAxis",  # Not in older library versions
+                "AxmMotGetAccelJerk",  # Not in older library versions
+                "AxmMotGetDecelJerk",  # Not in older library versions
+                "AxmMotGetMoveUnitPerPulse",  # Not in older library versions
+                "AxmMotGetPulseOutMethod",  # Not in older library versions
+                "AxmMotSetAccelJerk",  # Not in older library versions
+                "AxmMotSetDecelJerk",  # Not in older library versions
+                "AxmMoveMultiEStop",  # Not in older library versions
+                "AxmMoveMultiSStop",  # Not in older library versions
+                "AxmMoveStartMultiVel",  # Not in older library versions
+                "AxmMoveStartMultiVelEx",  # Not in older library versions
+                "AxmOverrideMultiVel",  # Not in older library versions
+                "AxmOverrideSetMaxVel",  # Not in older library versions
+                "AxmSignalGetLimit",  # Not in older library versions
+                "AxmSignalReadInput",  # Not in older library versions
+                "AxmSignalReadInputBit",  # Not in older library versions
+                "AxmSignalReadOutput",  # Not in older library versions
+                "AxmSignalSetInpos",  # Not in older library versions
+                "AxmSignalSetServoAlarm",  # Not in older library versions
+                "AxmSignalSetSoftLimit",  # Not in older library versions
+                "AxmSignalWriteOutput",  # Not in older library versions
+                "AxmSignalWriteOutputBit",  # Not in older library versions
+                "AxmStatusReadVel",  # Not in older library versions
             }
 
             critical_missing = [f for f in missing_functions if f not in optional_functions]
@@ -823,12 +1370,14 @@ class AXLWrapper:
         """Initialize and open the AXL library."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
+        self._param_cache.invalidate()  # Board state unknown after (re)open
         return self.dll.AxlOpen(irq_no)  # type: ignore[no-any-return]
 
     def close(self) -> int:
         """Close the AXL library."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
+        self._param_cache.invalidate()
         return self.dll.AxlClose()  # type: ignore[no-any-return]
 
     def is_opened(self) -> bool:
@@ -875,14 +1424,35 @@ class AXLWrapper:
         """Get library version (cached)."""
         return self.version
 
-    # === Motion Functions ===
-    def get_axis_count(self) -> int:
-        """Get total number of axes."""
+    def set_data_flash(self, board_no: int, page_addr: int, data: bytes) -> None:
+        """Write 1..120 bytes to the start of a board data flash page."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
 
-        count = c_long()
-        result = self.dll.AxmInfoGetAxisCount(ctypes.byref(count))
+        buffer = (ctypes.c_ubyte * len(data)).from_buffer_copy(data)
+        result = self.dll.AxlSetDataFlash(board_no, page_addr, len(data), buffer)
+        if result != AXT_RT_SUCCESS:
+            raise AXLError(get_error_message(result), result, "AxlSetDataFlash")
+
+    def get_data_flash(self, board_no: int, page_addr: int, count: int) -> bytes:
+        """Read 1..120 bytes from the start of a board data flash page."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        buffer = (ctypes.c_ubyte * count)()
+        result = self.dll.AxlGetDataFlash(board_no, page_addr, count, buffer)
+        if result != AXT_RT_SUCCESS:
+            raise AXLError(get_error_message(result), result, "AxlGetDataFlash")
+        return bytes(buffer)
+
+    # === Motion Functions ===
+    def get_axis_count(self) -> int:
+        """Get total number of axes."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        count = c_long()
+        result = self.dll.AxmInfoGetAxisCount(ctypes.byref(count))
         if result != AXT_RT_SUCCESS:
             raise AXLMotionError(
                 get_error_message(result),
@@ -891,20 +1461,84 @@ class AXLWrapper:
             )
         return count.value
 
+    def get_axis_info(self, axis_no: int) -> Tuple[int, int, int]:
+        """Get axis location (board_no, module_pos, module_id)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        board_no = c_long()
+        module_pos = c_long()
+        module_id = wintypes.DWORD()
+        result = self.dll.AxmInfoGetAxis(
+            axis_no, ctypes.byref(board_no), ctypes.byref(module_pos), ctypes.byref(module_id)
+        )
+        if result != AXT_RT_SUCCESS:
+            raise AXLMotionError(get_error_message(result), result, "AxmInfoGetAxis")
+        return (board_no.value, module_pos.value, module_id.value)
+
     def set_pulse_out_method(self, axis_no: int, method: int) -> int:
         """Set pulse output method."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
-        return self.dll.AxmMotSetPulseOutMethod(axis_no, method)  # type: ignore[no-any-return]
+        return self._cached_set(
+            axis_no,
+            PARAM_PULSE_OUT_METHOD,
+            (method,),
+            lambda: self.dll.AxmMotSetPulseOutMethod(axis_no, method),
+        )
+
+    def get_pulse_out_method(self, axis_no: int) -> int:
+        """Get pulse output method."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        def read() -> Tuple:
+            method = c_ulong()
+            result = self.dll.AxmMotGetPulseOutMethod(axis_no, ctypes.byref(method))
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmMotGetPulseOutMethod",
+                )
+            return (method.value,)
+
+        (method,) = self._cached_get(axis_no, PARAM_PULSE_OUT_METHOD, read)
+        return method  # type: ignore[no-any-return]
 
     def set_move_unit_per_pulse(self, axis_no: int, unit: float, pulse: int) -> int:
         """Set movement unit per pulse."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
-        return self.dll.AxmMotSetMoveUnitPerPulse(  # type: ignore[no-any-return]
-            axis_no, unit, pulse
+        return self._cached_set(
+            axis_no,
+            PARAM_MOVE_UNIT_PER_PULSE,
+            (unit, pulse),
+            lambda: self.dll.AxmMotSetMoveUnitPerPulse(axis_no, unit, pulse),
         )
 
+    def get_move_unit_per_pulse(self, axis_no: int) -> Tuple[float, int]:
+        """Get movement unit per pulse as (unit, pulse)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        def read() -> Tuple:
+            unit = c_double()
+            pulse = c_long()
+            result = self.dll.AxmMotGetMoveUnitPerPulse(
+                axis_no, ctypes.byref(unit), ctypes.byref(pulse)
+            )
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmMotGetMoveUnitPerPulse",
+                )
+            return (unit.value, pulse.value)
+
+        unit, pulse = self._cached_get(axis_no, PARAM_MOVE_UNIT_PER_PULSE, read)
+        return (unit, pulse)
+
     def servo_on(self, axis_no: int, on_off: int = 1) -> int:
         """Turn servo on/off."""
         if self.dll is None:
@@ -997,14 +1631,14 @@ class AXLWrapper:
 
     def move_emergency_stop(self, axis_no: int) -> int:
         """Emergency stop - immediate stop without deceleration."""
-        if not self.is_windows or self.dll is None:
-            return AXT_RT_SUCCESS  # Mock success on non-Windows
+        if self.dll is None:
+            return AXT_RT_SUCCESS  # Mock mode (no library loaded)
         return self.dll.AxmMoveEStop(axis_no)  # type: ignore[no-any-return]
 
     def move_smooth_stop(self, axis_no: int) -> int:
         """Smooth stop - stop with deceleration using axis default deceleration parameters."""
-        if not self.is_windows or self.dll is None:
-            return AXT_RT_SUCCESS  # Mock success on non-Windows
+        if self.dll is None:
+            return AXT_RT_SUCCESS  # Mock mode (no library loaded)
         return self.dll.AxmMoveSStop(axis_no)  # type: ignore[no-any-return]
 
     def read_in_motion(self, axis_no: int) -> bool:
@@ -1026,32 +1660,97 @@ class AXLWrapper:
         self,
         axis_no: int,
         home_dir: int,
-        signal_level: int,
-        mode: int,
+        home_signal: int,
+        z_phase: int,
+        clear_time: float,
         offset: float,
     ) -> int:
-        """Set homing method."""
+        """Set homing method (direction, signal, Z phase, end clear time [ms], offset)."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
-        return self.dll.AxmHomeSetMethod(  # type: ignore[no-any-return]
-            axis_no, home_dir, signal_level, mode, offset
+        return self._cached_set(
+            axis_no,
+            PARAM_HOME_METHOD,
+            (home_dir, home_signal, z_phase, clear_time, offset),
+            lambda: self.dll.AxmHomeSetMethod(
+                axis_no, home_dir, home_signal, z_phase, clear_time, offset
+            ),
         )
 
+    def home_get_method(self, axis_no: int) -> Tuple[int, int, int, float, float]:
+        """Get homing method as (direction, signal, Z phase, end clear time, offset)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        def read() -> Tuple:
+            home_dir = c_long()
+            home_signal = c_ulong()
+            z_phase = c_ulong()
+            clear_time = c_double()
+            offset = c_double()
+            result = self.dll.AxmHomeGetMethod(
+                axis_no,
+                ctypes.byref(home_dir),
+                ctypes.byref(home_signal),
+                ctypes.byref(z_phase),
+                ctypes.byref(clear_time),
+                ctypes.byref(offset),
+            )
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmHomeGetMethod",
+                )
+            return (
+                home_dir.value,
+                home_signal.value,
+                z_phase.value,
+                clear_time.value,
+                offset.value,
+            )
+
+        return self._cached_get(axis_no, PARAM_HOME_METHOD, read)  # type: ignore[return-value]
+
     def home_set_vel(
         self,
         axis_no: int,
         vel_first: float,
         vel_second: float,
-        accel: float,
-        decel: float,
+        vel_third: float,
+        vel_last: float,
+        accel_first: float,
+        accel_second: float,
     ) -> int:
-        """Set homing velocities."""
+        """Set homing velocities and accelerations."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
-        return self.dll.AxmHomeSetVel(  # type: ignore[no-any-return]
-            axis_no, vel_first, vel_second, accel, decel
+        values = (vel_first, vel_second, vel_third, vel_last, accel_first, accel_second)
+        return self._cached_set(
+            axis_no,
+            PARAM_HOME_VEL,
+            values,
+            lambda: self.dll.AxmHomeSetVel(axis_no, *values),
         )
 
+    def home_get_vel(self, axis_no: int) -> Tuple[float, float, float, float, float, float]:
+        """Get homing (first, second, third, last velocity, first, second accel)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        def read() -> Tuple:
+            values = [c_double() for _ in range(6)]
+            result = self.dll.AxmHomeGetVel(axis_no, *(ctypes.byref(v) for v in values))
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmHomeGetVel",
+                )
+            return tuple(v.value for v in values)
+
+        return self._cached_get(axis_no, PARAM_HOME_VEL, read)  # type: ignore[return-value]
+
     def home_set_start(self, axis_no: int) -> int:
         """Start homing."""
         if self.dll is None:
@@ -1074,6 +1773,69 @@ class AXLWrapper:
             )
         return alarm_status.value == 1
 
+    def read_universal_input(self, axis_no: int) -> int:
+        """Read the universal input bits of an axis."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        value = wintypes.DWORD()
+        result = self.dll.AxmSignalReadInput(axis_no, ctypes.byref(value))
+        if result != AXT_RT_SUCCESS:
+            raise AXLMotionError(
+                get_error_message(result),
+                result,
+                "AxmSignalReadInput",
+            )
+        return value.value
+
+    def read_universal_output(self, axis_no: int) -> int:
+        """Read the universal output bits of an axis."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        value = wintypes.DWORD()
+        result = self.dll.AxmSignalReadOutput(axis_no, ctypes.byref(value))
+        if result != AXT_RT_SUCCESS:
+            raise AXLMotionError(
+                get_error_message(result),
+                result,
+                "AxmSignalReadOutput",
+            )
+        return value.value
+
+    def write_universal_output(self, axis_no: int, value: int) -> None:
+        """Write the universal output bits of an axis."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        result = self.dll.AxmSignalWriteOutput(axis_no, value)
+        if result != AXT_RT_SUCCESS:
+            raise AXLMotionError(
+                get_error_message(result),
+                result,
+                "AxmSignalWriteOutput",
+            )
+
+    def write_universal_output_bit(self, axis_no: int, bit_no: int, value: bool) -> None:
+        """Write one universal output bit of an axis."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        result = self.dll.AxmSignalWriteOutputBit(axis_no, bit_no, 1 if value else 0)
+        if result != AXT_RT_SUCCESS:
+            raise AXLMotionError(get_error_message(result), result, "AxmSignalWriteOutputBit")
+
+    def read_universal_input_bit(self, axis_no: int, bit_no: int) -> bool:
+        """Read one universal input bit of an axis."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        value = wintypes.DWORD()
+        result = self.dll.AxmSignalReadInputBit(axis_no, bit_no, ctypes.byref(value))
+        if result != AXT_RT_SUCCESS:
+            raise AXLMotionError(get_error_message(result), result, "AxmSignalReadInputBit")
+        return bool(value.value)
+
     def servo_alarm_reset(self, axis_no: int, on_off: int = 1) -> int:
         """
         Reset servo alarm status.
@@ -1116,28 +1878,177 @@ class AXLWrapper:
         """Set limit sensor configuration."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
-        return self.dll.AxmSignalSetLimit(axis_no, pos_level, neg_level, stop_mode)  # type: ignore[no-any-return]
+        # AxmSignalSetLimit takes the stop mode first
+        return self._cached_set(
+            axis_no,
+            PARAM_LIMIT,
+            (pos_level, neg_level, stop_mode),
+            lambda: self.dll.AxmSignalSetLimit(axis_no, stop_mode, pos_level, neg_level),
+        )
+
+    def get_limit_config(self, axis_no: int) -> Tuple[int, int, int]:
+        """Get limit sensor configuration as (pos_level, neg_level, stop_mode)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        def read() -> Tuple:
+            stop_mode = c_ulong()
+            pos_level = c_ulong()
+            neg_level = c_ulong()
+            result = self.dll.AxmSignalGetLimit(
+                axis_no, ctypes.byref(stop_mode), ctypes.byref(pos_level), ctypes.byref(neg_level)
+            )
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmSignalGetLimit",
+                )
+            return (pos_level.value, neg_level.value, stop_mode.value)
+
+        return self._cached_get(axis_no, PARAM_LIMIT, read)  # type: ignore[return-value]
+
+    def set_soft_limit(
+        self,
+        axis_no: int,
+        use: int,
+        stop_mode: int,
+        selection: int,
+        positive_pos: float,
+        negative_pos: float,
+    ) -> int:
+        """Set software limit (use, stop mode, command/actual selection, +/- positions)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+        values = (use, stop_mode, selection, positive_pos, negative_pos)
+        return self._cached_set(
+            axis_no,
+            PARAM_SOFT_LIMIT,
+            values,
+            lambda: self.dll.AxmSignalSetSoftLimit(axis_no, *values),
+        )
+
+    def get_soft_limit(self, axis_no: int) -> Tuple[int, int, int, float, float]:
+        """Get software limit as (use, stop mode, selection, positive pos, negative pos)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        def read() -> Tuple:
+            use = c_ulong()
+            stop_mode = c_ulong()
+            selection = c_ulong()
+            positive_pos = c_double()
+            negative_pos = c_double()
+            result = self.dll.AxmSignalGetSoftLimit(
+                axis_no,
+                ctypes.byref(use),
+                ctypes.byref(stop_mode),
+                ctypes.byref(selection),
+                ctypes.byref(positive_pos),
+                ctypes.byref(negative_pos),
+            )
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmSignalGetSoftLimit",
+                )
+            return (
+                use.value,
+                stop_mode.value,
+                selection.value,
+                positive_pos.value,
+                negative_pos.value,
+            )
+
+        return self._cached_get(axis_no, PARAM_SOFT_LIMIT, read)  # type: ignore[return-value]
+
+    def set_inpos_level(self, axis_no: int, level: int) -> int:
+        """Set in-position signal level (0: low, 1: high, 2: unused)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+        return self._cached_set(
+            axis_no,
+            PARAM_INPOS,
+            (level,),
+            lambda: self.dll.AxmSignalSetInpos(axis_no, level),
+        )
+
+    def get_inpos_level(self, axis_no: int) -> int:
+        """Get in-position signal level."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        def read() -> Tuple:
+            level = c_ulong()
+            result = self.dll.AxmSignalGetInpos(axis_no, ctypes.byref(level))
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmSignalGetInpos",
+                )
+            return (level.value,)
+
+        return self._cached_get(axis_no, PARAM_INPOS, read)[0]  # type: ignore[no-any-return]
+
+    def set_servo_alarm_level(self, axis_no: int, level: int) -> int:
+        """Set servo alarm input level (0: low, 1: high, 2: unused)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+        return self._cached_set(
+            axis_no,
+            PARAM_SERVO_ALARM,
+            (level,),
+            lambda: self.dll.AxmSignalSetServoAlarm(axis_no, level),
+        )
+
+    def get_servo_alarm_level(self, axis_no: int) -> int:
+        """Get servo alarm input level."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        def read() -> Tuple:
+            level = c_ulong()
+            result = self.dll.AxmSignalGetServoAlarm(axis_no, ctypes.byref(level))
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmSignalGetServoAlarm",
+                )
+            return (level.value,)
+
+        return self._cached_get(axis_no, PARAM_SERVO_ALARM, read)[0]  # type: ignore[no-any-return]
 
     def set_abs_rel_mode(self, axis_no: int, mode: int) -> int:
         """Set absolute/relative coordinate mode."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
-        return self.dll.AxmMotSetAbsRelMode(axis_no, mode)  # type: ignore[no-any-return]
+        return self._cached_set(
+            axis_no,
+            PARAM_ABS_REL_MODE,
+            (mode,),
+            lambda: self.dll.AxmMotSetAbsRelMode(axis_no, mode),
+        )
 
     def get_abs_rel_mode(self, axis_no: int) -> int:
         """Get current coordinate mode."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
 
-        mode = c_long()
-        result = self.dll.AxmMotGetAbsRelMode(axis_no, ctypes.byref(mode))
-        if result != AXT_RT_SUCCESS:
-            raise AXLMotionError(
-                get_error_message(result),
-                result,
-                "AxmMotGetAbsRelMode",
-            )
-        return mode.value
+        def read() -> Tuple:
+            mode = c_long()
+            result = self.dll.AxmMotGetAbsRelMode(axis_no, ctypes.byref(mode))
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmMotGetAbsRelMode",
+                )
+            return (mode.value,)
+
+        return self._cached_get(axis_no, PARAM_ABS_REL_MODE, read)[0]  # type: ignore[no-any-return]
 
     # === Velocity Motion Functions ===
     def move_start_vel(self, axis_no: int, velocity: float, accel: float, decel: float) -> int:
@@ -1221,7 +2132,88 @@ class AXLWrapper:
         axis_array = (c_long * axis_count)(*axis_list)
         decel_array = (c_double * axis_count)(*decels)
 
-        return self.dll.AxmMoveMultiStop(axis_array, decel_array, axis_count)  # type: ignore[no-any-return]
+        return self.dll.AxmMoveMultiStop(axis_count, axis_array, decel_array)  # type: ignore[no-any-return]
+
+    def move_multi_smooth_stop(self, axis_list: list[int]) -> int:
+        """Synchronized smooth stop of multiple axes using their default deceleration."""
+        if self.dll is None:
+            return AXT_RT_SUCCESS  # Mock mode (no library loaded)
+
+        axis_count = len(axis_list)
+        axis_array = (c_long * axis_count)(*axis_list)
+        return self.dll.AxmMoveMultiSStop(axis_count, axis_array)  # type: ignore[no-any-return]
+
+    def move_multi_emergency_stop(self, axis_list: list[int]) -> int:
+        """Synchronized emergency stop of multiple axes without deceleration."""
+        if self.dll is None:
+            return AXT_RT_SUCCESS  # Mock mode (no library loaded)
+
+        axis_count = len(axis_list)
+        axis_array = (c_long * axis_count)(*axis_list)
+        return self.dll.AxmMoveMultiEStop(axis_count, axis_array)  # type: ignore[no-any-return]
+
+    def move_start_multi_vel(
+        self,
+        axis_list: list[int],
+        velocities: list[float],
+        accels: list[float],
+        decels: list[float],
+        sync_mode: Optional[int] = None,
+    ) -> int:
+        """
+        Start synchronized velocity (jog) motion on multiple axes.
+
+        Args:
+            axis_list: Axis numbers to start together
+            velocities: Signed velocities (positive = CW, negative = CCW)
+            accels: Acceleration per axis
+            decels: Deceleration per axis
+            sync_mode: None uses AxmMoveStartMultiVel, otherwise AxmMoveStartMultiVelEx
+                with the given sync-stop mode (MULTI_VEL_SYNC_*)
+
+        Returns:
+            Result code (AXT_RT_SUCCESS on success)
+        """
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        axis_count = len(axis_list)
+        if not all(len(lst) == axis_count for lst in [velocities, accels, decels]):
+            raise ValueError("All parameter lists must have the same length")
+
+        axis_array = (c_long * axis_count)(*axis_list)
+        vel_array = (c_double * axis_count)(*velocities)
+        accel_array = (c_double * axis_count)(*accels)
+        decel_array = (c_double * axis_count)(*decels)
+
+        if sync_mode is None:
+            return self.dll.AxmMoveStartMultiVel(  # type: ignore[no-any-return]
+                axis_count, axis_array, vel_array, accel_array, decel_array
+            )
+        return self.dll.AxmMoveStartMultiVelEx(  # type: ignore[no-any-return]
+            axis_count, axis_array, vel_array, accel_array, decel_array, sync_mode
+        )
+
+    def override_set_max_vel(self, axis_no: int, max_vel: float) -> int:
+        """Set the highest velocity that later velocity overrides may request."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+        return self.dll.AxmOverrideSetMaxVel(axis_no, max_vel)  # type: ignore[no-any-return]
+
+    def override_multi_vel(self, axis_list: list[int], velocities: list[float]) -> int:
+        """Override the velocity of multiple moving axes in a single call."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        axis_count = len(axis_list)
+        if len(velocities) != axis_count:
+            raise ValueError("Velocity list must match axis list length")
+
+        axis_array = (c_long * axis_count)(*axis_list)
+        vel_array = (c_double * axis_count)(*velocities)
+        return self.dll.AxmOverrideMultiVel(  # type: ignore[no-any-return]
+            axis_count, axis_array, vel_array
+        )
 
     # === Parameter Loading/Saving Functions ===
     def load_para_all(self, file_path: str) -> int:
@@ -1230,7 +2222,11 @@ class AXLWrapper:
             raise AXLError("AXL DLL not loaded")
 
         file_path_bytes = file_path.encode("ascii")
-        return self.dll.AxmMotLoadParaAll(file_path_bytes)  # type: ignore[no-any-return]
+        try:
+            return self.dll.AxmMotLoadParaAll(file_path_bytes)  # type: ignore[no-any-return]
+        finally:
+            # A partial load may have changed some axes, so drop everything
+            self._param_cache.invalidate()
 
     def save_para_all(self, file_path: str) -> int:
         """Save all motion parameters to file."""
@@ -1248,85 +2244,276 @@ class AXLWrapper:
         """Set maximum velocity for axis."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
-        return self.dll.AxmMotSetMaxVel(axis_no, max_vel)  # type: ignore[no-any-return]
+        return self._cached_set(
+            axis_no,
+            PARAM_MAX_VEL,
+            (max_vel,),
+            lambda: self.dll.AxmMotSetMaxVel(axis_no, max_vel),
+        )
 
     def get_max_vel(self, axis_no: int) -> float:
         """Get maximum velocity for axis."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
 
-        max_vel = c_double()
-        result = self.dll.AxmMotGetMaxVel(axis_no, ctypes.byref(max_vel))
-        if result != AXT_RT_SUCCESS:
-            raise AXLMotionError(
-                get_error_message(result),
-                result,
-                "AxmMotGetMaxVel",
-            )
-        return max_vel.value
+        def read() -> Tuple:
+            max_vel = c_double()
+            result = self.dll.AxmMotGetMaxVel(axis_no, ctypes.byref(max_vel))
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmMotGetMaxVel",
+                )
+            return (max_vel.value,)
+
+        return self._cached_get(axis_no, PARAM_MAX_VEL, read)[0]  # type: ignore[no-any-return]
 
     def set_min_vel(self, axis_no: int, min_vel: float) -> int:
         """Set minimum velocity for axis."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
-        return self.dll.AxmMotSetMinVel(axis_no, min_vel)  # type: ignore[no-any-return]
+        return self._cached_set(
+            axis_no,
+            PARAM_MIN_VEL,
+            (min_vel,),
+            lambda: self.dll.AxmMotSetMinVel(axis_no, min_vel),
+        )
 
     def get_min_vel(self, axis_no: int) -> float:
         """Get minimum velocity for axis."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
 
-        min_vel = c_double()
-        result = self.dll.AxmMotGetMinVel(axis_no, ctypes.byref(min_vel))
-        if result != AXT_RT_SUCCESS:
-            raise AXLMotionError(
-                get_error_message(result),
-                result,
-                "AxmMotGetMinVel",
-            )
-        return min_vel.value
+        def read() -> Tuple:
+            min_vel = c_double()
+            result = self.dll.AxmMotGetMinVel(axis_no, ctypes.byref(min_vel))
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmMotGetMinVel",
+                )
+            return (min_vel.value,)
+
+        return self._cached_get(axis_no, PARAM_MIN_VEL, read)[0]  # type: ignore[no-any-return]
 
     def set_accel_unit(self, axis_no: int, accel_unit: int) -> int:
         """Set acceleration unit for axis."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
-        return self.dll.AxmMotSetAccelUnit(axis_no, accel_unit)  # type: ignore[no-any-return]
+        return self._cached_set(
+            axis_no,
+            PARAM_ACCEL_UNIT,
+            (accel_unit,),
+            lambda: self.dll.AxmMotSetAccelUnit(axis_no, accel_unit),
+        )
 
     def get_accel_unit(self, axis_no: int) -> int:
         """Get acceleration unit for axis."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
 
-        accel_unit = c_long()
-        result = self.dll.AxmMotGetAccelUnit(axis_no, ctypes.byref(accel_unit))
+        def read() -> Tuple:
+            accel_unit = c_long()
+            result = self.dll.AxmMotGetAccelUnit(axis_no, ctypes.byref(accel_unit))
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmMotGetAccelUnit",
+                )
+            return (accel_unit.value,)
+
+        return self._cached_get(axis_no, PARAM_ACCEL_UNIT, read)[0]  # type: ignore[no-any-return]
+
+    def set_profile_mode(self, axis_no: int, profile_mode: int) -> int:
+        """Set motion profile mode for axis."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+        return self._cached_set(
+            axis_no,
+            PARAM_PROFILE_MODE,
+            (profile_mode,),
+            lambda: self.dll.AxmMotSetProfileMode(axis_no, profile_mode),
+        )
+
+    def get_profile_mode(self, axis_no: int) -> int:
+        """Get motion profile mode for axis."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        def read() -> Tuple:
+            profile_mode = c_long()
+            result = self.dll.AxmMotGetProfileMode(axis_no, ctypes.byref(profile_mode))
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmMotGetProfileMode",
+                )
+            return (profile_mode.value,)
+
+        return self._cached_get(axis_no, PARAM_PROFILE_MODE, read)[0]  # type: ignore[no-any-return]
+
+    def set_accel_jerk(self, axis_no: int, jerk: float) -> int:
+        """Set S-curve acceleration jerk (% of the acceleration phase)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+        return self.dll.AxmMotSetAccelJerk(axis_no, jerk)  # type: ignore[no-any-return]
+
+    def get_accel_jerk(self, axis_no: int) -> float:
+        """Get S-curve acceleration jerk (% of the acceleration phase)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        jerk = c_double()
+        result = self.dll.AxmMotGetAccelJerk(axis_no, ctypes.byref(jerk))
         if result != AXT_RT_SUCCESS:
-            raise AXLMotionError(
-                get_error_message(result),
-                result,
-                "AxmMotGetAccelUnit",
+            raise AXLMotionError(get_error_message(result), result, "AxmMotGetAccelJerk")
+        return jerk.value
+
+    def set_decel_jerk(self, axis_no: int, jerk: float) -> int:
+        """Set S-curve deceleration jerk (% of the deceleration phase)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+        return self.dll.AxmMotSetDecelJerk(axis_no, jerk)  # type: ignore[no-any-return]
+
+    def get_decel_jerk(self, axis_no: int) -> float:
+        """Get S-curve deceleration jerk (% of the deceleration phase)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        jerk = c_double()
+        result = self.dll.AxmMotGetDecelJerk(axis_no, ctypes.byref(jerk))
+        if result != AXT_RT_SUCCESS:
+            raise AXLMotionError(get_error_message(result), result, "AxmMotGetDecelJerk")
+        return jerk.value
+
+    def set_torque_limit(self, axis_no: int, plus_limit: float, minus_limit: float) -> int:
+        """Set torque limit per direction (% of rated torque)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+        return self._cached_set(
+            axis_no,
+            PARAM_TORQUE_LIMIT,
+            (plus_limit, minus_limit),
+            lambda: self.dll.AxmMotSetTorqueLimit(axis_no, plus_limit, minus_limit),
+        )
+
+    def get_torque_limit(self, axis_no: int) -> Tuple[float, float]:
+        """Get torque limit as (plus direction, minus direction)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        def read() -> Tuple:
+            plus_limit = c_double()
+            minus_limit = c_double()
+            result = self.dll.AxmMotGetTorqueLimit(
+                axis_no, ctypes.byref(plus_limit), ctypes.byref(minus_limit)
+            )
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmMotGetTorqueLimit",
+                )
+            return (plus_limit.value, minus_limit.value)
+
+        plus_limit, minus_limit = self._cached_get(axis_no, PARAM_TORQUE_LIMIT, read)
+        return (plus_limit, minus_limit)
+
+    # === Compensation Functions ===
+    def set_backlash(self, axis_no: int, direction: int, backlash: float) -> int:
+        """Set backlash compensation direction and amount."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+        return self._cached_set(
+            axis_no,
+            PARAM_BACKLASH,
+            (direction, backlash),
+            lambda: self.dll.AxmCompensationSetBacklash(axis_no, direction, backlash),
+        )
+
+    def get_backlash(self, axis_no: int) -> Tuple[int, float]:
+        """Get backlash compensation as (direction, amount)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        def read() -> Tuple:
+            direction = c_long()
+            backlash = c_double()
+            result = self.dll.AxmCompensationGetBacklash(
+                axis_no, ctypes.byref(direction), ctypes.byref(backlash)
             )
-        return accel_unit.value
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmCompensationGetBacklash",
+                )
+            return (direction.value, backlash.value)
 
-    def set_profile_mode(self, axis_no: int, profile_mode: int) -> int:
-        """Set motion profile mode for axis."""
+        direction, backlash = self._cached_get(axis_no, PARAM_BACKLASH, read)
+        return (direction, backlash)
+
+    def enable_backlash(self, axis_no: int, enable: int) -> int:
+        """Enable (1) or disable (0) backlash compensation."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
-        return self.dll.AxmMotSetProfileMode(axis_no, profile_mode)  # type: ignore[no-any-return]
+        return self._cached_set(
+            axis_no,
+            PARAM_BACKLASH_ENABLE,
+            (enable,),
+            lambda: self.dll.AxmCompensationEnableBacklash(axis_no, enable),
+        )
 
-    def get_profile_mode(self, axis_no: int) -> int:
-        """Get motion profile mode for axis."""
+    def is_backlash_enabled(self, axis_no: int) -> int:
+        """Get backlash compensation enable state."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
 
-        profile_mode = c_long()
-        result = self.dll.AxmMotGetProfileMode(axis_no, ctypes.byref(profile_mode))
-        if result != AXT_RT_SUCCESS:
-            raise AXLMotionError(
-                get_error_message(result),
-                result,
-                "AxmMotGetProfileMode",
-            )
-        return profile_mode.value
+        def read() -> Tuple:
+            enable = c_ulong()
+            result = self.dll.AxmCompensationIsEnableBacklash(axis_no, ctypes.byref(enable))
+            if result != AXT_RT_SUCCESS:
+                raise AXLMotionError(
+                    get_error_message(result),
+                    result,
+                    "AxmCompensationIsEnableBacklash",
+                )
+            return (enable.value,)
+
+        (enable,) = self._cached_get(axis_no, PARAM_BACKLASH_ENABLE, read)
+        return enable  # type: ignore[no-any-return]
+
+    # === Parameter Cache ===
+    def _cached_set(self, axis_no: int, name: str, value: Tuple, write: Callable[[], int]) -> int:
+        """Write a parameter unless the cache says the board already holds it."""
+        if self._param_cache.is_current(axis_no, name, value):
+            return AXT_RT_SUCCESS
+        result = write()
+        if result == AXT_RT_SUCCESS:
+            self._param_cache.store(axis_no, name, value)
+        else:
+            self._param_cache.invalidate(axis_no, name)
+        return result  # type: ignore[no-any-return]
+
+    def _cached_get(self, axis_no: int, name: str, read: Callable[[], Tuple]) -> Tuple:
+        """Serve a parameter from the cache, reading the driver on a miss."""
+        value = self._param_cache.lookup(axis_no, name)
+        if value is None:
+            value = read()
+            self._param_cache.store(axis_no, name, value)
+        return value
+
+    def invalidate_parameter_cache(self, axis_no: Optional[int] = None) -> None:
+        """Drop cached parameters (e.g. after changing them outside this wrapper)."""
+        self._param_cache.invalidate(axis_no)
+
+    def get_parameter_cache_stats(self) -> Dict[str, int]:
+        """Parameter cache hit/miss counters."""
+        return self._param_cache.get_stats()
 
     def _verify_dll_path(self) -> dict:
         """Verify DLL path and provide detailed information."""
@@ -1732,15 +2919,24 @@ class AXLWrapper:
 
     # Interrupt Functions
     def setup_interrupt_callback(self, module_no: int, callback_func) -> None:
-        """Set up interrupt with callback function."""
+        """
+        Set up interrupt with callback function.
+
+        callback_func(module_no, flag) runs on the library's interrupt thread. Plain
+        Python callables are wrapped in AXT_INTERRUPT_PROC; the wrapper keeps the
+        reference alive until the module's callback is replaced or cleared (None).
+        """
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
 
+        proc = callback_func
+        if callback_func is not None and not isinstance(callback_func, AXT_INTERRUPT_PROC):
+            proc = AXT_INTERRUPT_PROC(callback_func)
         result = self.dll.AxdiInterruptSetModule(
             module_no,
             None,  # hWnd (not used for callback method)
             0,  # uMessage (not used for callback method)
-            callback_func,  # Callback function
+            proc,  # Callback function
             None,  # pEvent (not used for callback method)
         )
 
@@ -1750,6 +2946,10 @@ class AXLWrapper:
                 result,
                 "AxdiInterruptSetModule",
             )
+        if proc is None:
+            self._interrupt_procs.pop(module_no, None)
+        else:
+            self._interrupt_procs[module_no] = proc
 
     def enable_module_interrupt(self, module_no: int, enable: bool = True) -> None:
         """Enable/disable interrupts for module."""
@@ -1788,20 +2988,21 @@ class AXLWrapper:
                 "AxdiInterruptEdgeSetBit",
             )
 
-    def read_interrupt_status(self, module_no: int) -> int:
-        """Read interrupt status for module."""
+    def read_interrupt_status(self) -> Tuple[int, int]:
+        """Read the (module_no, flag) of the last interrupt (event method)."""
         if self.dll is None:
             raise AXLError("AXL DLL not loaded")
 
+        module_no = c_long()
         status = wintypes.DWORD()
-        result = self.dll.AxdiInterruptRead(module_no, ctypes.byref(status))
+        result = self.dll.AxdiInterruptRead(ctypes.byref(module_no), ctypes.byref(status))
         if result != AXT_RT_SUCCESS:
             raise AXLError(
                 get_error_message(result),
                 result,
                 "AxdiInterruptRead",
             )
-        return status.value
+        return module_no.value, status.value
 
     # Utility Functions
     def batch_read_inputs(self, module_no: int, start_offset: int, count: int) -> List[bool]:
@@ -1995,6 +3196,250 @@ class AXLWrapper:
 
         return results[:count]
 
+    # === Analog Output Functions ===
+    def ao_get_channel_count(self) -> int:
+        """Get the total number of analog output channels."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        count = c_long()
+        result = self.dll.AxaoInfoGetChannelCount(ctypes.byref(count))
+        if result != AXT_RT_SUCCESS:
+            raise AXLError(
+                get_error_message(result),
+                result,
+                "AxaoInfoGetChannelCount",
+            )
+        return count.value
+
+    def ao_set_range(self, channel_no: int, min_volt: float, max_volt: float) -> None:
+        """Set the output voltage range of an analog output channel."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        result = self.dll.AxaoSetRange(channel_no, min_volt, max_volt)
+        if result != AXT_RT_SUCCESS:
+            raise AXLError(
+                get_error_message(result),
+                result,
+                "AxaoSetRange",
+            )
+
+    def ao_get_range(self, channel_no: int) -> Tuple[float, float]:
+        """Get the output voltage range of an analog output channel as (min, max)."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        min_volt = c_double()
+        max_volt = c_double()
+        result = self.dll.AxaoGetRange(channel_no, ctypes.byref(min_volt), ctypes.byref(max_volt))
+        if result != AXT_RT_SUCCESS:
+            raise AXLError(
+                get_error_message(result),
+                result,
+                "AxaoGetRange",
+            )
+        return (min_volt.value, max_volt.value)
+
+    def ao_write_multi_voltage(self, channels: Any, volts: Any, count: int) -> None:
+        """
+        Write several analog output channels in one call.
+
+        Args:
+            channels: ctypes c_long array of channel numbers
+            volts: ctypes c_double array of output voltages
+            count: Number of leading entries to write
+        """
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        result = self.dll.AxaoWriteMultiVoltage(count, channels, volts)
+        if result != AXT_RT_SUCCESS:
+            raise AXLError(
+                get_error_message(result),
+                result,
+                "AxaoWriteMultiVoltage",
+            )
+
+    def ao_write_multi_digit(self, channels: Any, digits: Any, count: int) -> None:
+        """
+        Write raw DAC codes to several analog output channels in one call.
+
+        Args:
+            channels: ctypes c_long array of channel numbers
+            digits: ctypes DWORD array of DAC codes
+            count: Number of leading entries to write
+        """
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        result = self.dll.AxaoWriteMultiDigit(count, channels, digits)
+        if result != AXT_RT_SUCCESS:
+            raise AXLError(
+                get_error_message(result),
+                result,
+                "AxaoWriteMultiDigit",
+            )
+
+    def ao_read_multi_voltage(self, channels: Any, volts: Any, count: int) -> None:
+        """
+        Read back the voltage of several analog output channels in one call.
+
+        Args:
+            channels: ctypes c_long array of channel numbers
+            volts: ctypes c_double array receiving the voltages
+            count: Number of leading entries to read
+        """
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        result = self.dll.AxaoReadMultiVoltage(count, channels, volts)
+        if result != AXT_RT_SUCCESS:
+            raise AXLError(
+                get_error_message(result),
+                result,
+                "AxaoReadMultiVoltage",
+            )
+
+    # === Analog Input Functions ===
+    def ai_read_multi_voltage(self, channels: Any, volts: Any, count: int) -> None:
+        """
+        Read several analog input channels in one call.
+
+        Args:
+            channels: ctypes c_long array of channel numbers
+            volts: ctypes c_double array receiving the voltages
+            count: Number of leading entries to read
+        """
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        result = self.dll.AxaiSwReadMultiVoltage(count, channels, volts)
+        if result != AXT_RT_SUCCESS:
+            raise AXLError(
+                get_error_message(result),
+                result,
+                "AxaiSwReadMultiVoltage",
+            )
+
+    # === Sequence / Trigger Table Functions ===
+    def _check_result(self, result: int, function_name: str) -> None:
+        if result != AXT_RT_SUCCESS:
+            raise AXLMotionError(get_error_message(result), result, function_name)
+
+    def seq_set_axis_map(self, seq_map_no: int, axes: List[int]) -> None:
+        """
+        Assign the axes a sequence map drives.
+
+        Args:
+            seq_map_no: Sequence map number
+            axes: Axis numbers, in node column order
+        """
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        axis_array = (c_long * len(axes))(*axes)
+        self._check_result(
+            self.dll.AxmSeqSetAxisMap(seq_map_no, len(axes), axis_array), "AxmSeqSetAxisMap"
+        )
+
+    def seq_upload_nodes(self, seq_map_no: int, nodes: Any, count: int, width: int) -> None:
+        """
+        Replace the node list of a sequence map.
+
+        Each node row holds one position per axis in the map, followed by the
+        velocity, acceleration, deceleration and next velocity of the move
+        to it (SEQ_NODE_PROFILE_FIELDS).
+
+        Args:
+            seq_map_no: Sequence map number
+            nodes: c_double pointer to count rows of width + SEQ_NODE_PROFILE_FIELDS
+                values, row-major
+            count: Number of nodes
+            width: Positions per node (axes in the map)
+        """
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        self._check_result(self.dll.AxmSeqBeginNode(seq_map_no), "AxmSeqBeginNode")
+        base = ctypes.cast(nodes, ctypes.c_void_p).value or 0
+        stride = (width + SEQ_NODE_PROFILE_FIELDS) * ctypes.sizeof(c_double)
+        for i in range(count):
+            node = ctypes.cast(base + i * stride, POINTER(c_double))
+            profile = node[width : width + SEQ_NODE_PROFILE_FIELDS]
+            self._check_result(
+                self.dll.AxmSeqAddNode(seq_map_no, node, *profile),
+                "AxmSeqAddNode",
+            )
+        self._check_result(self.dll.AxmSeqEndNode(seq_map_no), "AxmSeqEndNode")
+
+    def trigger_only_abs(self, axis_no: int, positions: Any, count: int) -> None:
+        """
+        Load absolute trigger positions for an axis.
+
+        Args:
+            axis_no: Axis number
+            positions: c_double pointer to count positions
+            count: Number of trigger positions
+        """
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        self._check_result(
+            self.dll.AxmTriggerOnlyAbs(axis_no, count, positions), "AxmTriggerOnlyAbs"
+        )
+
+    def set_torque_limit_at_pos(
+        self, axis_no: int, plus_limit: float, minus_limit: float, position: float, target: int = 0
+    ) -> None:
+        """
+        Switch the torque limit when the axis passes a position.
+
+        Args:
+            axis_no: Axis number
+            plus_limit: Plus direction torque limit (%)
+            minus_limit: Minus direction torque limit (%)
+            position: Switching position
+            target: Position source (0 = command, 1 = actual)
+        """
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        self._check_result(
+            self.dll.AxmMotSetTorqueLimitAtPos(axis_no, plus_limit, minus_limit, position, target),
+            "AxmMotSetTorqueLimitAtPos",
+        )
+
+    def counter_set_trigger_table(
+        self,
+        module_no: int,
+        table_pos: int,
+        points: Any,
+        pulse_counts: Any,
+        intervals: Any,
+        count: int,
+    ) -> None:
+        """
+        Load a counter module table with 2-D absolute trigger points.
+
+        Args:
+            module_no: Counter module number
+            table_pos: Trigger table of the module
+            points: c_double pointer to count X, Y pairs
+            pulse_counts: c_long pointer to count trigger pulses per point
+            intervals: c_double pointer to count pulse intervals (frequency)
+            count: Number of trigger points
+        """
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        self._check_result(
+            self.dll.AxcTableSetTriggerData(
+                module_no, table_pos, count, points, pulse_counts, intervals
+            ),
+            "AxcTableSetTriggerData",
+        )
+
     # === Servo Monitoring Functions ===
     def status_set_read_servo_load_ratio(self, axis_no: int, sel_mon: int) -> int:
         """
@@ -2093,6 +3538,172 @@ class AXLWrapper:
 
         return float(torque_value.value)
 
+    def status_read_vel(self, axis_no: int) -> float:
+        """
+        Read current command velocity.
+
+        Args:
+            axis_no: Axis number
+
+        Returns:
+            Signed velocity (unit/sec)
+
+        Raises:
+            AXLError: If DLL is not loaded
+            AXLMotionError: If read operation fails
+        """
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        velocity = c_double()
+        result = self.dll.AxmStatusReadVel(axis_no, ctypes.byref(velocity))
+
+        if result != AXT_RT_SUCCESS:
+            error_msg = get_error_message(result)
+            raise AXLMotionError(error_msg, result, "AxmStatusReadVel")
+
+        return float(velocity.value)
+
+    def status_set_mon(self, axis_no: int, params: List[int], use: bool = True) -> int:
+        """
+        Select up to four drive parameters to be buffered by the controller.
+
+        Unused slots repeat the last selected parameter; callers keep track of
+        how many slots are meaningful.
+
+        Args:
+            axis_no: Axis number
+            params: MON_PARA_* numbers (1 to 4 entries)
+            use: Enable (True) or disable (False) monitoring
+
+        Returns:
+            Result code (AXT_RT_SUCCESS on success)
+        """
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        if not hasattr(self.dll, "AxmStatusSetMon"):
+            raise AXLFunctionNotAvailableError(
+                "AxmStatusSetMon function not available in this AXL version"
+            )
+
+        if not 1 <= len(params) <= 4:
+            raise ValueError("Between 1 and 4 monitor parameters are required")
+        slots = list(params) + [params[-1]] * (4 - len(params))
+        return self.dll.AxmStatusSetMon(  # type: ignore[no-any-return]
+            axis_no, *slots, 1 if use else 0
+        )
+
+    def status_get_mon(self, axis_no: int) -> Tuple[Tuple[int, int, int, int], bool]:
+        """Get the monitored parameter selection and enable flag for axis."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        if not hasattr(self.dll, "AxmStatusGetMon"):
+            raise AXLFunctionNotAvailableError(
+                "AxmStatusGetMon function not available in this AXL version"
+            )
+
+        slots = [wintypes.DWORD() for _ in range(4)]
+        use = wintypes.DWORD()
+        result = self.dll.AxmStatusGetMon(
+            axis_no, *[ctypes.byref(s) for s in slots], ctypes.byref(use)
+        )
+        if result != AXT_RT_SUCCESS:
+            raise AXLMotionError(
+                get_error_message(result),
+                result,
+                "AxmStatusGetMon",
+            )
+        return (
+            (slots[0].value, slots[1].value, slots[2].value, slots[3].value),
+            bool(use.value),
+        )
+
+    def status_read_mon(self, axis_no: int) -> Tuple[Tuple[int, int, int, int], bool]:
+        """Read the latest monitored values (raw DWORDs) and the data-valid flag."""
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        if not hasattr(self.dll, "AxmStatusReadMon"):
+            raise AXLFunctionNotAvailableError(
+                "AxmStatusReadMon function not available in this AXL version"
+            )
+
+        slots = [wintypes.DWORD() for _ in range(4)]
+        valid = wintypes.DWORD()
+        result = self.dll.AxmStatusReadMon(
+            axis_no, *[ctypes.byref(s) for s in slots], ctypes.byref(valid)
+        )
+        if result != AXT_RT_SUCCESS:
+            raise AXLMotionError(
+                get_error_message(result),
+                result,
+                "AxmStatusReadMon",
+            )
+        return (
+            (slots[0].value, slots[1].value, slots[2].value, slots[3].value),
+            bool(valid.value),
+        )
+
+    def status_read_mon_ex(self, axis_no: int, buffer: Any) -> int:
+        """
+        Drain buffered monitor data into a caller-owned DWORD array.
+
+        The buffer is reused across calls so the drain loop does not allocate.
+
+        Args:
+            axis_no: Axis number
+            buffer: ctypes DWORD array large enough for the controller buffer
+
+        Returns:
+            Number of DWORDs written into buffer
+        """
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        if not hasattr(self.dll, "AxmStatusReadMonEx"):
+            raise AXLFunctionNotAvailableError(
+                "AxmStatusReadMonEx function not available in this AXL version"
+            )
+
+        count = c_long()
+        result = self.dll.AxmStatusReadMonEx(axis_no, ctypes.byref(count), buffer)
+        if result != AXT_RT_SUCCESS:
+            raise AXLMotionError(
+                get_error_message(result),
+                result,
+                "AxmStatusReadMonEx",
+            )
+        return count.value
+
+    def status_read_motion_info(self, axis_no: int, info: MOTION_INFO) -> None:
+        """
+        Read several status values of an axis from the same controller cycle.
+
+        Fields selected by info.dwMask (MOTION_INFO_* bits) are filled in place; the
+        structure is caller-owned so samplers can reuse it without allocating.
+
+        Raises:
+            AXLError: If the DLL is not loaded
+            AXLFunctionNotAvailableError: If the function is not available
+        """
+        if self.dll is None:
+            raise AXLError("AXL DLL not loaded")
+
+        if not hasattr(self.dll, "AxmStatusReadMotionInfo"):
+            raise AXLFunctionNotAvailableError(
+                "AxmStatusReadMotionInfo function not available in this AXL version"
+            )
+
+        result = self.dll.AxmStatusReadMotionInfo(axis_no, ctypes.byref(info))
+        if result != AXT_RT_SUCCESS:
+            raise AXLMotionError(
+                get_error_message(result),
+                result,
+                "AxmStatusReadMotionInfo",
+            )
+
     @classmethod
     def get_instance(cls) -> "AXLWrapper":
         """
@@ -2171,7 +3782,7 @@ class AXLWrapper:
             if self._connection_count <= 0:
                 if self.is_opened():
                     result = self.close()
-                    if result == AXT_RT_SUCCESS:
+                    if result:  # AxlClose returns BOOL (TRUE on success)
                         logger.info("AXL disconnected successfully")
                     else:
                         logger.warning(f"AXL disconnect failed (Code: {result})")
@@ -0,0 +1,261 @@
+"""
+AJINEXTEK Per-Board Lock Sharding
+
+ShardedAXL wraps an AXLWrapper so that concurrent callers only serialize
+when they talk to the same board. Every wrapper method is routed by its
+first argument:
+
+- axis_no             -> board of the axis (AxmInfoGetAxis)
+- axis_list / axes    -> boards of all listed axes, locked in board order
+- module_no           -> board of the DIO module (AxdInfoGetModule)
+- channel_no          -> board of the AIO channel
+- counter_* methods   -> board of the counter module or channel in the first
+                         argument (assigned explicitly)
+- channels + count    -> boards of the listed AIO channels
+- board_no            -> that board
+
+Methods without a resource argument (open, close, parameter files ...) take
+every board lock. Read-only status methods (status_read_*, read_*, position
+and servo state getters) take no lock at all, except reads that consume
+driver state: status_read_mon_ex drains the axis monitor FIFO and
+read_interrupt_status pops the interrupt queue, so they are routed like any
+other call. Resources the topology does not know share one extra lock, so an
+incomplete topology stays safe.
+
+The wrapper's ctypes calls release the GIL, so calls guarded by different
+board locks overlap in the driver. scripts/benchmark_board_locks.py shows
+the scaling against a single lock.
+"""
+
+# Standard library imports
+from dataclasses import dataclass, field
+import inspect
+import threading
+import time
+from typing import Any, Callable, Dict, Iterable, List, Optional, Tuple
+
+# Third-party imports
+from loguru import logger
+
+BOARD_UNMAPPED = -1  # Shard of resources missing from the topology
+
+RESOURCE_AXIS = "axis"
+RESOURCE_DIO = "dio"
+RESOURCE_AIO = "aio"
+RESOURCE_COUNTER = "counter"
+
+# Methods that only read status and may run without any board lock
+_LOCK_FREE_PREFIXES = ("status_read_", "read_")
+_LOCK_FREE_METHODS = frozenset(
+    {
+        "get_cmd_pos",
+        "get_act_pos",
+        "is_servo_on",
+        "home_get_result",
+        "home_get_rate",
+        "is_opened",
+        "get_board_count",
+        "get_parameter_cache_stats",
+    }
+)
+# Reads with side effects on driver queues; they keep their normal route
+_LOCKED_READ_METHODS = frozenset({"status_read_mon_ex", "read_interrupt_status"})
+
+
+@dataclass
+class BoardTopology:
+    """보드별 리소스 배치"""
+
+    axes: Dict[int, int] = field(default_factory=dict)  # axis -> board
+    dio_modules: Dict[int, int] = field(default_factory=dict)  # module -> board
+    aio_channels: Dict[int, int] = field(default_factory=dict)  # channel -> board
+    counter_channels: Dict[int, int] = field(default_factory=dict)  # channel -> board
+
+    @classmethod
+    def discover(cls, axl: Any) -> "BoardTopology":
+        """Read axis and DIO module locations from the library"""
+        topology = cls()
+        for axis_no in range(axl.get_axis_count()):
+            topology.axes[axis_no] = axl.get_axis_info(axis_no)[0]
+        try:
+            module_count = axl.get_dio_module_count() if axl.is_dio_module() else 0
+        except Exception as e:
+            logger.warning(f"DIO topology not available: {e}")
+            module_count = 0
+        for module_no in range(module_count):
+            topology.dio_modules[module_no] = axl.get_module_info(module_no)[0]
+        logger.info(
+            f"Board topology: {len(topology.axes)} axes, {len(topology.dio_modules)} DIO "
+            f"modules on boards {sorted(topology.boards())}"
+        )
+        return topology
+
+    def assign_aio(self, channels: Iterable[int], board_no: int) -> None:
+        for channel in channels:
+            self.aio_channels[channel] = board_no
+
+    def assign_counter(self, channels: Iterable[int], board_no: int) -> None:
+        for channel in channels:
+            self.counter_channels[channel] = board_no
+
+    def board_of(self, kind: str, index: int) -> int:
+        table = {
+            RESOURCE_AXIS: self.axes,
+            RESOURCE_DIO: self.dio_modules,
+            RESOURCE_AIO: self.aio_channels,
+            RESOURCE_COUNTER: self.counter_channels,
+        }[kind]
+        return table.get(index, BOARD_UNMAPPED)
+
+    def boards(self) -> set:
+        return {
+            *self.axes.values(),
+            *self.dio_modules.values(),
+            *self.aio_channels.values(),
+            *self.counter_channels.values(),
+        }
+
+
+@dataclass
+class _ShardStats:
+    acquisitions: int = 0
+    contended: int = 0
+    wait_time: float = 0.0
+
+
+class ShardedAXL:
+    """보드별 락으로 AXL 호출을 보호하는 래퍼 프록시"""
+
+    def __init__(self, axl: Optional[Any] = None, topology: Optional[BoardTopology] = None):
+        """
+        초기화
+
+        Args:
+            axl: AXLWrapper instance (defaults to the process-wide singleton)
+            topology: Resource-to-board map (defaults to BoardTopology.discover(axl))
+        """
+        if axl is None:
+            # Local application imports
+            from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import (
+                AXLWrapper,
+            )
+
+            axl = AXLWrapper.get_instance()
+        if topology is None:
+            topology = BoardTopology.discover(axl)
+
+        self._axl = axl
+        self._topology = topology
+        boards = sorted(topology.boards() | {BOARD_UNMAPPED})
+        self._locks: Dict[int, threading.RLock] = {b: threading.RLock() for b in boards}
+        self._stats: Dict[int, _ShardStats] = {b: _ShardStats() for b in boards}
+        self._routes: Dict[str, Callable[[Tuple, Dict], List[int]]] = {}
+
+    @property
+    def axl(self) -> Any:
+        return self._axl
+
+    @property
+    def topology(self) -> BoardTopology:
+        return self._topology
+
+    def __getattr__(self, name: str) -> Any:
+        attr = getattr(self._axl, name)
+        if not callable(attr) or name.startswith("_"):
+            return attr
+        route = self._routes.get(name)
+        if route is None:
+            route = self._routes[name] = self._build_route(name, attr)
+
+        def call(*args: Any, **kwargs: Any) -> Any:
+            boards = route(args, kwargs)
+            if not boards:
+                return attr(*args, **kwargs)
+            self._acquire(boards)
+            try:
+                return attr(*args, **kwargs)
+            finally:
+                for board in reversed(boards):
+                    self._locks[board].release()
+
+        call.__name__ = name
+        return call
+
+    # ========================================================================
+    # Routing
+    # ========================================================================
+
+    def _build_route(self, name: str, method: Callable) -> Callable[[Tuple, Dict], List[int]]:
+        """Map a method's resource argument to the boards it must lock"""
+        if name in _LOCK_FREE_METHODS or (
+            name.startswith(_LOCK_FREE_PREFIXES) and name not in _LOCKED_READ_METHODS
+        ):
+            return lambda args, kwargs: []
+
+        try:
+            params = list(inspect.signature(method).parameters)
+        except (TypeError, ValueError):
+            params = []
+        first = params[0] if params else None
+        everything = sorted(self._locks)
+
+        def arg(args: Tuple, kwargs: Dict, key: str, position: int = 0) -> Any:
+            return args[position] if len(args) > position else kwargs[key]
+
+        def shard(boards: Iterable[int]) -> List[int]:
+            return sorted(set(boards))
+
+        topology = self._topology
+        if first == "axis_no":
+            return lambda a, k: [topology.board_of(RESOURCE_AXIS, arg(a, k, first))]
+        if first in ("axis_list", "axes"):
+            return lambda a, k: shard(
+                topology.board_of(RESOURCE_AXIS, axis) for axis in arg(a, k, first)
+            )
+        if name.startswith("counter_") and first in ("module_no", "channel_no"):
+            return lambda a, k: [topology.board_of(RESOURCE_COUNTER, arg(a, k, first))]
+        if first == "module_no":
+            return lambda a, k: [topology.board_of(RESOURCE_DIO, arg(a, k, first))]
+        if first == "channel_no":
+            return lambda a, k: [topology.board_of(RESOURCE_AIO, arg(a, k, first))]
+        if first == "channels" and "count" in params:
+            index = params.index("count")
+            return lambda a, k: shard(
+                topology.board_of(RESOURCE_AIO, channel)
+                for channel in list(arg(a, k, "channels"))[: arg(a, k, "count", index)]
+            )
+        if first == "board_no":
+
+            def by_board(a: Tuple, k: Dict) -> List[int]:
+                board = arg(a, k, first)
+                return [board if board in self._locks else BOARD_UNMAPPED]
+
+            return by_board
+        return lambda args, kwargs: everything
+
+    def _acquire(self, boards: List[int]) -> None:
+        """Lock boards in ascending order (no lock-order deadlocks)"""
+        for board in boards:
+            lock = self._locks[board]
+            stats = self._stats[board]
+            if not lock.acquire(blocking=False):
+                started = time.perf_counter()
+                lock.acquire()
+                stats.contended += 1
+                stats.wait_time += time.perf_counter() - started
+            stats.acquisitions += 1
+
+    # ========================================================================
+    # Status
+    # ========================================================================
+
+    def get_stats(self) -> Dict[str, Any]:
+        """Per-board acquisitions, contended acquisitions and total wait"""
+        return {
+            board: {
+                "acquisitions": s.acquisitions,
+                "contended": s.contended,
+                "wait_ms": s.wait_time * 1000,
+            }
+            for board, s in self._stats.items()
+        }
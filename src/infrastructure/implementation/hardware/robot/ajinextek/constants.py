@@ -103,6 +103,13 @@ DIR_CW = 1  # Clockwise
 MOTION_PROFILE_TRAP = 0  # Trapezoidal
 MOTION_PROFILE_SCURVE = 1  # S-curve
 
+# AxmMotSetAccelUnit values
+ACCEL_UNIT_PER_SEC2 = 0  # Accel/decel given as unit/s^2
+ACCEL_UNIT_SEC = 1  # Accel/decel given as times (s)
+
+# AxmMotSetProfileMode values whose accel/decel phases are shaped by AxmMot*Jerk
+PROFILE_S_CURVE_MODES = (2, 3, 4, 7, 8)  # Quasi-S, sym S, asym S, MLIII S/W sym S, asym S
+
 # Home search directions
 HOME_DIR_CCW = 0  # CCW direction
 HOME_DIR_CW = 1  # CW direction
@@ -133,6 +140,107 @@ HOME_ERR_UNKNOWN = 0xFF  # Unknown axis number
 LIMIT_STOP_DECEL = 0  # Stop with deceleration when limit triggered
 LIMIT_STOP_IMMEDIATE = 1  # Immediate stop when limit triggered
 
+# Multi-axis velocity sync-stop modes (AxmMoveStartMultiVelEx dwSyncMode)
+MULTI_VEL_SYNC_NONE = 0  # Axes stop independently
+MULTI_VEL_SYNC_STOP = 1  # Stopping one axis stops the whole group
+MULTI_VEL_SYNC_ALARM = 2  # Group also stops when any axis raises an alarm
+
+# Multi-axis jog deadman supervision
+JOG_WATCHDOG_PERIOD = 0.02  # Keepalive check period (s)
+JOG_DEFAULT_DEADMAN_TIMEOUT = 0.3  # Stop the jog when no keepalive arrives within (s)
+
+# Drive parameter monitor (AxmStatusSetMon, SIIIH / MR-J4-B drives)
+MON_PARA_CMD_POS = 0  # Command position
+MON_PARA_ACT_POS = 1  # Actual position
+MON_PARA_ACT_VEL = 2  # Actual velocity
+MON_PARA_MECH_SIGNAL = 3  # Mechanical signal
+MON_PARA_REGEN_LOAD = 4  # Regeneration load factor (%)
+MON_PARA_EFFECTIVE_LOAD = 5  # Effective load factor (%)
+MON_PARA_PEAK_LOAD = 6  # Peak load factor (%)
+MON_PARA_CURRENT_FEEDBACK = 7  # Current feedback
+MON_PARA_CMD_VEL = 8  # Command velocity
+MON_PARA_NAMES = {
+    MON_PARA_CMD_POS: "cmd_pos",
+    MON_PARA_ACT_POS: "act_pos",
+    MON_PARA_ACT_VEL: "act_vel",
+    MON_PARA_MECH_SIGNAL: "mech_signal",
+    MON_PARA_REGEN_LOAD: "regen_load",
+    MON_PARA_EFFECTIVE_LOAD: "effective_load",
+    MON_PARA_PEAK_LOAD: "peak_load",
+    MON_PARA_CURRENT_FEEDBACK: "current_feedback",
+    MON_PARA_CMD_VEL: "cmd_vel",
+}
+MON_MAX_PARAMS = 4  # Parameter slots per axis
+MON_READ_BUFFER_WORDS = 4096  # DWORDs fetched per AxmStatusReadMonEx call
+MON_DEFAULT_DRAIN_PERIOD = 0.05  # Drain timer period (s)
+
+# Motion info snapshot (AxmStatusReadMotionInfo MOTION_INFO.dwMask bits, AXHS.h)
+MOTION_INFO_CMD_POS = 0x01  # dCmdPos
+MOTION_INFO_ACT_POS = 0x02  # dActPos
+MOTION_INFO_MECH_SIG = 0x04  # dwMechSig
+MOTION_INFO_DRV_STAT = 0x08  # dwDrvStat
+MOTION_INFO_UNIV_IO = 0x10  # dwInput and dwOutput (universal signals)
+MOTION_INFO_ALL = 0x1F
+MOTION_INFO_POSITIONS = MOTION_INFO_CMD_POS | MOTION_INFO_ACT_POS
+MECH_SIG_PELM = 0x01  # dwMechSig: positive end limit
+MECH_SIG_NELM = 0x02  # Negative end limit
+MECH_SIG_ALARM = 0x10  # Servo alarm
+MECH_SIG_INPOS = 0x20  # In position
+
+# Sequence motion (AxmSeqAddNode, AXDev.h)
+SEQ_NODE_PROFILE_FIELDS = 4  # Velocity, acceleration, deceleration, next velocity per node
+
+# Coherent position sampler
+POSITION_SAMPLE_PERIOD = 0.002  # Capture period per sampler tick (s)
+POSITION_RING_CAPACITY = 30000  # (cmd, act) pairs kept per axis (60 s at the default period)
+
+# Background bring-up (AxlOpen retry backoff)
+BRINGUP_OPEN_DEADLINE = 10.0  # Give up opening the library after (s)
+BRINGUP_BACKOFF_FACTOR = 2.0  # Retry delay multiplier per consecutive failure
+BRINGUP_BACKOFF_JITTER = 0.1  # Relative random jitter added to each retry delay
+
+# Analog output ramping (Axao*)
+AO_DEFAULT_TICK_PERIOD = 0.005  # Ramp timer period (s)
+AO_DEFAULT_READBACK_EVERY = 20  # Read back all channels every N ticks (0 = never)
+AO_MIN_VOLT = -10.0  # AO4R / AO2Hx output range
+AO_MAX_VOLT = 10.0
+
+# Sensorless force estimation (AxmStatusReadServoLoadRatio)
+LOAD_RATIO_ACCUMULATED = 0x00  # Accumulated load ratio
+LOAD_RATIO_REGENERATIVE = 0x01  # Regenerative load ratio
+LOAD_RATIO_REFERENCE_TORQUE = 0x02  # Reference torque load ratio
+FORCE_EST_MIN_SAMPLES = 8  # Calibration samples required before fitting
+FORCE_EST_CONFIDENCE_Z = 3.0  # Confidence bound half-width in prediction standard deviations
+FORCE_EST_VELOCITY_DEADBAND = 1.0  # |velocity| below this counts as standing (unit/s)
+
+# Process image scan cycle
+SCAN_DEFAULT_PERIOD = 0.01  # Scan cycle period (s)
+SCAN_DWORD_BITS = 32  # DIO points per AxdiReadInportDword / AxdoWriteOutportDword
+INTERLOCK_SCAN_PERIOD = 0.001  # Scan period of an interlock engine's own scanner (s)
+INTERLOCK_MAX_MISSED_SCANS = 3  # Failed scans in a row before the stop rules are tripped
+
+# Multi-rate sampling scheduler
+SCHEDULER_TICK = 0.005  # Scheduler time quantum; task periods are rounded to it (s)
+SCHEDULER_IDLE_AFTER = 2.0  # Time without motion before an axis counts as idle (s)
+SCHEDULER_IDLE_SLOWDOWN = 10  # Default period multiplier of axis tasks while the axis is idle
+
+# Loopback IO latency probe
+IO_PROBE_SAMPLES = 200  # Edges timed per mode
+IO_PROBE_TIMEOUT = 0.1  # Wait limit for one edge; later edges count as timeouts (s)
+IO_PROBE_POLL_INTERVAL = 0.0  # Pause between input polls, 0 = spin (s)
+IO_PROBE_SETTLE = 0.002  # Pause between edges (s)
+IO_PROBE_TIMEOUT_MARGIN = 3.0  # Suggested edge timeout = worst latency x margin
+
+# Measurement travel-order planning
+TRAVEL_EXACT_MAX_GROUPS = 10  # Temperatures ordered exactly (DP); greedy beyond this
+
+# Board data flash (AxlSetDataFlash / AxlGetDataFlash, PCI-R1604 RTEX master)
+DATA_FLASH_PAGE_COUNT = 200  # Pages 0..199
+DATA_FLASH_PAGE_SIZE = 120  # Bytes per page (lBytesNum 1..120)
+DATA_FLASH_WRITE_TIME = 0.017  # Worst-case page write time; next write waits for it (s)
+DATA_FLASH_BUSY_RETRIES = 3  # Retries of a write rejected with AXT_RT_DATA_FLASH_BUSY
+DATA_FLASH_RESERVE_PAGES = 2  # Free pages kept for compaction
+
 # Pulse output methods
 PULSE_OUT_METHOD_ONEPULSE = 0x00  # 1 pulse method
 PULSE_OUT_METHOD_TWOPULSE = 0x01  # 2 pulse method (CW/CCW)
@@ -0,0 +1,443 @@
+"""
+AJINEXTEK Cycle Trace What-If Analyzer
+
+Predicts the cycle-time effect of velocity, acceleration, settle and overlap
+changes from a trace recorded on the production line, before the changes
+are tried there.
+
+Recording: TracingAXL wraps the AXLWrapper and writes one BinaryLog record
+per driver call (start, duration, method, arguments, result); the sequence
+marks its phases with mark_phase(). The call path only stores the raw
+arguments and result in the log buffer; the BinaryLog writer renders them
+with repr() and load_trace() parses them back, so recording can stay on in
+production. Mutable arguments are rendered as they are at flush time.
+
+Analysis: load_trace() reads the records back and build_timeline() turns
+the calls of one host thread into a sequential timeline:
+
+- move     move_start_pos - driver call time plus a trapezoidal (or S-curve)
+           profile computed from the command and the axis profile settings
+           (AxisProfile: maximum velocity, accel unit, jerk)
+- wait     everything from the first in-motion poll after a move up to the
+           poll that sees the axis stop; the recorded poll overshoot past
+           the profile end is kept. Axes waited for together get one wait
+           each, the later one covering the time after the earlier stop
+- settle   the idle gap right after a wait (stabilization sleep)
+- call     any other driver call, at its recorded duration
+- dwell    any other idle gap (measurement, temperature, operator ...)
+
+CycleTimeline.simulate(WhatIf(...)) replays the timeline with modified
+commands and returns per-phase and total cycle times; simulate(WhatIf())
+reproduces the recorded times. Positions are tracked from the commands, so
+the first move of an axis needs a known start - from a get_cmd_pos /
+get_act_pos result in the trace or from start_positions; moves with an
+unknown distance keep their recorded motion time. Only point-to-point moves
+are re-simulated; other motion calls count at their recorded duration.
+"""
+
+# Standard library imports
+import ast
+from dataclasses import dataclass, field, replace
+from pathlib import Path
+import time
+from typing import Any, Dict, Iterable, List, Mapping, Optional, Tuple, Union
+
+# Local application imports
+from infrastructure.implementation.hardware.common.binary_log import BinaryLog, decode_records
+from infrastructure.implementation.hardware.robot.ajinextek.constants import POS_ABS, POS_REL
+from infrastructure.implementation.hardware.robot.ajinextek.measurement_order import (
+    AxisProfile,
+)
+
+TRACE_CALL_FORMAT = "axl {} {} {} {} -> {}"  # Start ns, duration ns, method, repr args/result
+TRACE_PHASE_FORMAT = "phase {} {}"  # Monotonic ns, phase name
+TRACE_DEFAULT_PHASE = "cycle"  # Phase of calls before the first marker
+
+SEGMENT_CALL = "call"
+SEGMENT_MOVE = "move"
+SEGMENT_WAIT = "wait"
+SEGMENT_SETTLE = "settle"
+SEGMENT_DWELL = "dwell"
+
+_POSITION_READS = ("get_cmd_pos", "get_act_pos")
+
+
+def _parse(text: str) -> Any:
+    """Literal value of a rendered argument or result (the text itself if not a literal)"""
+    try:
+        return ast.literal_eval(text)
+    except (ValueError, SyntaxError):
+        return text
+
+
+class TracingAXL:
+    """AXL 호출 타이밍 기록 프록시 (BinaryLog)"""
+
+    def __init__(self, axl: Any, log: BinaryLog):
+        """
+        초기화
+
+        Args:
+            axl: AXLWrapper instance to trace
+            log: Binary log receiving one record per call and phase marker
+        """
+        self._axl = axl
+        self._log = log
+        self._call_format = log.define(TRACE_CALL_FORMAT)
+        self._phase_format = log.define(TRACE_PHASE_FORMAT)
+
+    def mark_phase(self, name: str) -> None:
+        """Start a new cycle phase; following calls are charged to it"""
+        self._log.log(self._phase_format, time.monotonic_ns(), name)
+
+    def __getattr__(self, name: str) -> Any:
+        attr = getattr(self._axl, name)
+        if name.startswith("_") or not callable(attr):
+            return attr
+
+        def traced(*args: Any, **kwargs: Any) -> Any:
+            arguments = args + (kwargs,) if kwargs else args
+            start = time.monotonic_ns()
+            try:
+                result = attr(*args, **kwargs)
+            except Exception as e:
+                elapsed = time.monotonic_ns() - start
+                error = {"error": str(e)}
+                self._log.log(self._call_format, start, elapsed, name, arguments, error)
+                raise
+            elapsed = time.monotonic_ns() - start
+            if isinstance(result, str):
+                result = repr(result)  # Strings are logged verbatim; quote them to parse back
+            self._log.log(self._call_format, start, elapsed, name, arguments, result)
+            return result
+
+        return traced
+
+
+@dataclass(frozen=True)
+class TraceCall:
+    """기록된 AXL 호출"""
+
+    start: float  # Monotonic time (s)
+    duration: float  # (s)
+    method: str
+    args: Tuple[Any, ...]
+    result: Any
+    thread: str = ""
+
+    @property
+    def end(self) -> float:
+        return self.start + self.duration
+
+
+@dataclass(frozen=True)
+class TraceMarker:
+    """기록된 단계 시작 표시"""
+
+    start: float
+    phase: str
+    thread: str = ""
+
+
+TraceEvent = Union[TraceCall, TraceMarker]
+
+
+def load_trace(paths: Union[str, Path, Iterable[Union[str, Path]]]) -> List[TraceEvent]:
+    """
+    Read AXL calls and phase markers from binary log files
+
+    Other records in the files are skipped; events are returned in start order.
+    """
+    if isinstance(paths, (str, Path)):
+        paths = [paths]
+    events: List[TraceEvent] = []
+    for path in paths:
+        for _, thread, message in decode_records(path):
+            if message.startswith("axl "):
+                _, start, duration, method, rest = message.split(" ", 4)
+                args, result = rest.rsplit(" -> ", 1)
+                parsed = _parse(args)
+                events.append(
+                    TraceCall(
+                        int(start) / 1e9,
+                        int(duration) / 1e9,
+                        method,
+                        parsed if isinstance(parsed, tuple) else (parsed,),
+                        _parse(result),
+                        thread,
+                    )
+                )
+            elif message.startswith("phase "):
+                _, start, phase = message.split(" ", 2)
+                events.append(TraceMarker(int(start) / 1e9, phase, thread))
+    events.sort(key=lambda event: event.start)
+    return events
+
+
+# ============================================================================
+# Timeline
+# ============================================================================
+
+
+@dataclass(frozen=True)
+class Segment:
+    """재시뮬레이션 타임라인 구간"""
+
+    kind: str
+    phase: str
+    duration: float  # Recorded host time (s)
+    axis_no: Optional[int] = None
+    distance: Optional[float] = None  # Move distance, None if the start position was unknown
+    command: Tuple[float, float, float] = (0.0, 0.0, 0.0)  # Move velocity, accel, decel
+    motion_time: float = 0.0  # Recorded profile time of a move (s)
+    overshoot: float = 0.0  # Wait end past the recorded profile end (s)
+
+
+@dataclass(frozen=True)
+class WhatIf:
+    """재시뮬레이션 파라미터 변경"""
+
+    velocity: Optional[float] = None  # Replaces every commanded velocity
+    accel: Optional[float] = None  # Replaces every commanded acceleration
+    decel: Optional[float] = None
+    velocity_scale: float = 1.0  # Applied after the replacement
+    accel_scale: float = 1.0  # Scales accel and decel
+    settle: Optional[float] = None  # Replaces every settle gap (s)
+    phase_settle: Mapping[str, float] = field(default_factory=dict)  # Per-phase settle (s)
+    settle_during_decel: bool = False  # Settle timer starts at the start of deceleration
+    wait_by_profile: bool = False  # Wait for the computed profile end instead of polling
+
+
+@dataclass(frozen=True)
+class CycleEstimate:
+    """단계별/전체 사이클 시간 예측"""
+
+    phases: Dict[str, float]  # Phase time in first-seen order (s)
+    kinds: Dict[str, float]  # Time per segment kind (s)
+    total: float
+
+    def format_against(self, baseline: "CycleEstimate") -> str:
+        """Phase table of this estimate against a baseline"""
+        lines = [f"{'phase':<24}{'recorded [s]':>14}{'predicted [s]':>15}{'delta [s]':>12}"]
+        for phase, recorded in baseline.phases.items():
+            predicted = self.phases.get(phase, 0.0)
+            lines.append(
+                f"{phase:<24}{recorded:>14.3f}{predicted:>15.3f}{predicted - recorded:>+12.3f}"
+            )
+        lines.append(
+            f"{'total':<24}{baseline.total:>14.3f}{self.total:>15.3f}"
+            f"{self.total - baseline.total:>+12.3f}"
+        )
+        return "\n".join(lines)
+
+
+class CycleTimeline:
+    """기록된 사이클의 순차 타임라인 (what-if 재시뮬레이션)"""
+
+    def __init__(self, segments: List[Segment], profiles: Mapping[int, AxisProfile]):
+        """
+        초기화
+
+        Args:
+            segments: Timeline segments in host order
+            profiles: Profile settings per axis (missing axes are unlimited)
+        """
+        self.segments = segments
+        self._profiles = dict(profiles)
+
+    def recorded(self) -> CycleEstimate:
+        """Cycle times as recorded"""
+        return self._estimate((segment, segment.duration) for segment in self.segments)
+
+    def simulate(self, what_if: WhatIf = WhatIf()) -> CycleEstimate:
+        """Replay the timeline with modified commands and settle rules"""
+        t = 0.0
+        axis_done: Dict[int, float] = {}
+        axis_decel: Dict[int, float] = {}
+        durations: List[Tuple[Segment, float]] = []
+        for segment in self.segments:
+            start = t
+            if segment.kind == SEGMENT_MOVE:
+                t += segment.duration
+                motion, decel = self._motion(segment, what_if)
+                axis_done[segment.axis_no] = t + motion
+                axis_decel[segment.axis_no] = decel
+            elif segment.kind == SEGMENT_WAIT:
+                done = axis_done.get(segment.axis_no, t)
+                if not what_if.wait_by_profile:
+                    done += segment.overshoot
+                t = max(t, done)
+            elif segment.kind == SEGMENT_SETTLE:
+                settle = what_if.phase_settle.get(segment.phase, what_if.settle)
+                settle = segment.duration if settle is None else settle
+                if what_if.settle_during_decel:
+                    settle = max(0.0, settle - axis_decel.get(segment.axis_no, 0.0))
+                t += settle
+            else:
+                t += segment.duration
+            durations.append((segment, t - start))
+        return self._estimate(durations)
+
+    def _motion(self, segment: Segment, what_if: WhatIf) -> Tuple[float, float]:
+        """(profile time, deceleration time) of a move under the what-if commands"""
+        velocity, accel, decel = segment.command
+        if segment.distance is None:
+            return segment.motion_time, 0.0
+        velocity = (what_if.velocity or velocity) * what_if.velocity_scale
+        accel = (what_if.accel or accel) * what_if.accel_scale
+        decel = (what_if.decel or decel) * what_if.accel_scale
+        profile = self._profiles.get(segment.axis_no, AxisProfile())
+        phases = profile.limits(velocity, accel, decel).phase_times(segment.distance)
+        return sum(phases), phases[2]
+
+    @staticmethod
+    def _estimate(durations: Iterable[Tuple[Segment, float]]) -> CycleEstimate:
+        phases: Dict[str, float] = {}
+        kinds: Dict[str, float] = {}
+        for segment, duration in durations:
+            phases[segment.phase] = phases.get(segment.phase, 0.0) + duration
+            kinds[segment.kind] = kinds.get(segment.kind, 0.0) + duration
+        return CycleEstimate(phases, kinds, sum(phases.values()))
+
+
+@dataclass
+class _Move:
+    """Move in flight while its wait is being collected"""
+
+    index: int  # Position of the move segment in the timeline
+    end: float  # Recorded end of the move call
+    motion_time: float
+    wait_start: Optional[float] = None  # Start of the first in-motion poll
+    wait_phase: str = TRACE_DEFAULT_PHASE
+    absorbed: List[Segment] = field(default_factory=list)  # Segments since the first poll
+
+
+def build_timeline(
+    events: Iterable[TraceEvent],
+    profiles: Optional[Mapping[int, AxisProfile]] = None,
+    start_positions: Optional[Mapping[int, float]] = None,
+    thread: Optional[str] = None,
+) -> CycleTimeline:
+    """
+    Rebuild the sequential timeline of a recorded cycle
+
+    Args:
+        events: Trace events in start order (see load_trace)
+        profiles: Axis profile settings (see read_axis_profile); missing axes are unlimited
+        start_positions: Command positions at trace start for axes the trace does not read
+        thread: Host thread to analyze (default: every event)
+
+    Returns:
+        The timeline, ready for recorded() and simulate()
+    """
+    profiles = dict(profiles or {})
+    positions: Dict[int, float] = dict(start_positions or {})
+    modes: Dict[int, int] = {}
+    moves: Dict[int, _Move] = {}
+    segments: List[Segment] = []
+    phase = TRACE_DEFAULT_PHASE
+    cursor: Optional[float] = None
+    settle_axis: Optional[int] = None
+    waited_until: Optional[float] = None  # End of the last wait segment
+
+    def emit(segment: Segment) -> None:
+        # Segments after the first poll of a move belong to its wait until it completes
+        for move in moves.values():
+            if move.wait_start is not None:
+                move.absorbed.append(segment)
+                return
+        segments.append(segment)
+
+    for event in events:
+        if thread is not None and event.thread != thread:
+            continue
+        if cursor is not None and event.start > cursor:
+            kind = SEGMENT_DWELL if settle_axis is None else SEGMENT_SETTLE
+            emit(Segment(kind, phase, event.start - cursor, settle_axis))
+        settle_axis = None
+        if isinstance(event, TraceMarker):
+            phase = event.phase
+            cursor = event.start if cursor is None else max(cursor, event.start)
+            continue
+        cursor = event.end
+        args = event.args
+        axis_no = args[0] if args and isinstance(args[0], int) else None
+
+        if event.method == "move_start_pos" and len(args) >= 5:
+            target, velocity, accel, decel = args[1:5]
+            start = positions.get(axis_no)
+            if modes.get(axis_no, POS_ABS) == POS_REL:
+                distance = target
+                if start is not None:
+                    positions[axis_no] = start + target
+            else:
+                distance = None if start is None else target - start
+                positions[axis_no] = target
+            profile = profiles.get(axis_no, AxisProfile())
+            motion = 0.0
+            if distance is not None:
+                motion = profile.limits(velocity, accel, decel).move_time(distance)
+            # Moves go straight into the timeline, even while another axis is waited for
+            moves[axis_no] = _Move(len(segments), event.end, motion)
+            segments.append(
+                Segment(
+                    SEGMENT_MOVE,
+                    phase,
+                    event.duration,
+                    axis_no,
+                    distance,
+                    (velocity, accel, decel),
+                    motion,
+                )
+            )
+            continue
+
+        move = moves.get(axis_no)
+        if event.method == "read_in_motion" and move is not None:
+            if move.wait_start is None:
+                move.wait_start = event.start
+                move.wait_phase = phase
+            if event.result is not False:
+                move.absorbed.append(Segment(SEGMENT_CALL, phase, event.duration, axis_no))
+                continue
+            # Axis stopped: its wait replaces every segment since the first poll of any
+            # axis still waited for, except the time already covered by an earlier wait
+            del moves[axis_no]
+            moved = segments[move.index]
+            if moved.distance is None:
+                # Unknown distance: the recorded wait is the motion time
+                segments[move.index] = replace(moved, motion_time=event.end - move.end)
+            overshoot = event.end - (move.end + segments[move.index].motion_time)
+            wait_from = min(
+                [move.wait_start]
+                + [other.wait_start for other in moves.values() if other.wait_start is not None]
+            )
+            if waited_until is not None:
+                wait_from = max(wait_from, waited_until)
+            for other in moves.values():
+                other.absorbed.clear()
+            # Never absorbed by another waiting move: every axis keeps its own wait
+            segments.append(
+                Segment(
+                    SEGMENT_WAIT,
+                    move.wait_phase,
+                    event.end - wait_from,
+                    axis_no,
+                    overshoot=overshoot,
+                )
+            )
+            waited_until = event.end
+            settle_axis = axis_no
+            continue
+
+        if event.method in _POSITION_READS and isinstance(event.result, (int, float)):
+            if axis_no is not None and move is None:
+                positions[axis_no] = float(event.result)
+        elif event.method == "set_abs_rel_mode" and len(args) >= 2:
+            modes[axis_no] = args[1]
+        emit(Segment(SEGMENT_CALL, phase, event.duration, axis_no))
+
+    # Moves never seen to stop keep their collected segments as recorded
+    for move in moves.values():
+        segments.extend(move.absorbed)
+    return CycleTimeline(segments, profiles)
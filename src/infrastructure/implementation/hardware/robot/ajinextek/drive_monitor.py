@@ -0,0 +1,323 @@
+"""
+AJINEXTEK Drive Parameter Monitor
+
+Buffered drive telemetry through the controller-side monitor buffer.
+Up to four drive parameters per axis are selected with AxmStatusSetMon; the
+controller samples them on its own cycle and a background drain thread pulls
+everything buffered since the last tick with one AxmStatusReadMonEx call per
+axis. Samples land in per-axis rings with reconstructed timestamps, so dense
+telemetry costs one driver call per axis per drain period instead of one per
+sample.
+
+Buffer layout assumption: AxmStatusReadMonEx returns the DWORD count in
+lpDataCnt and the data as consecutive records of MON_MAX_PARAMS DWORDs, one
+per configured slot. Values are signed 32-bit drive units.
+"""
+
+# Standard library imports
+from ctypes import wintypes
+from dataclasses import dataclass, field
+import threading
+import time
+from typing import Any, Dict, List, Optional, Sequence
+
+# Third-party imports
+from loguru import logger
+import numpy as np
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLError, AXLFunctionNotAvailableError
+from infrastructure.implementation.hardware.common.binary_log import BinaryLog
+from infrastructure.implementation.hardware.common.sample_ring import TimestampedRing
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    MON_DEFAULT_DRAIN_PERIOD,
+    MON_MAX_PARAMS,
+    MON_PARA_NAMES,
+    MON_READ_BUFFER_WORDS,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.error_codes import (
+    AXT_RT_SUCCESS,
+    get_error_message,
+)
+
+
+@dataclass
+class _AxisMonitor:
+    """Per-axis monitor state"""
+
+    params: List[int]
+    ring: TimestampedRing
+    last_drain: Optional[float] = None
+    samples: int = 0
+    drains: int = 0
+    errors: int = 0
+    carry: List[int] = field(default_factory=list)  # Partial record from the previous drain
+
+
+class DriveMonitorDrain:
+    """드라이브 파라미터 모니터 버퍼 배출(drain) 서비스"""
+
+    def __init__(
+        self,
+        axl: Optional[Any] = None,
+        drain_period: float = MON_DEFAULT_DRAIN_PERIOD,
+        sample_period: Optional[float] = None,
+        ring_capacity: int = 50000,
+        trace: Optional[BinaryLog] = None,
+    ):
+        """
+        초기화
+
+        Args:
+            axl: AXLWrapper instance (defaults to the process-wide singleton)
+            drain_period: Drain timer period in seconds
+            sample_period: Controller monitor sampling period in seconds. When set,
+                timestamps are placed backwards from the drain time at this spacing;
+                otherwise samples are spread evenly since the previous drain.
+            ring_capacity: Samples kept per axis
+            trace: Binary log receiving one record per drain (None = no tracing)
+        """
+        if axl is None:
+            # Local application imports
+            from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import (
+                AXLWrapper,
+            )
+
+            axl = AXLWrapper.get_instance()
+
+        self._axl = axl
+        self._drain_period = drain_period
+        self._sample_period = sample_period
+        self._ring_capacity = ring_capacity
+
+        self._trace = trace
+        if trace is not None:
+            self._trace_drain = trace.define("axis {} drained {} samples ({} carried words)")
+            self._trace_error = trace.define("axis {} drain failed: {}")
+
+        self._axes: Dict[int, _AxisMonitor] = {}
+        self._lock = threading.Lock()
+
+        # Reused drain buffer (no allocation in the drain loop)
+        self._buffer = (wintypes.DWORD * MON_READ_BUFFER_WORDS)()
+        self._buffer_view = np.frombuffer(self._buffer, dtype=np.uint32)
+
+        self._use_bulk = True  # Fall back to AxmStatusReadMon when ReadMonEx is missing
+        self._stop_event = threading.Event()
+        self._thread: Optional[threading.Thread] = None
+
+    # ========================================================================
+    # Configuration
+    # ========================================================================
+
+    def configure_axis(self, axis: int, params: Sequence[int]) -> None:
+        """
+        Select monitored drive parameters for an axis and enable buffering
+
+        Args:
+            axis: Axis number
+            params: 1 to 4 MON_PARA_* parameter numbers
+
+        Raises:
+            ValueError: If the parameter selection is invalid
+            AXLError: If the controller rejects the selection
+        """
+        params = list(params)
+        if not 1 <= len(params) <= MON_MAX_PARAMS:
+            raise ValueError(f"Between 1 and {MON_MAX_PARAMS} monitor parameters are required")
+        unknown = [p for p in params if p not in MON_PARA_NAMES]
+        if unknown:
+            raise ValueError(f"Unknown monitor parameters: {unknown}")
+
+        result = self._axl.status_set_mon(axis, params, True)
+        if result != AXT_RT_SUCCESS:
+            raise AXLError(get_error_message(result), result, "AxmStatusSetMon")
+
+        with self._lock:
+            self._axes[axis] = _AxisMonitor(
+                params=params, ring=TimestampedRing(self._ring_capacity, len(params))
+            )
+        logger.info(
+            f"Drive monitor configured for axis {axis}: "
+            f"{[MON_PARA_NAMES[p] for p in params]}"
+        )
+
+    def remove_axis(self, axis: int) -> None:
+        """Disable monitoring for an axis and drop its ring"""
+        with self._lock:
+            monitor = self._axes.pop(axis, None)
+        if monitor is None:
+            return
+        try:
+            self._axl.status_set_mon(axis, monitor.params, False)
+        except Exception as e:
+            logger.warning(f"Failed to disable drive monitor for axis {axis}: {e}")
+
+    # ========================================================================
+    # Drain Thread
+    # ========================================================================
+
+    def start(self) -> None:
+        """Start the background drain thread"""
+        if self._thread is not None and self._thread.is_alive():
+            return
+        self._stop_event.clear()
+        self._thread = threading.Thread(target=self._run, name="AXL-DriveMonitor", daemon=True)
+        self._thread.start()
+        logger.info(f"Drive monitor drain started (period: {self._drain_period}s)")
+
+    def stop(self) -> None:
+        """Stop the background drain thread (rings are kept)"""
+        self._stop_event.set()
+        if self._thread is not None:
+            self._thread.join(timeout=2.0)
+            self._thread = None
+        logger.info("Drive monitor drain stopped")
+
+    @property
+    def is_running(self) -> bool:
+        return self._thread is not None and self._thread.is_alive()
+
+    def _run(self) -> None:
+        next_tick = time.monotonic()
+        while not self._stop_event.is_set():
+            self.drain_once()
+            next_tick += self._drain_period
+            delay = next_tick - time.monotonic()
+            if delay < 0:
+                # Overrun - resynchronize instead of bursting
+                next_tick = time.monotonic()
+                delay = 0
+            self._stop_event.wait(delay)
+
+    def drain_once(self) -> int:
+        """
+        Drain buffered samples of every configured axis once
+
+        Returns:
+            Number of samples collected across all axes
+        """
+        with self._lock:
+            axes = list(self._axes.items())
+
+        collected = 0
+        for axis, monitor in axes:
+            try:
+                collected += self._drain_axis(axis, monitor)
+            except Exception as e:
+                monitor.errors += 1
+                if self._trace is not None:
+                    self._trace.log(self._trace_error, axis, str(e))
+                if monitor.errors == 1 or monitor.errors % 100 == 0:
+                    logger.warning(f"Drive monitor drain failed for axis {axis}: {e}")
+        return collected
+
+    def _drain_axis(self, axis: int, monitor: _AxisMonitor) -> int:
+        now = time.monotonic()
+        width = len(monitor.params)
+
+        if self._use_bulk:
+            try:
+                words = self._axl.status_read_mon_ex(axis, self._buffer)
+            except AXLFunctionNotAvailableError:
+                logger.info("AxmStatusReadMonEx not available - falling back to AxmStatusReadMon")
+                self._use_bulk = False
+                return self._drain_axis(axis, monitor)
+
+            words = max(0, min(words, MON_READ_BUFFER_WORDS))
+            raw = self._buffer_view[:words]
+            if monitor.carry:
+                raw = np.concatenate([np.asarray(monitor.carry, dtype=np.uint32), raw])
+            n = len(raw) // MON_MAX_PARAMS
+            monitor.carry = raw[n * MON_MAX_PARAMS :].tolist()
+            records = raw[: n * MON_MAX_PARAMS].reshape(n, MON_MAX_PARAMS)[:, :width]
+        else:
+            values, valid = self._axl.status_read_mon(axis)
+            if not valid:
+                monitor.last_drain = now
+                return 0
+            n = 1
+            records = np.asarray(values, dtype=np.uint32).reshape(1, MON_MAX_PARAMS)[:, :width]
+
+        monitor.drains += 1
+        if n == 0:
+            monitor.last_drain = now
+            return 0
+
+        values = records.astype(np.uint32).view(np.int32).astype(np.float64)
+        monitor.ring.extend(self._reconstruct_timestamps(monitor.last_drain, now, n), values)
+        monitor.last_drain = now
+        monitor.samples += n
+        if self._trace is not None:
+            self._trace.log(self._trace_drain, axis, n, len(monitor.carry))
+        return n
+
+    def _reconstruct_timestamps(self, last: Optional[float], now: float, n: int) -> np.ndarray:
+        """Place n samples that arrived between the previous drain and now"""
+        if self._sample_period is not None:
+            return now - self._sample_period * np.arange(n - 1, -1, -1, dtype=np.float64)
+        if last is None:
+            last = now - self._drain_period
+        return last + (now - last) * np.arange(1, n + 1, dtype=np.float64) / n
+
+    # ========================================================================
+    # Data Access
+    # ========================================================================
+
+    def get_ring(self, axis: int) -> TimestampedRing:
+        """Raw sample ring of an axis (columns follow the configured parameters)"""
+        return self._get_monitor(axis).ring
+
+    def latest(self, axis: int) -> Dict[str, float]:
+        """Newest sample of an axis as {parameter name: value}"""
+        monitor = self._get_monitor(axis)
+        row = monitor.ring.latest()
+        if row is None:
+            return {}
+        _, values = row
+        return {MON_PARA_NAMES[p]: float(v) for p, v in zip(monitor.params, values)}
+
+    def window_stats(self, axis: int, duration: float) -> Dict[str, Dict[str, float]]:
+        """
+        Windowed statistics of an axis over the last duration seconds
+
+        Returns:
+            {parameter name: {count, mean, min, max, std, rms}}
+        """
+        monitor = self._get_monitor(axis)
+        stats = monitor.ring.window_stats(duration)
+        if stats["count"] == 0:
+            return {}
+        return {
+            MON_PARA_NAMES[p]: {
+                "count": stats["count"],
+                "mean": float(stats["mean"][i]),
+                "min": float(stats["min"][i]),
+                "max": float(stats["max"][i]),
+                "std": float(stats["std"][i]),
+                "rms": float(stats["rms"][i]),
+            }
+            for i, p in enumerate(monitor.params)
+        }
+
+    def get_statistics(self) -> Dict[int, Dict[str, Any]]:
+        """Per-axis drain counters (samples per call shows the bulk gain)"""
+        with self._lock:
+            return {
+                axis: {
+                    "params": [MON_PARA_NAMES[p] for p in m.params],
+                    "samples": m.samples,
+                    "drains": m.drains,
+                    "errors": m.errors,
+                    "samples_per_call": m.samples / m.drains if m.drains else 0.0,
+                    "buffered": len(m.ring),
+                }
+                for axis, m in self._axes.items()
+            }
+
+    def _get_monitor(self, axis: int) -> _AxisMonitor:
+        with self._lock:
+            monitor = self._axes.get(axis)
+        if monitor is None:
+            raise ValueError(f"Axis {axis} has no drive monitor configured")
+        return monitor
@@ -0,0 +1,112 @@
+"""
+Simulated DUT Plant
+
+Force-displacement model of a device under test for the simulated AXL
+library. The probe travels freely up to the contact position; beyond it the
+DUT pushes back with a nonlinear spring
+
+    F = k(T) * (d + c * d^3),   k(T) = k0 * (1 + alpha * (T - T_ref))
+
+where d is the deflection past contact. Unloading follows a lower branch
+that meets the loading curve at the deepest deflection reached and zero at
+contact, so a press-and-release cycle shows hysteresis. The loadcell reading
+adds seeded Gaussian noise; the servo load ratio sees the noiseless force.
+
+Attach a plant to a simulated axis with SimulatedAXL.attach_dut(). The
+deepest deflection is tracked whenever the force is evaluated (status and
+loadcell reads), as a real DUT is only observed through those reads too.
+"""
+
+# Standard library imports
+from dataclasses import dataclass
+import random
+import threading
+from typing import Optional
+
+
+@dataclass(frozen=True)
+class DUTModel:
+    """DUT 접촉/스프링 모델 파라미터"""
+
+    contact_position: float  # Axis position at which the probe touches the DUT (unit)
+    stiffness: float  # Linear spring rate at the reference temperature (N/unit)
+    cubic_stiffness: float = 0.0  # Relative cubic term c (1/unit^2), > 0 stiffens
+    reference_temperature: float = 25.0  # (°C)
+    stiffness_temp_coeff: float = 0.0  # Relative stiffness change per °C (e.g. -0.002)
+    hysteresis: float = 0.0  # Relative force loss on the unloading branch (0..1)
+    noise: float = 0.0  # Loadcell noise standard deviation (N)
+    direction: int = 1  # +1: pressing towards positive positions, -1: negative
+
+    def __post_init__(self) -> None:
+        if self.stiffness <= 0:
+            raise ValueError("DUT stiffness must be positive")
+        if not 0.0 <= self.hysteresis < 1.0:
+            raise ValueError("DUT hysteresis must be in [0, 1)")
+        if self.direction not in (1, -1):
+            raise ValueError("DUT direction must be +1 or -1")
+
+    def deflection(self, position: float) -> float:
+        """Deflection past the contact point (0 in free travel)"""
+        return max(0.0, (position - self.contact_position) * self.direction)
+
+    def spring_rate(self, temperature: float) -> float:
+        """Linear stiffness at a temperature (N/unit)"""
+        scale = 1.0 + self.stiffness_temp_coeff * (temperature - self.reference_temperature)
+        return self.stiffness * max(scale, 0.0)
+
+    def loading_force(self, deflection: float, temperature: float) -> float:
+        """Force on the loading branch (N)"""
+        return self.spring_rate(temperature) * (
+            deflection + self.cubic_stiffness * deflection**3
+        )
+
+
+class DUTPlant:
+    """시뮬레이션 DUT 상태 (히스테리시스, 온도, 노이즈)"""
+
+    def __init__(self, model: DUTModel, temperature: Optional[float] = None, seed: int = 0):
+        """
+        초기화
+
+        Args:
+            model: DUT parameters
+            temperature: DUT temperature (defaults to the model's reference temperature)
+            seed: Seed of the loadcell noise generator
+        """
+        self.model = model
+        self.temperature = (
+            model.reference_temperature if temperature is None else temperature
+        )
+        self._max_deflection = 0.0
+        self._rng = random.Random(seed)
+        self._lock = threading.Lock()
+
+    def force(self, position: float) -> float:
+        """Noiseless reaction force of the DUT at an axis position (N, >= 0)"""
+        model = self.model
+        deflection = model.deflection(position)
+        with self._lock:
+            if deflection <= 0.0:
+                self._max_deflection = 0.0
+                return 0.0
+            loading = model.loading_force(deflection, self.temperature)
+            if deflection >= self._max_deflection:
+                self._max_deflection = deflection
+                return loading
+            # Unloading branch: meets the loading curve at the turning point and zero at contact
+            return loading * (
+                1.0 - model.hysteresis * (1.0 - deflection / self._max_deflection)
+            )
+
+    def loadcell(self, position: float) -> float:
+        """Force as a loadcell would read it, with noise (N)"""
+        force = self.force(position)
+        if self.model.noise > 0.0:
+            with self._lock:
+                force += self._rng.gauss(0.0, self.model.noise)
+        return force
+
+    def reset(self) -> None:
+        """Forget the loading history (fresh DUT)"""
+        with self._lock:
+            self._max_deflection = 0.0
@@ -36,11 +36,21 @@ AXT_RT_MOTION_NOT_MODULE = 4051  # 시스템에 장착된 모션 모듈이 없
 AXT_RT_MOTION_NOT_INTERRUPT = 4052  # 인터럽트 결과 읽기 실패
 AXT_RT_MOTION_INVALID_AXIS_NO = 4101  # 해당 축이 존재하지 않음
 AXT_RT_MOTION_INVALID_METHOD = 4102  # 해당 축 구동에 필요한 설정이 잘못됨
+AXT_RT_MOTION_INVALID_FILE_LOAD = 4111  # 모션 설정값이 저장된 파일이 로드가 안됨
+AXT_RT_MOTION_INVALID_FILE_SAVE = 4112  # 모션 설정값을 저장하는 파일 저장에 실패함
 AXT_RT_MOTION_INVALID_VELOCITY = 4113  # 모션 구동 속도값이 0으로 설정되어 모션 에러 발생
 AXT_RT_MOTION_ERROR_IN_MOTION = 4152  # 모션 구동 중에 다른 모션 구동 함수를 실행함
 AXT_RT_MOTION_ERROR_IN_NONMOTION = 4151  # 모션 구동중이어야 되는데 모션 구동중이 아닐 때
 AXT_RT_MOTION_HOME_SEARCHING = 4201  # 홈을 찾고 있는 중일 때 다른 모션 함수들을 사용할 때
 AXT_RT_PROTECTED_DURING_SERVOON = 4260  # 서보 온 되어 있는 상태에서 사용 못 함
+AXT_RT_MOTION_ERROR_IN_ALARM = 4516  # 지정된 축이 알람 상태임
+
+# AIO Module Errors (2000-2199)
+AXT_RT_AIO_OPEN_ERROR = 2001  # AIO 모듈 오픈실패
+AXT_RT_AIO_NOT_MODULE = 2051  # AIO 모듈 없음
+AXT_RT_AIO_INVALID_MODULE_NO = 2101  # 유효하지않은 AIO모듈
+AXT_RT_AIO_INVALID_CHANNEL_NO = 2102  # 유효하지않은 AIO채널번호
+AXT_RT_AIO_INVALID_VALUE = 2109  # 유효하지않는 값 설정
 
 # DIO Module Errors (3000-3199)
 AXT_RT_DIO_OPEN_ERROR = 3001  # DIO 모듈 오픈실패
@@ -49,6 +59,10 @@ AXT_RT_DIO_INVALID_MODULE_NO = 3101  # 유효하지않는 DIO 모듈 번호
 AXT_RT_DIO_INVALID_OFFSET_NO = 3102  # 유효하지않는 DIO OFFSET 번호
 AXT_RT_DIO_INVALID_VALUE = 3105  # 유효하지않는 값 설정
 
+# Data Flash Errors (5000-5099)
+AXT_RT_DATA_FLASH_NOT_EXIST = 5000  # 플래시 메모리가 존재하지 않음
+AXT_RT_DATA_FLASH_BUSY = 5001  # 플래시 메모리가 사용 중
+
 # ============================================================================
 # Error Code Mapping Dictionary
 # ============================================================================
@@ -72,16 +86,26 @@ ERROR_MESSAGES = {
     AXT_RT_INVALID_MODULE_NO: "Invalid module number",
     AXT_RT_INVALID_NO: "Invalid number",
     # DIO Errors
+    AXT_RT_AIO_OPEN_ERROR: "AIO module open failed",
+    AXT_RT_AIO_NOT_MODULE: "AIO module not found",
+    AXT_RT_AIO_INVALID_MODULE_NO: "Invalid AIO module number",
+    AXT_RT_AIO_INVALID_CHANNEL_NO: "Invalid AIO channel number",
+    AXT_RT_AIO_INVALID_VALUE: "Invalid AIO value setting",
     AXT_RT_DIO_OPEN_ERROR: "DIO module open failed",
     AXT_RT_DIO_NOT_MODULE: "DIO module not found",
     AXT_RT_DIO_INVALID_MODULE_NO: "Invalid DIO module number",
     AXT_RT_DIO_INVALID_OFFSET_NO: "Invalid DIO offset number",
     AXT_RT_DIO_INVALID_VALUE: "Invalid value setting",
+    # Data Flash Errors
+    AXT_RT_DATA_FLASH_NOT_EXIST: "Board has no data flash",
+    AXT_RT_DATA_FLASH_BUSY: "Data flash is busy writing",
     # Motion Errors
     AXT_RT_MOTION_OPEN_ERROR: "Motion library open failed",
     AXT_RT_MOTION_NOT_MODULE: "No motion module installed in system",
     AXT_RT_MOTION_INVALID_AXIS_NO: "Axis does not exist",
     AXT_RT_MOTION_INVALID_METHOD: "Invalid axis drive configuration",
+    AXT_RT_MOTION_INVALID_FILE_LOAD: "Motion parameter file could not be loaded",
+    AXT_RT_MOTION_INVALID_FILE_SAVE: "Motion parameter file could not be saved",
     AXT_RT_MOTION_INVALID_VELOCITY: "Motion velocity set to 0, causing motion error",
     AXT_RT_MOTION_ERROR_IN_MOTION: "Cannot execute motion function while axis is already in motion",
     AXT_RT_MOTION_ERROR_IN_NONMOTION: "Axis should be in motion but is not moving",
@@ -89,6 +113,7 @@ ERROR_MESSAGES = {
         "Cannot use other motion functions while home search is in progress"
     ),
     AXT_RT_PROTECTED_DURING_SERVOON: "Cannot use this function while servo is ON",
+    AXT_RT_MOTION_ERROR_IN_ALARM: "Axis is in alarm state",
 }
 
 
@@ -155,3 +180,16 @@ def is_dio_error(error_code: int) -> bool:
         bool: True if DIO error, False otherwise
     """
     return 3000 <= error_code < 3200
+
+
+def is_aio_error(error_code: int) -> bool:
+    """
+    Check if error code is AIO related
+
+    Args:
+        error_code: AXL library error code
+
+    Returns:
+        bool: True if AIO error, False otherwise
+    """
+    return 2000 <= error_code < 2200
@@ -0,0 +1,373 @@
+"""
+AJINEXTEK Board Data Flash Key-Value Store
+
+Persistent station-local state (calibration hashes, homing offsets,
+odometers, parameter fingerprints) kept in the data flash of a motion board
+(AxlSetDataFlash / AxlGetDataFlash: 200 pages of 120 bytes, up to 17 ms per
+page write). A warm start mounts the store with one read per page and has
+every key available without touching files or re-measuring.
+
+The flash is used as a ring of append-only pages. A write appends a record to
+the head page (rewriting that page, as the library only writes from the page
+start); when the head is full the next page in the ring becomes the head.
+Every page is therefore written in turn, so wear spreads evenly over the ring
+no matter which keys change. When fewer than reserve_pages free pages
+remain, the oldest page is compacted: its still-current records are appended
+to the head and the page joins the free pages, which also moves rarely
+changing keys around the ring instead of pinning their pages. Live data is
+capped at half the ring, so compaction always frees more than it copies.
+
+Page layout (little-endian):
+    header  "<2sBxII"   magic, version, sequence, tail sequence
+            "<H"        CRC-16 of the header
+    record  "<BBBH"     kind, key length, value length, CRC-16 of kind..value
+            key (UTF-8), value
+    a record kind other than put/delete (0x00 padding, 0xFF erased) ends the page
+
+Mount picks the page with the highest sequence number as the head; its tail
+sequence bounds the live window, so reclaimed pages still holding old data
+are ignored. Records failing their CRC end the scan of their page. As each
+append rewrites the whole head page, a torn write can lose the records of
+that one page; all older pages stay intact.
+"""
+
+# Standard library imports
+import binascii
+from dataclasses import dataclass
+import json
+import struct
+import threading
+import time
+from typing import Any, Dict, Iterator, List, Optional, Tuple
+
+# Third-party imports
+from loguru import logger
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLConfigurationError, AXLError
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    DATA_FLASH_BUSY_RETRIES,
+    DATA_FLASH_PAGE_COUNT,
+    DATA_FLASH_PAGE_SIZE,
+    DATA_FLASH_RESERVE_PAGES,
+    DATA_FLASH_WRITE_TIME,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.error_codes import (
+    AXT_RT_DATA_FLASH_BUSY,
+)
+
+STORE_MAGIC = b"KV"
+STORE_VERSION = 1
+
+RECORD_PUT = 0x01
+RECORD_DELETE = 0x02
+
+_HEADER = struct.Struct("<2sBxII")
+_CRC = struct.Struct("<H")
+_RECORD = struct.Struct("<BBBH")
+PAGE_PAYLOAD = DATA_FLASH_PAGE_SIZE - _HEADER.size - _CRC.size
+MAX_RECORD_DATA = PAGE_PAYLOAD - _RECORD.size  # Key plus value bytes of one record
+
+
+def _crc16(data: bytes) -> int:
+    return binascii.crc_hqx(data, 0xFFFF)
+
+
+def _encode_record(kind: int, key: bytes, value: bytes) -> bytes:
+    head = bytes((kind, len(key), len(value)))
+    return _RECORD.pack(kind, len(key), len(value), _crc16(head + key + value)) + key + value
+
+
+def _decode_records(payload: bytes) -> Iterator[Tuple[int, bytes, bytes]]:
+    """(kind, key, value) of the valid records at the start of a page payload"""
+    offset = 0
+    while offset + _RECORD.size <= len(payload):
+        kind, key_len, value_len, crc = _RECORD.unpack_from(payload, offset)
+        if kind not in (RECORD_PUT, RECORD_DELETE):
+            return
+        start = offset + _RECORD.size
+        end = start + key_len + value_len
+        if end > len(payload):
+            return
+        if _crc16(bytes((kind, key_len, value_len)) + payload[start:end]) != crc:
+            return
+        yield kind, payload[start : start + key_len], payload[start + key_len : end]
+        offset = end
+
+
+@dataclass
+class _Page:
+    index: int  # Physical page address
+    seq: int
+    records: List[bytes]  # Encoded records in append order
+    used: int = 0  # Payload bytes in use
+
+
+class BoardFlashStore:
+    """보드 데이터 플래시 기반 키-값 저장소 (append-only 페이지 링)"""
+
+    def __init__(
+        self,
+        axl: Optional[Any] = None,
+        board_no: int = 0,
+        first_page: int = 0,
+        page_count: int = DATA_FLASH_PAGE_COUNT,
+        reserve_pages: int = DATA_FLASH_RESERVE_PAGES,
+        write_interval: float = DATA_FLASH_WRITE_TIME,
+    ):
+        """
+        초기화
+
+        Args:
+            axl: AXLWrapper instance (defaults to the process-wide singleton)
+            board_no: Board whose data flash holds the store
+            first_page: First flash page of the store
+            page_count: Flash pages owned by the store
+            reserve_pages: Free pages kept so compaction always has room
+            write_interval: Minimum time between page writes (flash programming time)
+        """
+        if axl is None:
+            # Local application imports
+            from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import (
+                AXLWrapper,
+            )
+
+            axl = AXLWrapper.get_instance()
+        if page_count < reserve_pages + 2:
+            raise ValueError("Flash store needs at least reserve_pages + 2 pages")
+        if first_page < 0 or first_page + page_count > DATA_FLASH_PAGE_COUNT:
+            raise ValueError("Flash store pages out of range")
+
+        self._axl = axl
+        self._board_no = board_no
+        self._first_page = first_page
+        self._page_count = page_count
+        self._reserve_pages = reserve_pages
+        self._write_interval = write_interval
+
+        self._lock = threading.RLock()
+        self._mounted = False
+        self._pages: Dict[int, _Page] = {}  # seq -> live page
+        self._head: Optional[_Page] = None
+        self._tail_seq = 0
+        self._index: Dict[str, Tuple[int, bytes]] = {}  # key -> (page seq, value)
+        self._next_write = 0.0
+        self._page_writes = 0
+        self._compactions = 0
+
+    # ========================================================================
+    # Mount
+    # ========================================================================
+
+    def mount(self) -> Dict[str, bytes]:
+        """Read every page once and rebuild the index; returns the current contents"""
+        with self._lock:
+            found: Dict[int, Tuple[int, int, bytes]] = {}  # seq -> (index, tail seq, payload)
+            for index in range(self._page_count):
+                data = self._axl.get_data_flash(
+                    self._board_no, self._first_page + index, DATA_FLASH_PAGE_SIZE
+                )
+                header = self._parse_header(data)
+                if header is not None:
+                    seq, tail_seq = header
+                    found[seq] = (index, tail_seq, data[_HEADER.size + _CRC.size :])
+
+            self._pages.clear()
+            self._index.clear()
+            if not found:
+                self._head = None
+                self._tail_seq = 0
+            else:
+                head_seq = max(found)
+                self._tail_seq = min(found[head_seq][1], head_seq)
+                for seq in range(self._tail_seq, head_seq + 1):
+                    if seq not in found:
+                        logger.warning(f"Flash store page seq {seq} missing or corrupt")
+                        continue
+                    index, _, payload = found[seq]
+                    self._replay(seq, index, payload)
+                self._head = self._pages.get(head_seq)
+            self._mounted = True
+            logger.info(
+                f"Flash store on board {self._board_no}: {len(self._index)} keys in "
+                f"{len(self._pages)} pages"
+            )
+            return self.snapshot()
+
+    def _parse_header(self, data: bytes) -> Optional[Tuple[int, int]]:
+        magic, version, seq, tail_seq = _HEADER.unpack_from(data, 0)
+        if magic != STORE_MAGIC or version != STORE_VERSION:
+            return None
+        if _crc16(data[: _HEADER.size]) != _CRC.unpack_from(data, _HEADER.size)[0]:
+            return None
+        return seq, tail_seq
+
+    def _replay(self, seq: int, index: int, payload: bytes) -> None:
+        page = _Page(index=index, seq=seq, records=[])
+        for kind, key, value in _decode_records(payload):
+            record = _encode_record(kind, key, value)
+            page.records.append(record)
+            page.used += len(record)
+            name = key.decode("utf-8")
+            if kind == RECORD_PUT:
+                self._index[name] = (seq, value)
+            else:
+                self._index.pop(name, None)
+        self._pages[seq] = page
+
+    # ========================================================================
+    # Access
+    # ========================================================================
+
+    def get(self, key: str, default: Optional[bytes] = None) -> Optional[bytes]:
+        with self._lock:
+            self._require_mounted()
+            entry = self._index.get(key)
+            return default if entry is None else entry[1]
+
+    def put(self, key: str, value: bytes) -> None:
+        """Store a value; writing the current value again costs no flash write"""
+        key_bytes = key.encode("utf-8")
+        if not key_bytes or len(key_bytes) + len(value) > MAX_RECORD_DATA:
+            raise ValueError(
+                f"Flash store record {key!r} must hold 1..{MAX_RECORD_DATA} key+value bytes"
+            )
+        with self._lock:
+            self._require_mounted()
+            entry = self._index.get(key)
+            if entry is not None and entry[1] == value:
+                return
+            self._ensure_capacity(len(key_bytes) + len(value) + _RECORD.size)
+            seq = self._append(_encode_record(RECORD_PUT, key_bytes, bytes(value)))
+            self._index[key] = (seq, bytes(value))
+
+    def delete(self, key: str) -> bool:
+        """Remove a key; returns False if it was not stored"""
+        with self._lock:
+            self._require_mounted()
+            if key not in self._index:
+                return False
+            self._append(_encode_record(RECORD_DELETE, key.encode("utf-8"), b""))
+            del self._index[key]
+            return True
+
+    def get_value(self, key: str, default: Any = None) -> Any:
+        """JSON-decoded value of a key stored with put_value()"""
+        raw = self.get(key)
+        return default if raw is None else json.loads(raw.decode("utf-8"))
+
+    def put_value(self, key: str, value: Any) -> None:
+        """Store a JSON-serializable value (numbers, strings, short lists)"""
+        self.put(key, json.dumps(value, separators=(",", ":")).encode("utf-8"))
+
+    def keys(self) -> List[str]:
+        with self._lock:
+            self._require_mounted()
+            return sorted(self._index)
+
+    def snapshot(self) -> Dict[str, bytes]:
+        with self._lock:
+            self._require_mounted()
+            return {key: value for key, (_, value) in self._index.items()}
+
+    def _require_mounted(self) -> None:
+        if not self._mounted:
+            raise AXLConfigurationError("Flash store is not mounted")
+
+    # ========================================================================
+    # Pages
+    # ========================================================================
+
+    def _free_pages(self) -> int:
+        """Pages outside the live window between tail and head"""
+        live = 0 if self._head is None else self._head.seq - self._tail_seq + 1
+        return self._page_count - live
+
+    def _ensure_capacity(self, record_size: int) -> None:
+        """Refuse writes that would take live data past half of the ring"""
+        live = sum(
+            len(key.encode("utf-8")) + len(value) + _RECORD.size
+            for key, (_, value) in self._index.items()
+        )
+        usable = (self._page_count - self._reserve_pages - 1) * PAGE_PAYLOAD // 2
+        if live + record_size > usable:
+            raise AXLConfigurationError(
+                f"Flash store on board {self._board_no} is full ({live} live bytes)"
+            )
+
+    def _append(self, record: bytes, compacting: bool = False) -> int:
+        """Append an encoded record to the head page; returns the page sequence"""
+        if not self._fits(record):
+            if not compacting:
+                while self._free_pages() <= self._reserve_pages:
+                    self._compact_tail()
+            if not self._fits(record):
+                self._open_page()
+        head = self._head
+        head.records.append(record)
+        head.used += len(record)
+        self._write_page(head)
+        return head.seq
+
+    def _fits(self, record: bytes) -> bool:
+        return self._head is not None and self._head.used + len(record) <= PAGE_PAYLOAD
+
+    def _open_page(self) -> None:
+        if self._free_pages() == 0:
+            raise AXLConfigurationError(f"Flash store on board {self._board_no} has no free page")
+        if self._head is None:
+            index, seq = 0, self._tail_seq
+        else:
+            index, seq = (self._head.index + 1) % self._page_count, self._head.seq + 1
+        self._head = self._pages[seq] = _Page(index=index, seq=seq, records=[])
+
+    def _compact_tail(self) -> None:
+        """Re-append the current records of the oldest page and release it"""
+        tail = self._pages.pop(self._tail_seq, None)  # None: page lost to a torn write
+        if tail is not None:
+            for kind, key, _ in _decode_records(b"".join(tail.records)):
+                name = key.decode("utf-8")
+                entry = self._index.get(name)
+                if kind != RECORD_PUT or entry is None or entry[0] != tail.seq:
+                    continue  # Superseded, already copied, deleted, or a tombstone
+                seq = self._append(_encode_record(RECORD_PUT, key, entry[1]), compacting=True)
+                self._index[name] = (seq, entry[1])
+        # Persisted with the next head write; until then the old tail replays harmlessly
+        self._tail_seq += 1
+        self._compactions += 1
+
+    def _write_page(self, page: _Page) -> None:
+        header = _HEADER.pack(STORE_MAGIC, STORE_VERSION, page.seq, self._tail_seq)
+        header += _CRC.pack(_crc16(header))
+        data = (header + b"".join(page.records)).ljust(DATA_FLASH_PAGE_SIZE, b"\x00")
+
+        for attempt in range(DATA_FLASH_BUSY_RETRIES + 1):
+            delay = self._next_write - time.perf_counter()
+            if delay > 0:
+                time.sleep(delay)
+            try:
+                self._axl.set_data_flash(self._board_no, self._first_page + page.index, data)
+                break
+            except AXLError as e:
+                if e.error_code != AXT_RT_DATA_FLASH_BUSY or attempt == DATA_FLASH_BUSY_RETRIES:
+                    raise
+                self._next_write = time.perf_counter() + self._write_interval
+        self._next_write = time.perf_counter() + self._write_interval
+        self._page_writes += 1
+
+    # ========================================================================
+    # Status
+    # ========================================================================
+
+    def get_stats(self) -> Dict[str, Any]:
+        """Keys, page usage and write counters since this instance was created"""
+        with self._lock:
+            return {
+                "keys": len(self._index),
+                "live_pages": len(self._pages),
+                "free_pages": self._free_pages(),
+                "head_seq": None if self._head is None else self._head.seq,
+                "tail_seq": self._tail_seq,
+                "page_writes": self._page_writes,
+                "compactions": self._compactions,
+            }
@@ -0,0 +1,344 @@
+"""
+AJINEXTEK Sensorless Force Estimator
+
+Estimates the axial force on an axis from the servo reference torque, so
+pre-positioning and guard checks do not have to wait for a serial loadcell
+read. A linear model
+
+    force = gain * torque + offset + friction * direction
+
+is fitted by least squares against loadcell readings taken during a
+calibration stroke. direction is the sign of the axis velocity (0 while
+standing), so the friction term absorbs the Coulomb friction the servo
+overcomes while moving.
+
+Each estimate carries a prediction interval from the calibration residuals,
+which widens outside the calibrated torque range. The loadcell stays the
+reference for final measurements.
+
+Torque is read with AxmStatusReadServoLoadRatio (reference torque selection)
+by default; a torque_source callable can supply it instead, e.g. the latest
+load value from a DriveMonitorDrain on M3 drives.
+"""
+
+# Standard library imports
+from dataclasses import dataclass
+import math
+import threading
+import time
+from typing import Any, Callable, Dict, List, Optional, Tuple
+
+# Third-party imports
+from loguru import logger
+import numpy as np
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLConfigurationError
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    FORCE_EST_CONFIDENCE_Z,
+    FORCE_EST_MIN_SAMPLES,
+    FORCE_EST_VELOCITY_DEADBAND,
+    LOAD_RATIO_REFERENCE_TORQUE,
+)
+
+
+@dataclass(frozen=True)
+class ForceModel:
+    """Fitted torque-to-force model"""
+
+    gain: float  # N per % load ratio
+    offset: float  # N
+    friction: float  # N, applied with the sign of the velocity
+    sigma: float  # Residual standard deviation (N)
+    normal_inverse: Tuple[Tuple[float, ...], ...]  # (X^T X)^-1 of the fit
+    samples: int
+    torque_range: Tuple[float, float]
+
+    def predict(self, torque: float, direction: int) -> Tuple[float, float]:
+        """
+        Force and prediction standard deviation for a torque reading
+
+        Args:
+            torque: Load ratio (%)
+            direction: Sign of the axis velocity (-1, 0, 1)
+
+        Returns:
+            (force, standard deviation) in N
+        """
+        x = np.array([torque, 1.0, float(direction)])
+        force = self.gain * torque + self.offset + self.friction * direction
+        leverage = float(x @ np.array(self.normal_inverse) @ x)
+        return force, self.sigma * math.sqrt(1.0 + max(leverage, 0.0))
+
+    def to_dict(self) -> Dict[str, Any]:
+        """Plain-data form for persisting a calibration"""
+        return {
+            "gain": self.gain,
+            "offset": self.offset,
+            "friction": self.friction,
+            "sigma": self.sigma,
+            "normal_inverse": [list(row) for row in self.normal_inverse],
+            "samples": self.samples,
+            "torque_range": list(self.torque_range),
+        }
+
+    @classmethod
+    def from_dict(cls, data: Dict[str, Any]) -> "ForceModel":
+        """Rebuild a model saved with to_dict()"""
+        return cls(
+            gain=float(data["gain"]),
+            offset=float(data["offset"]),
+            friction=float(data["friction"]),
+            sigma=float(data["sigma"]),
+            normal_inverse=tuple(tuple(float(v) for v in row) for row in data["normal_inverse"]),
+            samples=int(data["samples"]),
+            torque_range=(float(data["torque_range"][0]), float(data["torque_range"][1])),
+        )
+
+
+@dataclass(frozen=True)
+class ForceEstimate:
+    """Force estimate with confidence bounds"""
+
+    force: float  # N
+    lower: float  # N
+    upper: float  # N
+    torque: float  # Load ratio (%)
+    velocity: float  # unit/s
+    timestamp: float  # time.monotonic()
+    extrapolated: bool  # Torque outside the calibrated range
+
+
+@dataclass
+class _CalibrationSample:
+    torque: float
+    direction: int
+    force: float
+
+
+class SensorlessForceEstimator:
+    """서보 토크 기반 센서리스 힘 추정기"""
+
+    def __init__(
+        self,
+        axl: Optional[Any] = None,
+        axis_no: int = 0,
+        torque_source: Optional[Callable[[], float]] = None,
+        confidence_z: float = FORCE_EST_CONFIDENCE_Z,
+        velocity_deadband: float = FORCE_EST_VELOCITY_DEADBAND,
+    ):
+        """
+        초기화
+
+        Args:
+            axl: AXLWrapper instance (defaults to the process-wide singleton)
+            axis_no: Axis carrying the load
+            torque_source: Torque reader (None = AxmStatusReadServoLoadRatio)
+            confidence_z: Bound half-width in prediction standard deviations
+            velocity_deadband: |velocity| below this counts as standing (unit/s)
+        """
+        if axl is None:
+            # Local application imports
+            from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import (
+                AXLWrapper,
+            )
+
+            axl = AXLWrapper.get_instance()
+
+        self._axl = axl
+        self._axis_no = axis_no
+        self._torque_source = torque_source
+        self._confidence_z = confidence_z
+        self._velocity_deadband = velocity_deadband
+
+        self._lock = threading.Lock()
+        self._samples: List[_CalibrationSample] = []
+        self._model: Optional[ForceModel] = None
+        self._load_ratio_selected = False
+        self._estimates = 0
+
+    # ========================================================================
+    # Readings
+    # ========================================================================
+
+    def read_torque(self) -> float:
+        """Current servo torque as load ratio (%)"""
+        if self._torque_source is not None:
+            return float(self._torque_source())
+        if not self._load_ratio_selected:
+            self._axl.status_set_read_servo_load_ratio(
+                self._axis_no, LOAD_RATIO_REFERENCE_TORQUE
+            )
+            self._load_ratio_selected = True
+        return float(self._axl.status_read_servo_load_ratio(self._axis_no))
+
+    def _direction(self, velocity: float) -> int:
+        if abs(velocity) < self._velocity_deadband:
+            return 0
+        return 1 if velocity > 0 else -1
+
+    # ========================================================================
+    # Calibration
+    # ========================================================================
+
+    def add_calibration_sample(
+        self,
+        force: float,
+        torque: Optional[float] = None,
+        velocity: Optional[float] = None,
+    ) -> None:
+        """
+        Record a loadcell reading against the torque at the same moment
+
+        Args:
+            force: Loadcell force (N)
+            torque: Load ratio (%) (None = read now)
+            velocity: Axis velocity (None = read now)
+        """
+        if torque is None:
+            torque = self.read_torque()
+        if velocity is None:
+            velocity = self._axl.status_read_vel(self._axis_no)
+        with self._lock:
+            self._samples.append(
+                _CalibrationSample(float(torque), self._direction(velocity), float(force))
+            )
+
+    def clear_calibration(self) -> None:
+        """Drop recorded samples (the current model is kept)"""
+        with self._lock:
+            self._samples.clear()
+
+    @property
+    def calibration_samples(self) -> int:
+        with self._lock:
+            return len(self._samples)
+
+    def fit(self) -> ForceModel:
+        """
+        Fit the model to the recorded samples and make it current
+
+        The friction term is only fitted when samples were taken while moving
+        in both directions; otherwise it cannot be told apart from the offset
+        and is fixed at zero.
+
+        Raises:
+            ValueError: If there are too few samples or no torque variation
+        """
+        with self._lock:
+            samples = list(self._samples)
+
+        if len(samples) < FORCE_EST_MIN_SAMPLES:
+            raise ValueError(
+                f"Force calibration needs at least {FORCE_EST_MIN_SAMPLES} samples "
+                f"({len(samples)} recorded)"
+            )
+
+        torque = np.array([s.torque for s in samples])
+        direction = np.array([s.direction for s in samples], dtype=float)
+        force = np.array([s.force for s in samples])
+        if np.ptp(torque) == 0.0:
+            raise ValueError("Force calibration needs samples at different torques")
+
+        use_friction = (direction > 0).any() and (direction < 0).any()
+        columns = [torque, np.ones_like(torque)] + ([direction] if use_friction else [])
+        x = np.column_stack(columns)
+        coef, _, _, _ = np.linalg.lstsq(x, force, rcond=None)
+
+        dof = max(len(samples) - x.shape[1], 1)
+        residual = force - x @ coef
+        sigma = math.sqrt(float(residual @ residual) / dof)
+
+        normal_inverse = np.zeros((3, 3))
+        size = x.shape[1]
+        normal_inverse[:size, :size] = np.linalg.pinv(x.T @ x)
+
+        model = ForceModel(
+            gain=float(coef[0]),
+            offset=float(coef[1]),
+            friction=float(coef[2]) if use_friction else 0.0,
+            sigma=sigma,
+            normal_inverse=tuple(tuple(float(v) for v in row) for row in normal_inverse),
+            samples=len(samples),
+            torque_range=(float(torque.min()), float(torque.max())),
+        )
+        with self._lock:
+            self._model = model
+        logger.info(
+            f"Axis {self._axis_no} force model fitted from {len(samples)} samples: "
+            f"{model.gain:.3f} N/% * torque + {model.offset:.2f} N "
+            f"+ {model.friction:.2f} N * dir (sigma {sigma:.2f} N)"
+        )
+        return model
+
+    @property
+    def model(self) -> Optional[ForceModel]:
+        with self._lock:
+            return self._model
+
+    def load_model(self, model: ForceModel) -> None:
+        """Use a previously fitted model (e.g. restored with ForceModel.from_dict())"""
+        with self._lock:
+            self._model = model
+
+    # ========================================================================
+    # Estimation
+    # ========================================================================
+
+    def estimate(
+        self, torque: Optional[float] = None, velocity: Optional[float] = None
+    ) -> ForceEstimate:
+        """
+        Estimate the current force
+
+        Args:
+            torque: Load ratio (%) (None = read now)
+            velocity: Axis velocity (None = read now)
+
+        Raises:
+            AXLConfigurationError: If no model has been fitted or loaded
+        """
+        model = self.model
+        if model is None:
+            raise AXLConfigurationError(
+                f"Force estimator for axis {self._axis_no} is not calibrated"
+            )
+        if torque is None:
+            torque = self.read_torque()
+        if velocity is None:
+            velocity = self._axl.status_read_vel(self._axis_no)
+
+        force, std = model.predict(torque, self._direction(velocity))
+        half_width = self._confidence_z * std
+        with self._lock:
+            self._estimates += 1
+        return ForceEstimate(
+            force=force,
+            lower=force - half_width,
+            upper=force + half_width,
+            torque=float(torque),
+            velocity=float(velocity),
+            timestamp=time.monotonic(),
+            extrapolated=not model.torque_range[0] <= torque <= model.torque_range[1],
+        )
+
+    def may_exceed(self, limit: float, estimate: Optional[ForceEstimate] = None) -> bool:
+        """
+        Guard check: whether the force magnitude may be beyond limit
+
+        Uses the far confidence bound, so an uncertain estimate trips early.
+        """
+        if estimate is None:
+            estimate = self.estimate()
+        return max(abs(estimate.lower), abs(estimate.upper)) > limit
+
+    def get_status(self) -> Dict[str, Any]:
+        """Calibration state and estimate count"""
+        with self._lock:
+            return {
+                "axis_no": self._axis_no,
+                "calibrated": self._model is not None,
+                "calibration_samples": len(self._samples),
+                "estimates": self._estimates,
+                "model": self._model.to_dict() if self._model is not None else None,
+            }
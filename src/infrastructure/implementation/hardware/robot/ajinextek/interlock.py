@@ -0,0 +1,642 @@
+"""
+AJINEXTEK Interlock Engine
+
+Declarative safety and sequencing interlocks evaluated on every process
+image scan cycle. Rules are boolean expressions over DIO points, axis
+universal inputs, axis in-motion flags and analog thresholds, with edge
+detection and on-delay timers:
+
+    door_open = di(0, 3)
+    engine.add_rule(InterlockRule("door", door_open & in_motion(0), estop(0)))
+
+All rules are compiled into one flat postfix program of (opcode, a, b)
+instructions and run by a small stack machine from the scanner's cycle
+hook, so a rule reacts within one scan period of the IO change no matter
+which services are running. Reactions go straight to the library:
+AxmMoveMultiEStop / AxmMoveMultiSStop for axes and AxdoWriteOutportDword for
+outputs, which are then forced through the scanner until the rule clears.
+
+While a stop rule is active the stop is re-issued whenever one of its axes
+is seen in motion, which blocks new moves as well, and on every cycle after
+the library rejected it. Latched rules stay active until reset() is called
+on the active rule with the condition cleared.
+
+Without an image the rules cannot be evaluated, so after
+INTERLOCK_MAX_MISSED_SCANS failed scans in a row the engine fails safe: the
+stop actions of all rules are issued (and retried each failed cycle until
+accepted). Evaluation resumes with the next published image.
+"""
+
+# Standard library imports
+from dataclasses import dataclass
+import threading
+import time
+from typing import Any, Dict, List, Mapping, Optional, Set, Tuple
+
+# Third-party imports
+from loguru import logger
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLConfigurationError
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    INTERLOCK_MAX_MISSED_SCANS,
+    INTERLOCK_SCAN_PERIOD,
+    SCAN_DWORD_BITS,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.error_codes import (
+    AXT_RT_SUCCESS,
+    get_error_message,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.process_image import (
+    ProcessImage,
+    ProcessImageScanner,
+)
+
+# Opcodes of the compiled program
+OP_DI = 1  # push DIO input bit (a=module, b=offset)
+OP_DO = 2  # push DIO output bit (a=module, b=offset)
+OP_AXIS_IN = 3  # push axis universal input bit (a=axis, b=bit)
+OP_IN_MOTION = 4  # push axis in-motion flag (a=axis)
+OP_AI_ABOVE = 5  # push analog > constant (a=channel, b=constant index)
+OP_AI_BELOW = 6  # push analog < constant (a=channel, b=constant index)
+OP_NOT = 7
+OP_AND = 8
+OP_OR = 9
+OP_RISING = 10  # pop x, push x and not previous x (a=edge slot)
+OP_FALLING = 11  # pop x, push previous x and not x (a=edge slot)
+OP_ON_DELAY = 12  # pop x, push x held for constant seconds (a=timer slot, b=constant index)
+OP_RULE = 13  # pop the result of rule a
+
+ACTION_ESTOP = "estop"
+ACTION_SSTOP = "sstop"
+ACTION_OUTPUTS = "outputs"
+
+_LEAF_OPS = (OP_DI, OP_DO, OP_AXIS_IN, OP_IN_MOTION, OP_AI_ABOVE, OP_AI_BELOW)
+
+
+# ============================================================================
+# Rule Definition
+# ============================================================================
+
+
+@dataclass(frozen=True)
+class Condition:
+    """Interlock expression node (build with di(), in_motion(), &, |, ~ ...)"""
+
+    op: int
+    a: int = 0
+    b: int = 0
+    value: float = 0.0  # Threshold (V) or delay (s)
+    children: Tuple["Condition", ...] = ()
+
+    def __and__(self, other: "Condition") -> "Condition":
+        return Condition(OP_AND, children=(self, other))
+
+    def __or__(self, other: "Condition") -> "Condition":
+        return Condition(OP_OR, children=(self, other))
+
+    def __invert__(self) -> "Condition":
+        return Condition(OP_NOT, children=(self,))
+
+
+def di(module_no: int, offset: int) -> Condition:
+    """DIO input point is on"""
+    return Condition(OP_DI, module_no, offset)
+
+
+def do(module_no: int, offset: int) -> Condition:
+    """DIO output point is on"""
+    return Condition(OP_DO, module_no, offset)
+
+
+def axis_input(axis_no: int, bit: int) -> Condition:
+    """Universal input bit of an axis is on"""
+    return Condition(OP_AXIS_IN, axis_no, bit)
+
+
+def in_motion(axis_no: int) -> Condition:
+    """Axis is moving"""
+    return Condition(OP_IN_MOTION, axis_no)
+
+
+def ai_above(channel_no: int, volts: float) -> Condition:
+    """Analog input is above a threshold"""
+    return Condition(OP_AI_ABOVE, channel_no, value=volts)
+
+
+def ai_below(channel_no: int, volts: float) -> Condition:
+    """Analog input is below a threshold"""
+    return Condition(OP_AI_BELOW, channel_no, value=volts)
+
+
+def rising(condition: Condition) -> Condition:
+    """True for the one cycle in which the condition becomes true"""
+    return Condition(OP_RISING, children=(condition,))
+
+
+def falling(condition: Condition) -> Condition:
+    """True for the one cycle in which the condition becomes false"""
+    return Condition(OP_FALLING, children=(condition,))
+
+
+def on_delay(condition: Condition, seconds: float) -> Condition:
+    """True once the condition has been true for the given time"""
+    return Condition(OP_ON_DELAY, value=seconds, children=(condition,))
+
+
+@dataclass(frozen=True)
+class InterlockAction:
+    """Reaction of a tripped rule"""
+
+    kind: str
+    axes: Tuple[int, ...] = ()
+    module_no: int = 0
+    outputs: Tuple[Tuple[int, bool], ...] = ()  # (offset, level) held while active
+
+
+def estop(*axes: int) -> InterlockAction:
+    """Emergency stop axes without deceleration (AxmMoveMultiEStop)"""
+    return InterlockAction(ACTION_ESTOP, axes=tuple(axes))
+
+
+def sstop(*axes: int) -> InterlockAction:
+    """Stop axes with their configured deceleration (AxmMoveMultiSStop)"""
+    return InterlockAction(ACTION_SSTOP, axes=tuple(axes))
+
+
+def set_outputs(module_no: int, values: Mapping[int, bool]) -> InterlockAction:
+    """Drive DIO outputs to fixed levels (AxdoWriteOutportDword)"""
+    return InterlockAction(ACTION_OUTPUTS, module_no=module_no, outputs=tuple(values.items()))
+
+
+@dataclass(frozen=True)
+class InterlockRule:
+    """Named condition and the action taken while it holds"""
+
+    name: str
+    when: Condition
+    action: InterlockAction
+    latch: bool = False
+
+
+@dataclass
+class _RuleState:
+    active: bool = False
+    trips: int = 0
+    last_trip: Optional[float] = None
+    reset_requested: bool = False
+    retry: bool = False  # Last action failed; re-issued on the next cycle
+
+
+@dataclass(frozen=True)
+class _Program:
+    """Compiled rules: flat instruction list plus constant and slot tables"""
+
+    code: Tuple[Tuple[int, int, int], ...] = ()
+    constants: Tuple[float, ...] = ()
+    rules: Tuple[InterlockRule, ...] = ()
+    edge_slots: int = 0
+    timer_slots: int = 0
+    rule_slots: Tuple[Tuple[int, int, int, int], ...] = ()  # (edge from, to, timer from, to)
+
+
+def compile_rules(rules: List[InterlockRule]) -> _Program:
+    """Compile rules into one postfix program"""
+    code: List[Tuple[int, int, int]] = []
+    constants: List[float] = []
+    slots = {"edge": 0, "timer": 0}
+    rule_slots: List[Tuple[int, int, int, int]] = []
+
+    def emit(node: Condition) -> None:
+        for child in node.children:
+            emit(child)
+        if node.op in (OP_AI_ABOVE, OP_AI_BELOW):
+            constants.append(node.value)
+            code.append((node.op, node.a, len(constants) - 1))
+        elif node.op in _LEAF_OPS:
+            code.append((node.op, node.a, node.b))
+        elif node.op in (OP_RISING, OP_FALLING):
+            code.append((node.op, slots["edge"], 0))
+            slots["edge"] += 1
+        elif node.op == OP_ON_DELAY:
+            constants.append(node.value)
+            code.append((node.op, slots["timer"], len(constants) - 1))
+            slots["timer"] += 1
+        elif node.op in (OP_NOT, OP_AND, OP_OR):
+            code.append((node.op, 0, 0))
+        else:
+            raise AXLConfigurationError(f"Unknown interlock opcode {node.op}")
+
+    for index, rule in enumerate(rules):
+        edge_from, timer_from = slots["edge"], slots["timer"]
+        emit(rule.when)
+        code.append((OP_RULE, index, 0))
+        rule_slots.append((edge_from, slots["edge"], timer_from, slots["timer"]))
+
+    return _Program(
+        code=tuple(code),
+        constants=tuple(constants),
+        rules=tuple(rules),
+        edge_slots=slots["edge"],
+        timer_slots=slots["timer"],
+        rule_slots=tuple(rule_slots),
+    )
+
+
+# ============================================================================
+# Engine
+# ============================================================================
+
+
+class InterlockEngine:
+    """스캔 주기마다 평가되는 인터락 규칙 엔진"""
+
+    def __init__(
+        self,
+        scanner: Optional[ProcessImageScanner] = None,
+        axl: Optional[Any] = None,
+        max_missed_scans: int = INTERLOCK_MAX_MISSED_SCANS,
+    ):
+        """
+        초기화
+
+        Args:
+            scanner: Process image scanner providing the IO (defaults to a new
+                scanner over axl running at INTERLOCK_SCAN_PERIOD)
+            axl: AXLWrapper instance (defaults to the process-wide singleton)
+            max_missed_scans: Failed scans in a row before all stop actions are issued
+        """
+        if axl is None:
+            # Local application imports
+            from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import (
+                AXLWrapper,
+            )
+
+            axl = AXLWrapper.get_instance()
+        if scanner is None:
+            scanner = ProcessImageScanner(axl, scan_period=INTERLOCK_SCAN_PERIOD)
+
+        self._axl = axl
+        self._scanner = scanner
+
+        self._rules: List[InterlockRule] = []
+        self._program = _Program()
+        self._states: Dict[str, _RuleState] = {}
+        self._edges: List[bool] = []
+        self._timers: List[Optional[float]] = []
+        self._lock = threading.Lock()
+
+        self._max_missed_scans = max_missed_scans
+        self._missed_scans = 0
+        self._fail_safe_stopped: Set[str] = set()  # Rules stopped during the current outage
+        self._fail_safe_trips = 0
+
+        self._evaluations = 0
+        self._action_errors = 0
+        self._last_eval_time = 0.0
+        self._attached = False
+
+    @property
+    def scanner(self) -> ProcessImageScanner:
+        return self._scanner
+
+    # ========================================================================
+    # Rules
+    # ========================================================================
+
+    def add_rule(self, rule: InterlockRule) -> None:
+        """
+        Add a rule and recompile the program
+
+        Raises:
+            AXLConfigurationError: If the name is taken or the rule reads IO
+                the scanner does not scan
+        """
+        self._validate(rule)
+        with self._lock:
+            if any(existing.name == rule.name for existing in self._rules):
+                raise AXLConfigurationError(f"Interlock rule '{rule.name}' already exists")
+            self._rules.append(rule)
+            self._states[rule.name] = _RuleState()
+            self._recompile()
+        logger.info(f"Interlock rule '{rule.name}' added ({len(self._program.code)} instructions)")
+
+    def remove_rule(self, name: str) -> None:
+        """Remove a rule; outputs it forced are released"""
+        with self._lock:
+            rule = next((r for r in self._rules if r.name == name), None)
+            if rule is None:
+                return
+            self._rules.remove(rule)
+            state = self._states.pop(name)
+            self._recompile()
+        if state.active:
+            self._release(rule)
+
+    def reset(self, name: str) -> None:
+        """
+        Acknowledge an active latched rule; it clears once its condition is false
+
+        Ignored while the rule is inactive, so a reset cannot be armed ahead of a trip.
+        """
+        with self._lock:
+            state = self._states.get(name)
+            if state is not None and state.active:
+                state.reset_requested = True
+
+    def _recompile(self) -> None:
+        """Recompile; rules that stay keep their edge and on-delay timer state"""
+        old = self._program
+        previous = {
+            rule.name: (self._edges[e0:e1], self._timers[t0:t1])
+            for rule, (e0, e1, t0, t1) in zip(old.rules, old.rule_slots)
+        }
+        program = compile_rules(self._rules)
+        edges: List[bool] = [False] * program.edge_slots
+        timers: List[Optional[float]] = [None] * program.timer_slots
+        for rule, (e0, e1, t0, t1) in zip(program.rules, program.rule_slots):
+            if rule.name in previous:
+                edges[e0:e1], timers[t0:t1] = previous[rule.name]
+        self._program, self._edges, self._timers = program, edges, timers
+
+    def _validate(self, rule: InterlockRule) -> None:
+        layout = self._scanner.get_layout()
+        modules, axes = layout["modules"], layout["axes"]
+
+        def check(node: Condition) -> None:
+            if node.op in (OP_DI, OP_DO):
+                points = modules.get(node.a, (0, 0))[0 if node.op == OP_DI else 1]
+                if node.b >= points:
+                    raise AXLConfigurationError(
+                        f"Interlock '{rule.name}': DIO {node.a}:{node.b} is not scanned"
+                    )
+            elif node.op in (OP_AXIS_IN, OP_IN_MOTION) and node.a not in axes:
+                raise AXLConfigurationError(
+                    f"Interlock '{rule.name}': axis {node.a} is not scanned"
+                )
+            elif node.op in (OP_AI_ABOVE, OP_AI_BELOW) and node.a not in layout["analog_inputs"]:
+                raise AXLConfigurationError(
+                    f"Interlock '{rule.name}': analog input {node.a} is not scanned"
+                )
+            for child in node.children:
+                check(child)
+
+        check(rule.when)
+        if rule.action.kind == ACTION_OUTPUTS:
+            outputs = modules.get(rule.action.module_no, (0, 0))[1]
+            if any(offset >= outputs for offset, _ in rule.action.outputs):
+                raise AXLConfigurationError(
+                    f"Interlock '{rule.name}': output of module {rule.action.module_no} "
+                    "is not scanned"
+                )
+
+    # ========================================================================
+    # Evaluation
+    # ========================================================================
+
+    def attach(self) -> None:
+        """Evaluate the rules after every scan cycle (and fail safe on missed ones)"""
+        self._scanner.add_cycle_hook(self.evaluate)
+        self._scanner.add_failure_hook(self.on_scan_failed)
+        self._attached = True
+
+    def detach(self) -> None:
+        self._scanner.remove_cycle_hook(self.evaluate)
+        self._scanner.remove_failure_hook(self.on_scan_failed)
+        self._attached = False
+
+    def start(self) -> None:
+        """Attach and start the scanner"""
+        self.attach()
+        self._scanner.start()
+
+    def stop(self) -> None:
+        """Stop the scanner and detach"""
+        self._scanner.stop()
+        self.detach()
+
+    def evaluate(self, image: ProcessImage) -> List[str]:
+        """
+        Run the program against one image and act on state changes
+
+        Returns:
+            Names of the active rules
+        """
+        started = time.perf_counter()
+        if self._missed_scans:
+            if self._missed_scans >= self._max_missed_scans:
+                logger.info(f"Interlock scan restored after {self._missed_scans} missed cycles")
+            self._missed_scans = 0
+            self._fail_safe_stopped.clear()
+        with self._lock:
+            program, edges, timers = self._program, self._edges, self._timers
+            results = self._execute(program, edges, timers, image)
+            transitions = self._update_states(program.rules, results, image.timestamp)
+            active = [rule.name for rule in program.rules if self._states[rule.name].active]
+
+        for rule, state, tripped in transitions:
+            if tripped:
+                logger.warning(f"Interlock '{rule.name}' tripped ({rule.action.kind})")
+                self._act(rule, state, image)
+            elif state.active:
+                self._hold(rule, state, image)
+            else:
+                logger.info(f"Interlock '{rule.name}' cleared")
+                self._release(rule)
+
+        self._evaluations += 1
+        self._last_eval_time = time.perf_counter() - started
+        return active
+
+    @staticmethod
+    def _execute(
+        program: _Program,
+        edges: List[bool],
+        timers: List[Optional[float]],
+        image: ProcessImage,
+    ) -> List[bool]:
+        stack: List[bool] = []
+        push, pop = stack.append, stack.pop
+        constants = program.constants
+        now = image.timestamp
+        results = [False] * len(program.rules)
+
+        for op, a, b in program.code:
+            if op == OP_DI:
+                push(image.input_bit(a, b))
+            elif op == OP_DO:
+                push(image.output_bit(a, b))
+            elif op == OP_AXIS_IN:
+                push(bool(image.axis_inputs[a] >> b & 1))
+            elif op == OP_IN_MOTION:
+                push(image.axis_motion[a])
+            elif op == OP_AI_ABOVE:
+                push(image.analog_inputs[a] > constants[b])
+            elif op == OP_AI_BELOW:
+                push(image.analog_inputs[a] < constants[b])
+            elif op == OP_NOT:
+                push(not pop())
+            elif op == OP_AND:
+                right = pop()
+                push(pop() and right)
+            elif op == OP_OR:
+                right = pop()
+                push(pop() or right)
+            elif op == OP_RISING:
+                value = pop()
+                push(value and not edges[a])
+                edges[a] = value
+            elif op == OP_FALLING:
+                value = pop()
+                push(edges[a] and not value)
+                edges[a] = value
+            elif op == OP_ON_DELAY:
+                if not pop():
+                    timers[a] = None
+                    push(False)
+                else:
+                    if timers[a] is None:
+                        timers[a] = now
+                    push(now - timers[a] >= constants[b])  # type: ignore[operator]
+            elif op == OP_RULE:
+                results[a] = pop()
+        return results
+
+    def _update_states(
+        self,
+        rules: Tuple[InterlockRule, ...],
+        results: List[bool],
+        now: float,
+    ) -> List[Tuple[InterlockRule, _RuleState, bool]]:
+        """Advance rule states; returns (rule, state, tripped) for rules needing action"""
+        transitions = []
+        for index, rule in enumerate(rules):
+            state = self._states[rule.name]
+            condition = results[index]
+            if rule.latch and state.active and not state.reset_requested:
+                condition = True  # Held until reset() with the condition cleared
+
+            if condition and not state.active:
+                state.active = True
+                state.trips += 1
+                state.last_trip = now
+                state.reset_requested = False  # A reset only acknowledges a present trip
+                transitions.append((rule, state, True))
+            elif condition:
+                transitions.append((rule, state, False))
+            elif state.active:
+                state.active = False
+                state.reset_requested = False
+                transitions.append((rule, state, False))
+        return transitions
+
+    # ========================================================================
+    # Actions
+    # ========================================================================
+
+    def on_scan_failed(self, error: Exception) -> None:
+        """Scanner failure hook: fail safe once too many cycles in a row had no image"""
+        self._missed_scans += 1
+        if self._missed_scans < self._max_missed_scans:
+            return
+        with self._lock:
+            rules = [rule for rule in self._rules if rule.action.kind != ACTION_OUTPUTS]
+        pending = [rule for rule in rules if rule.name not in self._fail_safe_stopped]
+        if not pending:
+            return
+        if not self._fail_safe_stopped:
+            self._fail_safe_trips += 1
+            logger.error(
+                f"Interlock: {self._missed_scans} scan cycles missed ({error}), "
+                f"stopping the axes of {len(pending)} rules"
+            )
+        for rule in pending:
+            try:
+                stopped = self._stop(rule)
+            except Exception as e:
+                self._action_errors += 1
+                logger.error(f"Interlock '{rule.name}' fail-safe stop failed: {e}")
+                stopped = False
+            if stopped:
+                self._fail_safe_stopped.add(rule.name)
+
+    def _act(self, rule: InterlockRule, state: _RuleState, image: ProcessImage) -> None:
+        action = rule.action
+        try:
+            if action.kind in (ACTION_ESTOP, ACTION_SSTOP):
+                state.retry = not self._stop(rule)
+            elif action.kind == ACTION_OUTPUTS:
+                self._write_outputs(action, image)
+                self._scanner.force_outputs(action.module_no, dict(action.outputs))
+                state.retry = False
+        except Exception as e:
+            self._action_errors += 1
+            state.retry = True
+            logger.error(f"Interlock '{rule.name}' action failed: {e}")
+
+    def _stop(self, rule: InterlockRule) -> bool:
+        """Issue a stop action; False (counted and logged) if the library rejects it"""
+        action = rule.action
+        if action.kind == ACTION_ESTOP:
+            result = self._axl.move_multi_emergency_stop(list(action.axes))
+        else:
+            result = self._axl.move_multi_smooth_stop(list(action.axes))
+        if result != AXT_RT_SUCCESS:
+            self._action_errors += 1
+            logger.error(
+                f"Interlock '{rule.name}' {action.kind} rejected: "
+                f"{get_error_message(result)} ({result})"
+            )
+            return False
+        return True
+
+    def _hold(self, rule: InterlockRule, state: _RuleState, image: ProcessImage) -> None:
+        """Keep an active rule effective: retry a failed action, re-stop moving axes"""
+        action = rule.action
+        if state.retry:
+            self._act(rule, state, image)
+        elif action.kind in (ACTION_ESTOP, ACTION_SSTOP):
+            if any(image.axis_motion.get(axis_no, False) for axis_no in action.axes):
+                self._act(rule, state, image)
+
+    def _release(self, rule: InterlockRule) -> None:
+        action = rule.action
+        if action.kind == ACTION_OUTPUTS:
+            self._scanner.release_outputs(action.module_no, [o for o, _ in action.outputs])
+
+    def _write_outputs(self, action: InterlockAction, image: ProcessImage) -> None:
+        """Write the affected output dwords now instead of waiting for the next flush"""
+        current = image.dio_outputs[action.module_no]
+        changes: Dict[int, Tuple[int, int]] = {}
+        for offset, level in action.outputs:
+            dword, bit = divmod(offset, SCAN_DWORD_BITS)
+            mask, bits = changes.get(dword, (0, 0))
+            changes[dword] = (mask | 1 << bit, bits | (1 << bit if level else 0))
+        for dword, (mask, bits) in changes.items():
+            value = (int(current[dword]) & ~mask) | bits
+            if value != int(current[dword]):
+                self._axl.write_output_dword(action.module_no, dword, value)
+
+    # ========================================================================
+    # Status
+    # ========================================================================
+
+    def get_status(self) -> Dict[str, Dict[str, Any]]:
+        """Per-rule active flag, trip count and last trip time (image timestamp)"""
+        with self._lock:
+            return {
+                name: {"active": s.active, "trips": s.trips, "last_trip": s.last_trip}
+                for name, s in self._states.items()
+            }
+
+    def get_stats(self) -> Dict[str, Any]:
+        return {
+            "rules": len(self._rules),
+            "instructions": len(self._program.code),
+            "evaluations": self._evaluations,
+            "action_errors": self._action_errors,
+            "missed_scans": self._missed_scans,
+            "fail_safe_trips": self._fail_safe_trips,
+            "last_eval_us": self._last_eval_time * 1e6,
+            "attached": self._attached,
+        }
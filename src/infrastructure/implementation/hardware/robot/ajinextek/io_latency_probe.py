@@ -0,0 +1,307 @@
+"""
+AJINEXTEK Loopback IO Latency Probe
+
+Measures output-to-input latency through the AXL stack on a loopback cable:
+one output bit - a DIO output (AxdoWriteOutportBit) or an axis universal
+output (AxmSignalWriteOutputBit) - is wired back to one input bit. The probe
+toggles the output and times how long the new level takes to show up at the
+input, either by polling the input or by waiting for the DIO module
+interrupt (AxdiInterruptSetModule, both edges enabled on the input bit).
+
+Each mode yields a LatencyHistogram (log-spaced bins, percentiles, timeouts)
+from which debounce times, edge timeouts and the polling period can be
+chosen. Interrupts exist for DIO inputs only; an axis universal input can be
+probed by polling. scripts/benchmark_io_latency.py runs both modes and
+prints the histograms.
+"""
+
+# Standard library imports
+import math
+import threading
+import time
+from typing import Any, Dict, List, NamedTuple, Optional, Sequence, Tuple
+
+# Third-party imports
+from loguru import logger
+
+# Local application imports
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    IO_PROBE_POLL_INTERVAL,
+    IO_PROBE_SETTLE,
+    IO_PROBE_TIMEOUT,
+    IO_PROBE_TIMEOUT_MARGIN,
+    SCAN_DWORD_BITS,
+)
+
+IO_DIO = "dio"  # DIO module bit: IOPoint(IO_DIO, module_no, offset)
+IO_AXIS = "axis"  # Axis universal IO bit: IOPoint(IO_AXIS, axis_no, bit_no)
+
+_BINS_PER_DECADE = 4
+_HISTOGRAM_FLOOR = 1e-6  # Lower edge of the first bin (s)
+_HISTOGRAM_WIDTH = 40  # Characters of the longest histogram bar
+
+
+class IOPoint(NamedTuple):
+    """루프백 입출력 비트 (kind, index, bit)"""
+
+    kind: str
+    index: int
+    bit: int
+
+    @classmethod
+    def parse(cls, text: str) -> "IOPoint":
+        """Parse "dio:<module>:<offset>" or "axis:<axis>:<bit>" """
+        try:
+            kind, index, bit = text.split(":")
+            point = cls(kind.lower(), int(index), int(bit))
+        except ValueError as e:
+            raise ValueError(f"Invalid IO point '{text}' (expected kind:index:bit)") from e
+        if point.kind not in (IO_DIO, IO_AXIS):
+            raise ValueError(f"Invalid IO point kind '{kind}' (expected {IO_DIO} or {IO_AXIS})")
+        return point
+
+    def __str__(self) -> str:
+        return f"{self.kind}:{self.index}:{self.bit}"
+
+
+class LatencyHistogram:
+    """엣지 지연 시간 분포 (로그 간격 빈)"""
+
+    def __init__(self, mode: str, latencies: Sequence[float], timeouts: int = 0):
+        """
+        초기화
+
+        Args:
+            mode: Measurement mode ("polling" or "interrupt")
+            latencies: Measured edge latencies in seconds
+            timeouts: Edges that did not arrive within the probe timeout
+        """
+        self.mode = mode
+        self.latencies = sorted(latencies)
+        self.timeouts = timeouts
+
+    @property
+    def count(self) -> int:
+        return len(self.latencies)
+
+    def percentile(self, p: float) -> float:
+        """Latency at percentile p (0..100, nearest rank); NaN without samples"""
+        if not self.latencies:
+            return math.nan
+        rank = max(1, math.ceil(p / 100.0 * self.count))
+        return self.latencies[min(rank, self.count) - 1]
+
+    def bins(self) -> List[Tuple[float, float, int]]:
+        """(lower edge, upper edge, count) of every bin from the first to the last used"""
+        counts: Dict[int, int] = {}
+        for latency in self.latencies:
+            decades = math.log10(max(latency, _HISTOGRAM_FLOOR) / _HISTOGRAM_FLOOR)
+            index = math.floor(decades * _BINS_PER_DECADE)
+            counts[index] = counts.get(index, 0) + 1
+        if not counts:
+            return []
+        return [
+            (
+                _HISTOGRAM_FLOOR * 10 ** (index / _BINS_PER_DECADE),
+                _HISTOGRAM_FLOOR * 10 ** ((index + 1) / _BINS_PER_DECADE),
+                counts.get(index, 0),
+            )
+            for index in range(min(counts), max(counts) + 1)
+        ]
+
+    def suggested_timeout(self, margin: float = IO_PROBE_TIMEOUT_MARGIN) -> float:
+        """Edge timeout covering the worst measured latency with a safety margin"""
+        return self.latencies[-1] * margin if self.latencies else math.nan
+
+    def summary(self) -> Dict[str, Any]:
+        """Count, timeouts and min/mean/p50/p90/p99/max latency in milliseconds"""
+        mean = sum(self.latencies) / self.count if self.latencies else math.nan
+        values = {
+            "min": self.latencies[0] if self.latencies else math.nan,
+            "mean": mean,
+            "p50": self.percentile(50),
+            "p90": self.percentile(90),
+            "p99": self.percentile(99),
+            "max": self.latencies[-1] if self.latencies else math.nan,
+        }
+        summary: Dict[str, Any] = {"mode": self.mode, "count": self.count}
+        summary["timeouts"] = self.timeouts
+        summary.update({f"{key}_ms": value * 1000 for key, value in values.items()})
+        return summary
+
+    def format(self) -> str:
+        """Multi-line text report: summary line plus one bar per bin"""
+        s = self.summary()
+        lines = [
+            f"{self.mode}: {s['count']} edges, {s['timeouts']} timeouts | "
+            f"min {s['min_ms']:.3f}  p50 {s['p50_ms']:.3f}  p90 {s['p90_ms']:.3f}  "
+            f"p99 {s['p99_ms']:.3f}  max {s['max_ms']:.3f} ms"
+        ]
+        bins = self.bins()
+        peak = max((count for _, _, count in bins), default=0)
+        for lower, upper, count in bins:
+            bar = "#" * math.ceil(count * _HISTOGRAM_WIDTH / peak) if count else ""
+            lines.append(f"  {lower * 1000:9.3f} - {upper * 1000:9.3f} ms {count:6d} {bar}")
+        return "\n".join(lines)
+
+
+class LoopbackProbe:
+    """출력 -> 입력 루프백 지연 측정기 (폴링 / 인터럽트)"""
+
+    def __init__(
+        self,
+        output: IOPoint,
+        input: IOPoint,
+        axl: Optional[Any] = None,
+        timeout: float = IO_PROBE_TIMEOUT,
+        settle: float = IO_PROBE_SETTLE,
+    ):
+        """
+        초기화
+
+        Args:
+            output: Output bit driving the loopback cable
+            input: Input bit the cable is wired to
+            axl: AXLWrapper instance (defaults to the process-wide singleton)
+            timeout: Wait limit for one edge in seconds
+            settle: Pause between edges in seconds
+        """
+        if axl is None:
+            # Local application imports
+            from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import (
+                AXLWrapper,
+            )
+
+            axl = AXLWrapper.get_instance()
+
+        self._axl = axl
+        self.output = IOPoint(*output)
+        self.input = IOPoint(*input)
+        self._timeout = timeout
+        self._settle = settle
+        self._level = False
+        self._polls = 0
+
+    # ========================================================================
+    # Measurement
+    # ========================================================================
+
+    def measure_polling(
+        self, samples: int, poll_interval: float = IO_PROBE_POLL_INTERVAL
+    ) -> LatencyHistogram:
+        """
+        Time edges by polling the input
+
+        Args:
+            samples: Number of edges (rising and falling alternate)
+            poll_interval: Pause between polls in seconds (0 spins)
+        """
+        self._prepare()
+        self._polls = 0
+        latencies: List[float] = []
+        timeouts = 0
+        for _ in range(samples):
+            level = not self._level
+            start = time.perf_counter()
+            self._write(level)
+            latency = self._poll(level, start, poll_interval)
+            if latency is None:
+                timeouts += 1
+            else:
+                latencies.append(latency)
+            time.sleep(self._settle)
+        histogram = LatencyHistogram("polling", latencies, timeouts)
+        self._report(histogram)
+        return histogram
+
+    def measure_interrupt(self, samples: int) -> LatencyHistogram:
+        """
+        Time edges by the DIO module interrupt of the input bit
+
+        Raises:
+            ValueError: If the input is not a DIO input
+        """
+        if self.input.kind != IO_DIO:
+            raise ValueError(f"Interrupt timing needs a DIO input, got {self.input}")
+
+        module_no, offset = self.input.index, self.input.bit
+        flag_bit = offset % SCAN_DWORD_BITS  # The DWORD flag covers one 32-point group
+        arrived = threading.Event()
+        stamp = [0.0]
+
+        def on_interrupt(module: int, flag: int) -> None:
+            if module == module_no and flag >> flag_bit & 1:
+                stamp[0] = time.perf_counter()
+                arrived.set()
+
+        self._prepare()
+        self._axl.setup_interrupt_callback(module_no, on_interrupt)
+        # AxdiInterruptEdgeSetBit takes UP_EDGE or DOWN_EDGE only: one call per edge
+        self._axl.set_interrupt_edge(module_no, offset, "rising")
+        self._axl.set_interrupt_edge(module_no, offset, "falling")
+        self._axl.enable_module_interrupt(module_no, True)
+        latencies: List[float] = []
+        timeouts = 0
+        try:
+            for _ in range(samples):
+                arrived.clear()
+                start = time.perf_counter()
+                self._write(not self._level)
+                if arrived.wait(self._timeout):
+                    latencies.append(stamp[0] - start)
+                else:
+                    timeouts += 1
+                time.sleep(self._settle)
+        finally:
+            self._axl.enable_module_interrupt(module_no, False)
+            self._axl.set_interrupt_edge(module_no, offset, "rising", 0)
+            self._axl.set_interrupt_edge(module_no, offset, "falling", 0)
+            self._axl.setup_interrupt_callback(module_no, None)
+        histogram = LatencyHistogram("interrupt", latencies, timeouts)
+        self._report(histogram)
+        return histogram
+
+    def get_stats(self) -> Dict[str, Any]:
+        """Input reads issued by the last polling run"""
+        return {"output": str(self.output), "input": str(self.input), "polls": self._polls}
+
+    # ========================================================================
+    # IO access
+    # ========================================================================
+
+    def _prepare(self) -> None:
+        """Drive the output low and wait for the input to follow"""
+        self._write(False)
+        if self._poll(False, time.perf_counter(), 0.0) is None:
+            logger.warning(f"Loopback input {self.input} did not follow {self.output} low")
+
+    def _poll(self, level: bool, start: float, poll_interval: float) -> Optional[float]:
+        deadline = start + self._timeout
+        while True:
+            self._polls += 1
+            if self._read() == level:
+                return time.perf_counter() - start
+            if time.perf_counter() >= deadline:
+                return None
+            if poll_interval > 0:
+                time.sleep(poll_interval)
+
+    def _write(self, level: bool) -> None:
+        if self.output.kind == IO_DIO:
+            self._axl.write_output_bit(self.output.index, self.output.bit, level)
+        else:
+            self._axl.write_universal_output_bit(self.output.index, self.output.bit, level)
+        self._level = level
+
+    def _read(self) -> bool:
+        if self.input.kind == IO_DIO:
+            return self._axl.read_input_bit(self.input.index, self.input.bit)
+        return self._axl.read_universal_input_bit(self.input.index, self.input.bit)
+
+    def _report(self, histogram: LatencyHistogram) -> None:
+        s = histogram.summary()
+        logger.info(
+            f"Loopback {self.output} -> {self.input} ({s['mode']}): "
+            f"p50 {s['p50_ms']:.3f} ms, p99 {s['p99_ms']:.3f} ms, "
+            f"{s['timeouts']}/{s['count'] + s['timeouts']} timeouts"
+        )
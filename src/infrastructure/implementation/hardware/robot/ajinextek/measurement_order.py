@@ -0,0 +1,394 @@
+"""
+AJINEXTEK Measurement Travel-Order Planner
+
+Orders the temperature x position measurement matrix of a force test to
+minimize the predicted cycle time. Every temperature is one group whose
+positions are measured in one sweep; the planner chooses
+
+- the order of the temperature groups (exact dynamic programming up to
+  TRAVEL_EXACT_MAX_GROUPS groups, nearest-next beyond),
+- the direction of each sweep (as configured or reversed), and
+- whether the axis moves to the next group's first position while the
+  temperature changes (pre-positioning) instead of before/after it.
+
+Move times come from a trapezoidal profile built from the axis limits read
+from the driver: the configured velocity clamped to AxmMotGetMaxVel and, in
+S-curve profile modes, accel/decel reduced to their average over the jerk
+ramps set with AxmMotSetAccelJerk / AxmMotSetDecelJerk. Thermal transitions
+come from a ThermalModel with separate heating and cooling rates.
+
+plan_measurements(..., reorder=False, allow_reverse=False, prepositioning=False)
+predicts the fixed nested order of perform_force_test_sequence, which makes a
+convenient baseline.
+"""
+
+# Standard library imports
+from dataclasses import dataclass
+import math
+from typing import Any, Dict, List, Optional, Sequence, Tuple
+
+# Local application imports
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    ACCEL_UNIT_SEC,
+    PROFILE_S_CURVE_MODES,
+    TRAVEL_EXACT_MAX_GROUPS,
+)
+
+STEP_THERMAL = "thermal"
+STEP_MOVE = "move"
+STEP_MEASURE = "measure"
+
+
+@dataclass(frozen=True)
+class AxisLimits:
+    """Motion limits of the measurement axis"""
+
+    velocity: float  # (unit/s)
+    accel: float  # (unit/s^2)
+    decel: float  # (unit/s^2)
+    accel_jerk: float = 0.0  # Share of the acceleration phase spent ramping (%)
+    decel_jerk: float = 0.0
+
+    def move_time(self, distance: float) -> float:
+        """Rest-to-rest move time over a distance (s)"""
+        return sum(self.phase_times(distance))
+
+    def phase_times(self, distance: float) -> Tuple[float, float, float]:
+        """Acceleration, constant-velocity and deceleration time of a move (s)"""
+        d = abs(distance)
+        if d == 0.0:
+            return 0.0, 0.0, 0.0
+        # A jerk ramp over r of a phase averages the acceleration down to (1 - r/2)
+        accel = self.accel * (1.0 - self.accel_jerk / 200.0)
+        decel = self.decel * (1.0 - self.decel_jerk / 200.0)
+        vel = self.velocity
+        ramp = vel * vel / (2 * accel) + vel * vel / (2 * decel)
+        if ramp > d:
+            vel = math.sqrt(2 * d * accel * decel / (accel + decel))
+            return vel / accel, 0.0, vel / decel
+        return vel / accel, (d - ramp) / vel, vel / decel
+
+
+@dataclass(frozen=True)
+class AxisProfile:
+    """Driver profile settings that shape every move of an axis"""
+
+    max_velocity: float = math.inf  # AxmMotGetMaxVel (unit/s)
+    accel_in_seconds: bool = False  # ACCEL_UNIT_SEC: accel/decel are given as times
+    accel_jerk: float = 0.0  # S-curve jerk ramps (%), 0 in trapezoid modes
+    decel_jerk: float = 0.0
+
+    def limits(self, velocity: float, accel: float, decel: float) -> AxisLimits:
+        """Limits of a move commanded with velocity, accel and decel"""
+        velocity = min(velocity, self.max_velocity)
+        if self.accel_in_seconds:
+            accel, decel = velocity / accel, velocity / decel
+        return AxisLimits(velocity, accel, decel, self.accel_jerk, self.decel_jerk)
+
+
+def read_axis_profile(axl: Any, axis_no: int) -> AxisProfile:
+    """Read the profile settings of an axis from the driver"""
+    accel_jerk = decel_jerk = 0.0
+    if axl.get_profile_mode(axis_no) in PROFILE_S_CURVE_MODES:
+        accel_jerk = axl.get_accel_jerk(axis_no)
+        decel_jerk = axl.get_decel_jerk(axis_no)
+    return AxisProfile(
+        max_velocity=axl.get_max_vel(axis_no),
+        accel_in_seconds=axl.get_accel_unit(axis_no) == ACCEL_UNIT_SEC,
+        accel_jerk=accel_jerk,
+        decel_jerk=decel_jerk,
+    )
+
+
+def read_axis_limits(
+    axl: Any, axis_no: int, velocity: float, accel: float, decel: float
+) -> AxisLimits:
+    """
+    Build the axis limits from the driver settings
+
+    Args:
+        axl: AXLWrapper instance
+        axis_no: Measurement axis
+        velocity: Commanded velocity (clamped to the axis maximum)
+        accel: Commanded acceleration (unit/s^2, or s in ACCEL_UNIT_SEC mode)
+        decel: Commanded deceleration
+    """
+    return read_axis_profile(axl, axis_no).limits(velocity, accel, decel)
+
+
+@dataclass(frozen=True)
+class ThermalModel:
+    """Temperature transition cost"""
+
+    heat_rate: float  # (°C/s)
+    cool_rate: float  # (°C/s)
+    settle_time: float = 0.0  # Added to every change (s)
+
+    def transition_time(self, start: float, end: float) -> float:
+        if start == end:
+            return 0.0
+        rate = self.heat_rate if end > start else self.cool_rate
+        return abs(end - start) / rate + self.settle_time
+
+
+@dataclass(frozen=True)
+class TimelineStep:
+    """One predicted activity; thermal and move steps may overlap"""
+
+    kind: str
+    start: float
+    end: float
+    temperature: float  # Target temperature (thermal) or current temperature
+    position: float  # Target position (move) or measurement position
+
+
+@dataclass(frozen=True)
+class MeasurementPlan:
+    """Ordered measurement points and their predicted timeline"""
+
+    points: Tuple[Tuple[float, float], ...]  # (temperature, position) in measurement order
+    sweeps: Tuple[Tuple[float, bool], ...]  # (temperature, reversed) per group
+    timeline: Tuple[TimelineStep, ...]
+    total_time: float
+
+    @property
+    def temperature_order(self) -> List[float]:
+        return [temperature for temperature, _ in self.sweeps]
+
+    def time_in(self, kind: str) -> float:
+        """Summed duration of all steps of a kind (overlaps counted twice)"""
+        return sum(step.end - step.start for step in self.timeline if step.kind == kind)
+
+
+class _Planner:
+    """Shared cost model for the search and the timeline"""
+
+    def __init__(
+        self,
+        positions: Sequence[float],
+        limits: AxisLimits,
+        thermal: ThermalModel,
+        measure_time: float,
+        home_position: float,
+        standby_temperature: Optional[float],
+        prepositioning: bool,
+    ):
+        self.positions = list(positions)
+        self.limits = limits
+        self.thermal = thermal
+        self.measure_time = measure_time
+        self.home = home_position
+        self.standby = standby_temperature
+        self.prepositioning = prepositioning
+
+    def sweep(self, reverse: bool) -> List[float]:
+        return self.positions[::-1] if reverse else self.positions
+
+    def transition(
+        self,
+        t: float,
+        from_temp: float,
+        from_pos: float,
+        to_temp: float,
+        to_pos: float,
+        steps: Optional[List[TimelineStep]] = None,
+    ) -> float:
+        """Change temperature and position; returns the end time"""
+        legs = [(from_temp, to_temp)]
+        if self.standby is not None:
+            legs = [(from_temp, self.standby), (self.standby, to_temp)]
+        legs = [(a, b) for a, b in legs if a != b]
+
+        def heat(start: float) -> float:
+            for a, b in legs:
+                duration = self.thermal.transition_time(a, b)
+                if steps is not None:
+                    steps.append(TimelineStep(STEP_THERMAL, start, start + duration, b, from_pos))
+                start += duration
+            return start
+
+        def move(start: float, a: float, b: float, temperature: float) -> float:
+            duration = self.limits.move_time(b - a)
+            if steps is not None and duration > 0:
+                steps.append(TimelineStep(STEP_MOVE, start, start + duration, temperature, b))
+            return start + duration
+
+        if self.prepositioning:
+            return max(heat(t), move(t, from_pos, to_pos, from_temp))
+        t = move(t, from_pos, self.home, from_temp)
+        t = heat(t)
+        return move(t, self.home, to_pos, to_temp)
+
+    def measure(
+        self,
+        t: float,
+        temperature: float,
+        sweep: List[float],
+        steps: Optional[List[TimelineStep]] = None,
+    ) -> float:
+        """Measure a sweep starting at its first position; returns the end time"""
+        for i, position in enumerate(sweep):
+            if i:
+                duration = self.limits.move_time(position - sweep[i - 1])
+                if steps is not None and duration > 0:
+                    steps.append(TimelineStep(STEP_MOVE, t, t + duration, temperature, position))
+                t += duration
+            if steps is not None:
+                steps.append(
+                    TimelineStep(STEP_MEASURE, t, t + self.measure_time, temperature, position)
+                )
+            t += self.measure_time
+        return t
+
+
+def plan_measurements(
+    temperatures: Sequence[float],
+    positions: Sequence[float],
+    limits: AxisLimits,
+    thermal: ThermalModel,
+    measure_time: float,
+    start_temperature: float,
+    start_position: float,
+    standby_temperature: Optional[float] = None,
+    reorder: bool = True,
+    allow_reverse: bool = True,
+    prepositioning: bool = True,
+) -> MeasurementPlan:
+    """
+    Order the measurement matrix for the shortest predicted cycle
+
+    Args:
+        temperatures: Test temperatures (one sweep each)
+        positions: Measurement positions in configured sweep order
+        limits: Axis motion limits (see read_axis_limits)
+        thermal: Temperature transition model
+        measure_time: Stabilization plus force reading per point (s)
+        start_temperature: Temperature at cycle start
+        start_position: Axis position at cycle start; the axis returns here at the end
+        standby_temperature: Temperature passed between groups and at the end
+            (None = change directly between test temperatures)
+        reorder: Allow changing the temperature order
+        allow_reverse: Allow sweeping positions in reverse order
+        prepositioning: Move while the temperature changes
+
+    Returns:
+        The plan with its predicted timeline
+    """
+    groups = list(dict.fromkeys(temperatures))
+    if not groups or not positions:
+        raise ValueError("Measurement matrix is empty")
+
+    planner = _Planner(
+        positions,
+        limits,
+        thermal,
+        measure_time,
+        start_position,
+        standby_temperature,
+        prepositioning,
+    )
+    end_temperature = start_temperature if standby_temperature is None else standby_temperature
+    directions = (False, True) if allow_reverse else (False,)
+
+    if not reorder or len(groups) > TRAVEL_EXACT_MAX_GROUPS:
+        order = _order_sequential(planner, groups, directions, start_temperature, reorder)
+    else:
+        order = _order_exact(planner, groups, directions, start_temperature, end_temperature)
+
+    # Build the timeline with the same cost model the search used
+    steps: List[TimelineStep] = []
+    t = 0.0
+    temp, pos = start_temperature, start_position
+    points = []
+    for temperature, reverse in order:
+        sweep = planner.sweep(reverse)
+        t = planner.transition(t, temp, pos, temperature, sweep[0], steps)
+        t = planner.measure(t, temperature, sweep, steps)
+        points.extend((temperature, position) for position in sweep)
+        temp, pos = temperature, sweep[-1]
+    t = planner.transition(t, temp, pos, end_temperature, start_position, steps)
+
+    return MeasurementPlan(
+        points=tuple(points),
+        sweeps=tuple(order),
+        timeline=tuple(steps),
+        total_time=t,
+    )
+
+
+def _order_exact(
+    planner: _Planner,
+    groups: List[float],
+    directions: Tuple[bool, ...],
+    start_temperature: float,
+    end_temperature: float,
+) -> List[Tuple[float, bool]]:
+    """Held-Karp over (visited groups, last group, last direction)"""
+    n = len(groups)
+    ends = {d: planner.sweep(d) for d in directions}
+
+    def cost(a: Tuple[float, float], group: int, direction: bool) -> float:
+        return planner.transition(0.0, a[0], a[1], groups[group], ends[direction][0])
+
+    # Sweep times are the same in both directions and for every order, so only
+    # the transitions are optimized
+    best: Dict[Tuple[int, int, bool], Tuple[float, Optional[Tuple[int, int, bool]]]] = {}
+    for g in range(n):
+        for d in directions:
+            best[(1 << g, g, d)] = (cost((start_temperature, planner.home), g, d), None)
+
+    for mask in range(1, 1 << n):
+        for g in range(n):
+            for d in directions:
+                entry = best.get((mask, g, d))
+                if entry is None:
+                    continue
+                here = (groups[g], ends[d][-1])
+                for nxt in range(n):
+                    if mask >> nxt & 1:
+                        continue
+                    for nd in directions:
+                        key = (mask | 1 << nxt, nxt, nd)
+                        total = entry[0] + cost(here, nxt, nd)
+                        if key not in best or total < best[key][0]:
+                            best[key] = (total, (mask, g, d))
+
+    full = (1 << n) - 1
+    last = min(
+        ((full, g, d) for g in range(n) for d in directions),
+        key=lambda k: best[k][0]
+        + planner.transition(
+            0.0, groups[k[1]], ends[k[2]][-1], end_temperature, planner.home
+        ),
+    )
+    order: List[Tuple[float, bool]] = []
+    key: Optional[Tuple[int, int, bool]] = last
+    while key is not None:
+        order.append((groups[key[1]], key[2]))
+        key = best[key][1]
+    return order[::-1]
+
+
+def _order_sequential(
+    planner: _Planner,
+    groups: List[float],
+    directions: Tuple[bool, ...],
+    start_temperature: float,
+    reorder: bool,
+) -> List[Tuple[float, bool]]:
+    """Configured order (best direction per sweep) or nearest-next when reordering"""
+    remaining = list(groups)
+    temp, pos = start_temperature, planner.home
+    order: List[Tuple[float, bool]] = []
+    while remaining:
+        candidates = remaining if reorder else remaining[:1]
+        temperature, reverse = min(
+            ((c, d) for c in candidates for d in directions),
+            key=lambda cd: planner.transition(
+                0.0, temp, pos, cd[0], planner.sweep(cd[1])[0]
+            ),
+        )
+        remaining.remove(temperature)
+        order.append((temperature, reverse))
+        temp, pos = temperature, planner.sweep(reverse)[-1]
+    return order
@@ -0,0 +1,334 @@
+"""
+AJINEXTEK Multi-Axis Jog Controller
+
+Synchronized velocity motion for GUI jogging and continuous scans.
+A group of axes is started, retargeted and stopped with single AXL calls
+(AxmMoveStartMultiVel/Ex, AxmOverrideMultiVel, AxmMoveMultiStop) instead of
+one AxmMoveVel call per axis, so all axes start and stop together.
+
+Optionally the group runs in deadman mode: the client must call keepalive()
+periodically and a watchdog thread stops the group as soon as keepalives lapse.
+"""
+
+# Standard library imports
+import threading
+import time
+from typing import Any, Dict, List, Optional, Sequence
+
+# Third-party imports
+from loguru import logger
+
+# Local application imports
+from domain.exceptions.robot_exceptions import RobotMotionError
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    JOG_DEFAULT_DEADMAN_TIMEOUT,
+    JOG_WATCHDOG_PERIOD,
+    MULTI_VEL_SYNC_STOP,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.error_codes import (
+    AXT_RT_SUCCESS,
+    get_error_message,
+)
+
+
+class MultiAxisJogController:
+    """다축 동기 속도(Jog) 구동 컨트롤러"""
+
+    def __init__(self, axl: Optional[Any] = None, watchdog_period: float = JOG_WATCHDOG_PERIOD):
+        """
+        초기화
+
+        Args:
+            axl: AXLWrapper instance (defaults to the process-wide singleton)
+            watchdog_period: Deadman check period in seconds
+        """
+        if axl is None:
+            # Local application imports
+            from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import (
+                AXLWrapper,
+            )
+
+            axl = AXLWrapper.get_instance()
+
+        self._axl = axl
+        self._watchdog_period = watchdog_period
+
+        # Active group state (guarded by _lock)
+        self._lock = threading.RLock()
+        self._axes: List[int] = []
+        self._velocities: List[float] = []
+        self._directions: List[int] = []  # Sign of each axis' start velocity (-1, 0, 1)
+        self._decels: List[float] = []
+        self._max_velocities: List[float] = []
+        self._active = False
+
+        # Override limits already written to the controller, per axis
+        self._override_max_vel: Dict[int, float] = {}
+
+        # Deadman supervision
+        self._deadman_timeout: Optional[float] = None
+        self._last_keepalive = 0.0
+        self._deadman_tripped = False
+        self._watchdog_stop = threading.Event()
+        self._watchdog_thread: Optional[threading.Thread] = None
+
+    # ========================================================================
+    # Group Motion
+    # ========================================================================
+
+    def start(
+        self,
+        axes: Sequence[int],
+        velocities: Sequence[float],
+        accels: Sequence[float],
+        decels: Sequence[float],
+        sync_mode: Optional[int] = MULTI_VEL_SYNC_STOP,
+        max_velocities: Optional[Sequence[float]] = None,
+        deadman_timeout: Optional[float] = None,
+    ) -> None:
+        """
+        Start all axes of the group in one call
+
+        Args:
+            axes: Axis numbers of the group
+            velocities: Signed velocity per axis (positive = CW, negative = CCW)
+            accels: Acceleration per axis
+            decels: Deceleration per axis (also used when the group is stopped)
+            sync_mode: MULTI_VEL_SYNC_* mode, or None for plain AxmMoveStartMultiVel
+            max_velocities: Highest |velocity| retarget() may request per axis
+                (defaults to the start velocities)
+            deadman_timeout: Enable deadman mode with this keepalive timeout in seconds
+
+        Raises:
+            ValueError: If parameter lists are inconsistent
+            RobotMotionError: If a group is already running or the controller rejects the start
+        """
+        axes = list(axes)
+        if not axes:
+            raise ValueError("At least one axis is required")
+        if len(set(axes)) != len(axes):
+            raise ValueError(f"Duplicate axes in jog group: {axes}")
+        if not all(len(lst) == len(axes) for lst in [velocities, accels, decels]):
+            raise ValueError("All parameter lists must have the same length as axes")
+
+        limits = [abs(v) for v in (max_velocities if max_velocities is not None else velocities)]
+        if len(limits) != len(axes):
+            raise ValueError("max_velocities must have the same length as axes")
+
+        with self._lock:
+            if self._active:
+                raise RobotMotionError(
+                    f"Jog group {self._axes} is already running - stop it first",
+                    "AJINEXTEK",
+                )
+
+            # Override limits must be in place before motion starts; skip unchanged ones
+            for axis, limit in zip(axes, limits):
+                if self._override_max_vel.get(axis) == limit:
+                    continue
+                result = self._axl.override_set_max_vel(axis, limit)
+                self._check_result(result, f"set override max velocity on axis {axis}")
+                self._override_max_vel[axis] = limit
+
+            result = self._axl.move_start_multi_vel(
+                axes, list(velocities), list(accels), list(decels), sync_mode
+            )
+            self._check_result(result, f"start multi-axis jog on axes {axes}")
+
+            self._axes = axes
+            self._velocities = list(velocities)
+            self._directions = [_sign(v) for v in velocities]
+            self._decels = list(decels)
+            self._max_velocities = limits
+            self._active = True
+            self._deadman_tripped = False
+            self._deadman_timeout = deadman_timeout
+            self._last_keepalive = time.monotonic()
+
+            logger.info(
+                f"Multi-axis jog started on axes {axes} at {self._velocities} "
+                f"(sync_mode={sync_mode}, deadman={deadman_timeout})"
+            )
+
+        if deadman_timeout is not None:
+            self._start_watchdog()
+
+    def start_deadman(
+        self,
+        axes: Sequence[int],
+        velocities: Sequence[float],
+        accels: Sequence[float],
+        decels: Sequence[float],
+        timeout: float = JOG_DEFAULT_DEADMAN_TIMEOUT,
+        **kwargs: Any,
+    ) -> None:
+        """Start the group in deadman mode (convenience wrapper for interactive jogs)"""
+        self.start(axes, velocities, accels, decels, deadman_timeout=timeout, **kwargs)
+
+    def retarget(self, velocities: Sequence[float]) -> None:
+        """
+        Change the velocity of every running axis in one AxmOverrideMultiVel call
+
+        Direction changes are not possible through a velocity override (only
+        |velocity| is sent); every new velocity must keep the sign the axis was
+        started with, so reversing, stopping at 0 or starting a standing axis
+        takes a stop and restart of the group.
+
+        Args:
+            velocities: New signed velocity per axis, in group order
+
+        Raises:
+            ValueError: If the list length, direction or override limit is invalid
+            RobotMotionError: If no group is running or the override fails
+        """
+        with self._lock:
+            self._ensure_active()
+            velocities = list(velocities)
+            if len(velocities) != len(self._axes):
+                raise ValueError("Velocity list must match the jog group size")
+
+            for axis, direction, new, limit in zip(
+                self._axes, self._directions, velocities, self._max_velocities
+            ):
+                if _sign(new) != direction:
+                    raise ValueError(f"Axis {axis}: direction change requires stop and restart")
+                if abs(new) > limit:
+                    raise ValueError(
+                        f"Axis {axis}: velocity {abs(new)} exceeds override limit {limit}"
+                    )
+
+            if velocities == self._velocities:
+                self._last_keepalive = time.monotonic()
+                return
+
+            result = self._axl.override_multi_vel(self._axes, [abs(v) for v in velocities])
+            self._check_result(result, f"override jog velocity on axes {self._axes}")
+            self._velocities = velocities
+            self._last_keepalive = time.monotonic()
+            logger.debug(f"Multi-axis jog retargeted to {velocities}")
+
+    def keepalive(self) -> None:
+        """Refresh the deadman timer (call periodically while the jog key is held)"""
+        with self._lock:
+            self._last_keepalive = time.monotonic()
+
+    def stop(self, emergency: bool = False) -> None:
+        """
+        Stop all axes of the group together
+
+        Args:
+            emergency: Use AxmMoveMultiEStop instead of a decelerated stop
+        """
+        with self._lock:
+            if not self._active:
+                return
+            axes = list(self._axes)
+            if emergency:
+                result = self._axl.move_multi_emergency_stop(axes)
+            else:
+                result = self._axl.move_multi_stop(axes, list(self._decels))
+            self._active = False
+
+        self._stop_watchdog()
+        self._check_result(result, f"stop multi-axis jog on axes {axes}")
+        logger.info(f"Multi-axis jog stopped on axes {axes} (emergency={emergency})")
+
+    def close(self) -> None:
+        """Stop any running group and release the watchdog thread"""
+        try:
+            self.stop()
+        finally:
+            self._stop_watchdog()
+
+    # ========================================================================
+    # Status
+    # ========================================================================
+
+    @property
+    def is_active(self) -> bool:
+        """True while a jog group is running"""
+        return self._active
+
+    @property
+    def deadman_tripped(self) -> bool:
+        """True when the last group was stopped by the deadman watchdog"""
+        return self._deadman_tripped
+
+    def get_status(self) -> Dict[str, Any]:
+        """Snapshot of the jog group state"""
+        with self._lock:
+            return {
+                "active": self._active,
+                "axes": list(self._axes),
+                "velocities": list(self._velocities),
+                "deadman_timeout": self._deadman_timeout,
+                "deadman_tripped": self._deadman_tripped,
+                "keepalive_age": time.monotonic() - self._last_keepalive if self._active else None,
+            }
+
+    # ========================================================================
+    # Deadman Watchdog
+    # ========================================================================
+
+    def _start_watchdog(self) -> None:
+        if self._watchdog_thread is not None and self._watchdog_thread.is_alive():
+            return
+        self._watchdog_stop.clear()
+        self._watchdog_thread = threading.Thread(
+            target=self._watchdog_loop, name="AXL-JogDeadman", daemon=True
+        )
+        self._watchdog_thread.start()
+
+    def _stop_watchdog(self) -> None:
+        self._watchdog_stop.set()
+        thread = self._watchdog_thread
+        if thread is not None and thread is not threading.current_thread():
+            thread.join(timeout=1.0)
+        self._watchdog_thread = None
+
+    def _watchdog_loop(self) -> None:
+        while not self._watchdog_stop.wait(self._watchdog_period):
+            with self._lock:
+                if not self._active or self._deadman_timeout is None:
+                    return
+                age = time.monotonic() - self._last_keepalive
+                if age <= self._deadman_timeout:
+                    continue
+                axes = list(self._axes)
+                logger.warning(
+                    f"Jog deadman expired on axes {axes} (no keepalive for {age:.3f}s) - stopping"
+                )
+                try:
+                    result = self._axl.move_multi_stop(axes, list(self._decels))
+                    if result != AXT_RT_SUCCESS:
+                        logger.error(
+                            f"Deadman stop failed, falling back to emergency stop: "
+                            f"{get_error_message(result)}"
+                        )
+                        self._axl.move_multi_emergency_stop(axes)
+                except Exception as e:
+                    logger.error(f"Deadman stop raised {e}, falling back to emergency stop")
+                    self._axl.move_multi_emergency_stop(axes)
+                self._active = False
+                self._deadman_tripped = True
+                return
+
+    # ========================================================================
+    # Helper Methods
+    # ========================================================================
+
+    def _ensure_active(self) -> None:
+        if not self._active:
+            raise RobotMotionError("No multi-axis jog is running", "AJINEXTEK")
+
+    @staticmethod
+    def _check_result(result: int, action: str) -> None:
+        if result != AXT_RT_SUCCESS:
+            error_msg = get_error_message(result)
+            logger.error(f"Failed to {action}: {error_msg}")
+            raise RobotMotionError(f"Failed to {action}: {error_msg}", "AJINEXTEK")
+
+
+def _sign(value: float) -> int:
+    """Direction of a signed velocity: -1, 0 or 1"""
+    return (value > 0) - (value < 0)
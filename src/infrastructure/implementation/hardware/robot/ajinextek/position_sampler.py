@@ -0,0 +1,240 @@
+"""
+AJINEXTEK Coherent Position Sampler
+
+Captures command and actual position of each axis as one pair per sample
+with AxmStatusReadMotionInfo (dwMask = MOTION_INFO_CMD_POS | ACT_POS), so
+both values come from the same controller cycle. Reading them with
+get_cmd_pos() and get_act_pos() puts a driver call between the two, and
+during motion that call time shows up as following error.
+
+A background thread samples every configured axis at a fixed period into a
+per-axis TimestampedRing (columns: cmd, act; timestamp: midpoint of the
+call). kinematics() derives command/actual velocity and following error
+from a ring window in one vectorized pass.
+
+Libraries without AxmStatusReadMotionInfo fall back to the two separate
+reads; get_statistics() reports which path is in use.
+"""
+
+# Standard library imports
+from dataclasses import dataclass
+import threading
+import time
+from typing import Any, Dict, Optional, Tuple
+
+# Third-party imports
+from loguru import logger
+import numpy as np
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLFunctionNotAvailableError
+from infrastructure.implementation.hardware.common.sample_ring import TimestampedRing
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import MOTION_INFO
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    MOTION_INFO_POSITIONS,
+    POSITION_RING_CAPACITY,
+    POSITION_SAMPLE_PERIOD,
+)
+
+COLUMN_CMD = 0
+COLUMN_ACT = 1
+
+
+@dataclass
+class _AxisCapture:
+    """Per-axis capture state"""
+
+    ring: TimestampedRing
+    info: MOTION_INFO  # Reused for every read
+    samples: int = 0
+    errors: int = 0
+
+
+class PositionSampler:
+    """축별 지령/실제 위치 동시 캡처 샘플러 (AxmStatusReadMotionInfo)"""
+
+    def __init__(
+        self,
+        axl: Optional[Any] = None,
+        period: float = POSITION_SAMPLE_PERIOD,
+        ring_capacity: int = POSITION_RING_CAPACITY,
+    ):
+        """
+        초기화
+
+        Args:
+            axl: AXLWrapper instance (defaults to the process-wide singleton)
+            period: Sampling period in seconds
+            ring_capacity: (cmd, act) pairs kept per axis
+        """
+        if axl is None:
+            # Local application imports
+            from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import (
+                AXLWrapper,
+            )
+
+            axl = AXLWrapper.get_instance()
+
+        self._axl = axl
+        self._period = period
+        self._ring_capacity = ring_capacity
+        self._axes: Dict[int, _AxisCapture] = {}
+        self._lock = threading.Lock()
+
+        self._coherent = True  # Fall back to separate reads when ReadMotionInfo is missing
+        self._ticks = 0
+        self._overruns = 0
+        self._stop_event = threading.Event()
+        self._thread: Optional[threading.Thread] = None
+
+    # ========================================================================
+    # Configuration
+    # ========================================================================
+
+    def add_axis(self, axis: int) -> None:
+        """Start capturing an axis (an existing ring is kept)"""
+        with self._lock:
+            if axis not in self._axes:
+                info = MOTION_INFO()
+                info.dwMask = MOTION_INFO_POSITIONS
+                self._axes[axis] = _AxisCapture(TimestampedRing(self._ring_capacity, 2), info)
+
+    def remove_axis(self, axis: int) -> None:
+        """Stop capturing an axis and drop its ring"""
+        with self._lock:
+            self._axes.pop(axis, None)
+
+    # ========================================================================
+    # Sampling Thread
+    # ========================================================================
+
+    def start(self) -> None:
+        """Start the background sampling thread"""
+        if self._thread is not None and self._thread.is_alive():
+            return
+        self._stop_event.clear()
+        self._thread = threading.Thread(target=self._run, name="AXL-PositionSampler", daemon=True)
+        self._thread.start()
+        logger.info(f"Position sampler started (period: {self._period * 1000:.1f} ms)")
+
+    def stop(self) -> None:
+        """Stop the background sampling thread (rings are kept)"""
+        self._stop_event.set()
+        if self._thread is not None:
+            self._thread.join(timeout=2.0)
+            self._thread = None
+        logger.info("Position sampler stopped")
+
+    @property
+    def is_running(self) -> bool:
+        return self._thread is not None and self._thread.is_alive()
+
+    def _run(self) -> None:
+        next_tick = time.monotonic()
+        while not self._stop_event.is_set():
+            self.sample_once()
+            next_tick += self._period
+            delay = next_tick - time.monotonic()
+            if delay < 0:
+                # Overrun - resynchronize instead of bursting
+                self._overruns += 1
+                next_tick = time.monotonic()
+                delay = 0
+            self._stop_event.wait(delay)
+
+    def sample_once(self) -> int:
+        """
+        Capture one (cmd, act) pair of every configured axis
+
+        Returns:
+            Number of axes sampled
+        """
+        with self._lock:
+            axes = list(self._axes.items())
+
+        self._ticks += 1
+        sampled = 0
+        for axis, capture in axes:
+            try:
+                start = time.monotonic()
+                cmd, act = self._read_positions(axis, capture)
+                stamp = (start + time.monotonic()) / 2
+            except Exception as e:
+                capture.errors += 1
+                if capture.errors == 1 or capture.errors % 100 == 0:
+                    logger.warning(f"Position capture failed for axis {axis}: {e}")
+                continue
+            capture.ring.append(stamp, (cmd, act))
+            capture.samples += 1
+            sampled += 1
+        return sampled
+
+    def _read_positions(self, axis: int, capture: _AxisCapture) -> Tuple[float, float]:
+        if self._coherent:
+            try:
+                self._axl.status_read_motion_info(axis, capture.info)
+                return capture.info.dCmdPos, capture.info.dActPos
+            except AXLFunctionNotAvailableError:
+                logger.info("AxmStatusReadMotionInfo not available - reading positions separately")
+                self._coherent = False
+        return self._axl.get_cmd_pos(axis), self._axl.get_act_pos(axis)
+
+    # ========================================================================
+    # Data Access
+    # ========================================================================
+
+    def get_ring(self, axis: int) -> TimestampedRing:
+        """Raw capture ring of an axis (columns: cmd, act)"""
+        return self._get_capture(axis).ring
+
+    def kinematics(
+        self, axis: int, duration: Optional[float] = None, end: Optional[float] = None
+    ) -> Dict[str, np.ndarray]:
+        """
+        Positions, velocities and following error over a window
+
+        Args:
+            axis: Axis number
+            duration: Window length in seconds (None = whole ring)
+            end: Window end timestamp (None = newest sample)
+
+        Returns:
+            {time, cmd_pos, act_pos, cmd_vel, act_vel, following_error} arrays;
+            velocities are zero with fewer than two samples
+        """
+        times, values = self._get_capture(axis).ring.window(duration, end)
+        cmd = values[:, COLUMN_CMD]
+        act = values[:, COLUMN_ACT]
+        if len(times) >= 2:
+            velocities = np.gradient(values, times, axis=0)
+        else:
+            velocities = np.zeros_like(values)
+        return {
+            "time": times,
+            "cmd_pos": cmd,
+            "act_pos": act,
+            "cmd_vel": velocities[:, COLUMN_CMD],
+            "act_vel": velocities[:, COLUMN_ACT],
+            "following_error": cmd - act,
+        }
+
+    def get_statistics(self) -> Dict[str, Any]:
+        """Capture path, tick/overrun counters and per-axis sample counts"""
+        with self._lock:
+            axes = {
+                axis: {"samples": c.samples, "errors": c.errors, "buffered": len(c.ring)}
+                for axis, c in self._axes.items()
+            }
+        return {
+            "coherent": self._coherent,
+            "ticks": self._ticks,
+            "overruns": self._overruns,
+            "axes": axes,
+        }
+
+    def _get_capture(self, axis: int) -> _AxisCapture:
+        with self._lock:
+            capture = self._axes.get(axis)
+        if capture is None:
+            raise ValueError(f"Axis {axis} is not captured")
+        return capture
@@ -0,0 +1,456 @@
+"""
+AJINEXTEK Process Image Scanner
+
+PLC-style scan cycle over all configured IO. At a fixed period the scanner
+first flushes queued output writes - one dword write per changed DIO output
+dword and one AxmSignalWriteOutput per changed axis - then reads every DIO
+input and output dword, the universal inputs and outputs of each configured
+axis and all configured analog inputs (one AxaiSwReadMultiVoltage call) into
+the back buffer of a double-buffered process image, and swaps it to the
+front.
+
+Consumers read the front image instead of calling the driver, so every
+reader sees the same consistent snapshot and the driver sees one sweep per
+cycle no matter how many services look at the IO. A front image stays
+unchanged for one full cycle after it is replaced; use snapshot() to keep a
+copy for longer. Queued bits are merged into the output dword of the last
+image, so outputs of scanned modules should be written through the queue.
+
+Cycle hooks run on the scan thread right after each swap, so logic that
+must react to the IO (see interlock.py) sees every image without polling.
+Failure hooks run instead when a cycle fails and no image is published.
+Forced output bits override queued writes until they are released.
+"""
+
+# Standard library imports
+from ctypes import c_double, c_long
+from dataclasses import dataclass, field
+import math
+import threading
+import time
+from typing import Any, Callable, Dict, Iterable, List, Optional, Sequence, Tuple
+
+# Third-party imports
+from loguru import logger
+import numpy as np
+
+# Local application imports
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    SCAN_DEFAULT_PERIOD,
+    SCAN_DWORD_BITS,
+)
+
+
+@dataclass
+class ProcessImage:
+    """One consistent snapshot of all scanned IO"""
+
+    cycle: int = 0
+    timestamp: float = 0.0  # time.monotonic() at the end of the sweep
+    dio_inputs: Dict[int, np.ndarray] = field(default_factory=dict)  # module -> uint32 dwords
+    dio_outputs: Dict[int, np.ndarray] = field(default_factory=dict)
+    axis_inputs: Dict[int, int] = field(default_factory=dict)  # axis -> universal input bits
+    axis_outputs: Dict[int, int] = field(default_factory=dict)
+    axis_motion: Dict[int, bool] = field(default_factory=dict)  # axis -> in motion
+    analog_inputs: Dict[int, float] = field(default_factory=dict)  # channel -> volts
+
+    def input_bit(self, module_no: int, offset: int) -> bool:
+        dword, bit = divmod(offset, SCAN_DWORD_BITS)
+        return bool(int(self.dio_inputs[module_no][dword]) >> bit & 1)
+
+    def output_bit(self, module_no: int, offset: int) -> bool:
+        dword, bit = divmod(offset, SCAN_DWORD_BITS)
+        return bool(int(self.dio_outputs[module_no][dword]) >> bit & 1)
+
+    def axis_input_bit(self, axis_no: int, bit: int) -> bool:
+        return bool(self.axis_inputs[axis_no] >> bit & 1)
+
+    def axis_output_bit(self, axis_no: int, bit: int) -> bool:
+        return bool(self.axis_outputs[axis_no] >> bit & 1)
+
+    def in_motion(self, axis_no: int) -> bool:
+        return self.axis_motion[axis_no]
+
+    def analog(self, channel_no: int) -> float:
+        return self.analog_inputs[channel_no]
+
+    def copy(self) -> "ProcessImage":
+        return ProcessImage(
+            cycle=self.cycle,
+            timestamp=self.timestamp,
+            dio_inputs={m: v.copy() for m, v in self.dio_inputs.items()},
+            dio_outputs={m: v.copy() for m, v in self.dio_outputs.items()},
+            axis_inputs=dict(self.axis_inputs),
+            axis_outputs=dict(self.axis_outputs),
+            axis_motion=dict(self.axis_motion),
+            analog_inputs=dict(self.analog_inputs),
+        )
+
+
+class ProcessImageScanner:
+    """PLC 방식 주기 스캔 프로세스 이미지 서비스"""
+
+    def __init__(self, axl: Optional[Any] = None, scan_period: float = SCAN_DEFAULT_PERIOD):
+        """
+        초기화
+
+        Args:
+            axl: AXLWrapper instance (defaults to the process-wide singleton)
+            scan_period: Scan cycle period in seconds
+        """
+        if axl is None:
+            # Local application imports
+            from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import (
+                AXLWrapper,
+            )
+
+            axl = AXLWrapper.get_instance()
+
+        self._axl = axl
+        self._scan_period = scan_period
+
+        # Scan configuration: module -> (input dwords, output dwords)
+        self._modules: Dict[int, Tuple[int, int]] = {}
+        self._axes: List[int] = []
+        self._analog_channels: List[int] = []
+        self._ai_channel_buf: Any = (c_long * 0)()
+        self._ai_volt_buf: Any = (c_double * 0)()
+
+        # Double buffer; the scan thread fills _back and swaps
+        self._front = ProcessImage()
+        self._back = ProcessImage()
+        self._config_lock = threading.Lock()
+        self._cycle_done = threading.Condition()
+
+        # Queued writes: (module, dword) -> (mask, bits); axis -> (mask, bits)
+        self._queue_lock = threading.Lock()
+        self._dio_queue: Dict[Tuple[int, int], Tuple[int, int]] = {}
+        self._axis_queue: Dict[int, Tuple[int, int]] = {}
+        self._forced: Dict[Tuple[int, int], Tuple[int, int]] = {}
+
+        self._hooks: List[Callable[[ProcessImage], None]] = []
+        self._failure_hooks: List[Callable[[Exception], None]] = []
+
+        self._cycles = 0
+        self._errors = 0
+        self._hook_errors = 0
+        self._overruns = 0
+        self._last_scan_time = 0.0
+
+        self._stop_event = threading.Event()
+        self._thread: Optional[threading.Thread] = None
+
+    # ========================================================================
+    # Configuration
+    # ========================================================================
+
+    def add_dio_module(self, module_no: int) -> None:
+        """Scan all input and output points of a DIO module"""
+        inputs = self._axl.get_input_count(module_no)
+        outputs = self._axl.get_output_count(module_no)
+        with self._config_lock:
+            self._modules[module_no] = (
+                math.ceil(inputs / SCAN_DWORD_BITS),
+                math.ceil(outputs / SCAN_DWORD_BITS),
+            )
+        logger.info(
+            f"Process image: DIO module {module_no} ({inputs} inputs, {outputs} outputs)"
+        )
+
+    def add_axis(self, axis_no: int) -> None:
+        """Scan the universal inputs and outputs and the in-motion flag of an axis"""
+        with self._config_lock:
+            if axis_no not in self._axes:
+                self._axes.append(axis_no)
+
+    def add_analog_inputs(self, channels: Sequence[int]) -> None:
+        """Scan analog input channels (all read with one call per cycle)"""
+        with self._config_lock:
+            for channel in channels:
+                if channel not in self._analog_channels:
+                    self._analog_channels.append(channel)
+            count = len(self._analog_channels)
+            self._ai_channel_buf = (c_long * count)(*self._analog_channels)
+            self._ai_volt_buf = (c_double * count)()
+
+    def get_layout(self) -> Dict[str, Any]:
+        """Scanned DIO modules (input, output point capacity), axes and analog channels"""
+        with self._config_lock:
+            return {
+                "modules": {
+                    module_no: (in_dwords * SCAN_DWORD_BITS, out_dwords * SCAN_DWORD_BITS)
+                    for module_no, (in_dwords, out_dwords) in self._modules.items()
+                },
+                "axes": list(self._axes),
+                "analog_inputs": list(self._analog_channels),
+            }
+
+    # ========================================================================
+    # Consumer API
+    # ========================================================================
+
+    @property
+    def image(self) -> ProcessImage:
+        """Front image of the last completed cycle (do not modify)"""
+        return self._front
+
+    def snapshot(self) -> ProcessImage:
+        """Independent copy of the front image"""
+        return self._front.copy()
+
+    def wait_cycle(self, timeout: Optional[float] = None) -> bool:
+        """
+        Block until the next scan cycle has completed
+
+        Returns:
+            True if a new image was published, False on timeout
+        """
+        with self._cycle_done:
+            cycle = self._front.cycle
+            return self._cycle_done.wait_for(lambda: self._front.cycle > cycle, timeout)
+
+    def queue_output(self, module_no: int, offset: int, value: bool) -> None:
+        """Queue a DIO output bit; written with the next cycle's flush"""
+        dword, bit = divmod(offset, SCAN_DWORD_BITS)
+        self._queue_bits(False, (module_no, dword), bit, value)
+
+    def queue_outputs(self, module_no: int, values: Dict[int, bool]) -> None:
+        """Queue several DIO output bits of one module"""
+        for offset, value in values.items():
+            self.queue_output(module_no, offset, value)
+
+    def queue_axis_output(self, axis_no: int, bit: int, value: bool) -> None:
+        """Queue a universal output bit of an axis"""
+        self._queue_bits(True, axis_no, bit, value)
+
+    def force_outputs(self, module_no: int, values: Dict[int, bool]) -> None:
+        """Hold DIO output bits at a level every cycle, overriding queued writes"""
+        with self._queue_lock:
+            for offset, value in values.items():
+                dword, bit = divmod(offset, SCAN_DWORD_BITS)
+                self._set_bits(self._forced, (module_no, dword), bit, value)
+
+    def release_outputs(self, module_no: int, offsets: Iterable[int]) -> None:
+        """Stop forcing DIO output bits (they keep their level until written)"""
+        with self._queue_lock:
+            for offset in offsets:
+                dword, bit = divmod(offset, SCAN_DWORD_BITS)
+                mask, bits = self._forced.pop((module_no, dword), (0, 0))
+                mask &= ~(1 << bit)
+                if mask:
+                    self._forced[(module_no, dword)] = (mask, bits & mask)
+
+    def add_cycle_hook(self, hook: Callable[[ProcessImage], None]) -> None:
+        """Call hook(image) on the scan thread after every published image"""
+        with self._config_lock:
+            if hook not in self._hooks:
+                self._hooks.append(hook)
+
+    def remove_cycle_hook(self, hook: Callable[[ProcessImage], None]) -> None:
+        with self._config_lock:
+            if hook in self._hooks:
+                self._hooks.remove(hook)
+
+    def add_failure_hook(self, hook: Callable[[Exception], None]) -> None:
+        """Call hook(error) on the scan thread after every failed cycle"""
+        with self._config_lock:
+            if hook not in self._failure_hooks:
+                self._failure_hooks.append(hook)
+
+    def remove_failure_hook(self, hook: Callable[[Exception], None]) -> None:
+        with self._config_lock:
+            if hook in self._failure_hooks:
+                self._failure_hooks.remove(hook)
+
+    def _queue_bits(self, axis: bool, key: Any, bit: int, value: bool) -> None:
+        with self._queue_lock:
+            # Look the queue up under the lock: scan_once() swaps it out
+            queue: Dict[Any, Tuple[int, int]] = self._axis_queue if axis else self._dio_queue
+            self._set_bits(queue, key, bit, value)
+
+    @staticmethod
+    def _set_bits(queue: Dict[Any, Tuple[int, int]], key: Any, bit: int, value: bool) -> None:
+        mask, bits = queue.get(key, (0, 0))
+        mask |= 1 << bit
+        bits = bits | (1 << bit) if value else bits & ~(1 << bit)
+        queue[key] = (mask, bits)
+
+    # ========================================================================
+    # Scan Cycle
+    # ========================================================================
+
+    def start(self) -> None:
+        """Start the scan thread"""
+        if self._thread is not None and self._thread.is_alive():
+            return
+        self._stop_event.clear()
+        self._thread = threading.Thread(target=self._run, name="AXL-ProcessImage", daemon=True)
+        self._thread.start()
+        logger.info(f"Process image scan started (period: {self._scan_period * 1000:.1f} ms)")
+
+    def stop(self) -> None:
+        """Stop the scan thread (queued writes are flushed by a final cycle)"""
+        self._stop_event.set()
+        if self._thread is not None:
+            self._thread.join(timeout=2.0)
+            self._thread = None
+        logger.info("Process image scan stopped")
+
+    @property
+    def is_running(self) -> bool:
+        return self._thread is not None and self._thread.is_alive()
+
+    def _run(self) -> None:
+        next_tick = time.monotonic()
+        while not self._stop_event.is_set():
+            self.scan_once()
+            next_tick += self._scan_period
+            delay = next_tick - time.monotonic()
+            if delay < 0:
+                # Overrun - resynchronize instead of bursting
+                self._overruns += 1
+                next_tick = time.monotonic()
+                delay = 0
+            self._stop_event.wait(delay)
+        self.scan_once()
+
+    def scan_once(self) -> bool:
+        """
+        Run one scan cycle: flush queued outputs, sweep all IO, swap images
+
+        Returns:
+            True if a new image was published
+        """
+        started = time.perf_counter()
+        with self._config_lock:
+            modules = dict(self._modules)
+            axes = list(self._axes)
+            ai_count = len(self._analog_channels)
+            ai_channels = self._ai_channel_buf
+            ai_volts = self._ai_volt_buf
+            hooks = list(self._hooks)
+            failure_hooks = list(self._failure_hooks)
+
+        with self._queue_lock:
+            dio_queue, self._dio_queue = self._dio_queue, {}
+            axis_queue, self._axis_queue = self._axis_queue, {}
+            forced = dict(self._forced)
+
+        back = self._back
+        try:
+            self._flush_outputs(dio_queue, axis_queue, forced)
+
+            for module_no, (in_dwords, out_dwords) in modules.items():
+                back.dio_inputs[module_no] = self._read_dwords(
+                    back.dio_inputs.get(module_no),
+                    in_dwords,
+                    module_no,
+                    self._axl.read_input_dword,
+                )
+                back.dio_outputs[module_no] = self._read_dwords(
+                    back.dio_outputs.get(module_no),
+                    out_dwords,
+                    module_no,
+                    self._axl.read_output_dword,
+                )
+            for axis_no in axes:
+                back.axis_inputs[axis_no] = self._axl.read_universal_input(axis_no)
+                back.axis_outputs[axis_no] = self._axl.read_universal_output(axis_no)
+                back.axis_motion[axis_no] = self._axl.read_in_motion(axis_no)
+            if ai_count:
+                self._axl.ai_read_multi_voltage(ai_channels, ai_volts, ai_count)
+                for i in range(ai_count):
+                    back.analog_inputs[ai_channels[i]] = ai_volts[i]
+        except Exception as e:
+            self._errors += 1
+            self._requeue(dio_queue, axis_queue)
+            if self._errors == 1 or self._errors % 100 == 0:
+                logger.warning(f"Process image scan failed: {e}")
+            for failure_hook in failure_hooks:
+                try:
+                    failure_hook(e)
+                except Exception as hook_error:
+                    self._hook_errors += 1
+                    logger.warning(f"Process image failure hook failed: {hook_error}")
+            return False
+
+        self._cycles += 1
+        back.cycle = self._cycles
+        back.timestamp = time.monotonic()
+        with self._cycle_done:
+            self._front, self._back = back, self._front
+            self._cycle_done.notify_all()
+        for hook in hooks:
+            try:
+                hook(back)
+            except Exception as e:
+                self._hook_errors += 1
+                if self._hook_errors == 1 or self._hook_errors % 100 == 0:
+                    logger.warning(f"Process image cycle hook failed: {e}")
+        self._last_scan_time = time.perf_counter() - started
+        return True
+
+    @staticmethod
+    def _read_dwords(
+        buffer: Optional[np.ndarray], count: int, module_no: int, read: Any
+    ) -> np.ndarray:
+        if buffer is None or len(buffer) != count:
+            buffer = np.zeros(count, dtype=np.uint32)
+        for dword in range(count):
+            buffer[dword] = read(module_no, dword)
+        return buffer
+
+    def _flush_outputs(
+        self,
+        dio_queue: Dict[Tuple[int, int], Tuple[int, int]],
+        axis_queue: Dict[int, Tuple[int, int]],
+        forced: Dict[Tuple[int, int], Tuple[int, int]],
+    ) -> None:
+        front = self._front
+        for key in dio_queue.keys() | forced.keys():
+            module_no, dword = key
+            mask, bits = dio_queue.get(key, (0, 0))
+            forced_mask, forced_bits = forced.get(key, (0, 0))
+            mask |= forced_mask
+            bits = (bits & ~forced_mask) | forced_bits
+            current_dwords = front.dio_outputs.get(module_no)
+            if current_dwords is not None and dword < len(current_dwords):
+                current = int(current_dwords[dword])
+            else:
+                current = self._axl.read_output_dword(module_no, dword)
+            value = (current & ~mask) | (bits & mask)
+            if value != current:
+                self._axl.write_output_dword(module_no, dword, value)
+
+        for axis_no, (mask, bits) in axis_queue.items():
+            current = front.axis_outputs.get(axis_no)
+            if current is None:
+                current = self._axl.read_universal_output(axis_no)
+            value = (current & ~mask) | (bits & mask)
+            if value != current:
+                self._axl.write_universal_output(axis_no, value)
+
+    def _requeue(
+        self,
+        dio_queue: Dict[Tuple[int, int], Tuple[int, int]],
+        axis_queue: Dict[int, Tuple[int, int]],
+    ) -> None:
+        """Put writes of a failed cycle back (newer queued values win)"""
+        with self._queue_lock:
+            for queue, failed in ((self._dio_queue, dio_queue), (self._axis_queue, axis_queue)):
+                for key, (mask, bits) in failed.items():
+                    new_mask, new_bits = queue.get(key, (0, 0))
+                    queue[key] = (mask | new_mask, (bits & ~new_mask) | new_bits)
+
+    def get_stats(self) -> Dict[str, Any]:
+        """Cycle, error and overrun counters"""
+        return {
+            "cycles": self._cycles,
+            "errors": self._errors,
+            "hook_errors": self._hook_errors,
+            "overruns": self._overruns,
+            "last_scan_ms": self._last_scan_time * 1000,
+            "modules": len(self._modules),
+            "axes": len(self._axes),
+            "analog_inputs": len(self._analog_channels),
+        }
@@ -0,0 +1,416 @@
+"""
+AJINEXTEK Recipe Plan Compiler and Cache
+
+Compiles a test recipe (TestConfiguration plus the station's hardware
+assignment) into the hardware artifacts it implies:
+
+- Motion sequence nodes for AxmSeqAddNode (the full stroke order, each
+  with its velocity, acceleration, deceleration and next velocity)
+- Force sampling trigger positions for AxmTriggerOnlyAbs, stored as the
+  X/Y points, pulse counts and intervals of AxcTableSetTriggerData
+- Torque limit switch points for AxmMotSetTorqueLimitAtPos
+- Tower lamp / buzzer DIO maps per test phase
+
+Compiled plans are stored as content-addressed files named by the SHA-256 of
+the compiler inputs and loaded with mmap, so the arrays are read-only views
+into the page cache. Starting a recipe is then a hash, an mmap and an upload;
+the plan is only recompiled when the recipe (or the compiler) changes.
+
+Plan file layout (little-endian):
+    header   "<4sHH32sI"   magic, version, axis number, recipe digest, section count
+    section  "<4sQII"      tag, data offset, rows, columns   (one per section)
+    data     8-byte aligned float64 (SEQN, TRIG, TORQ) or int32 (DIOM) arrays
+"""
+
+# Standard library imports
+from ctypes import c_double, c_long, POINTER
+from dataclasses import dataclass
+import hashlib
+import json
+import mmap
+import os
+from pathlib import Path
+import struct
+import tempfile
+import threading
+from typing import Any, Dict, List, Optional, Tuple
+
+# Third-party imports
+from loguru import logger
+import numpy as np
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLConfigurationError
+from domain.value_objects.hardware_config import HardwareConfig
+from domain.value_objects.test_configuration import TestConfiguration
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    SEQ_NODE_PROFILE_FIELDS,
+)
+
+PLAN_MAGIC = b"AXPL"
+PLAN_VERSION = 3  # Bump whenever compile_plan() output changes
+PLAN_SUFFIX = ".plan"
+
+_HEADER = struct.Struct("<4sHH32sI")
+_SECTION = struct.Struct("<4sQII")
+_SECTION_DTYPES = {
+    b"SEQN": np.dtype("<f8"),  # Sequence nodes (positions per axis, vel, acc, dec, next vel)
+    b"TRIG": np.dtype("<f8"),  # Trigger points (x, y, pulses, interval)
+    b"TORQ": np.dtype("<f8"),  # Torque switch points (position, plus, minus)
+    b"DIOM": np.dtype("<i4"),  # DIO maps (phase, pin, level)
+}
+
+# Test phases with a DIO map
+PLAN_PHASE_READY = 0
+PLAN_PHASE_RUNNING = 1
+PLAN_PHASE_PASS = 2
+PLAN_PHASE_FAIL = 3
+
+# Counter table trigger output per point (AxcTableSetTriggerData)
+PLAN_TRIGGER_PULSES = 1  # One force sample per stroke position
+PLAN_TRIGGER_INTERVAL = 1000.0  # Pulse frequency (Hz) between repeated pulses
+
+
+def default_plan_directory() -> Path:
+    """Directory holding compiled plan files"""
+    project_root = Path(__file__).parent.parent.parent.parent.parent.parent.parent
+    return project_root / "cache" / "plans"
+
+
+@dataclass(frozen=True)
+class CompiledPlan:
+    """Hardware artifacts of one recipe (arrays may be read-only mmap views)"""
+
+    digest: str
+    axis_no: int
+    sequence: np.ndarray  # (nodes, 5) position, velocity, acceleration, deceleration, next vel
+    triggers: np.ndarray  # (n, 4) x, y, pulses, interval; x = axis position
+    torque_schedule: np.ndarray  # (n, 3) position, plus limit, minus limit
+    dio_map: np.ndarray  # (n, 3) phase, pin, level
+
+    def dio_outputs(self, phase: int) -> Dict[int, bool]:
+        """Output pin levels of a phase, ready for write_multiple_outputs()"""
+        rows = self.dio_map[self.dio_map[:, 0] == phase]
+        return {int(pin): bool(level) for _, pin, level in rows}
+
+
+def recipe_digest(
+    config: TestConfiguration,
+    hardware: HardwareConfig,
+    contact_torque_limit: Optional[float] = None,
+) -> str:
+    """SHA-256 over every compiler input (recipe, hardware assignment, compiler version)"""
+    dio = hardware.digital_io
+    inputs = {
+        "compiler": PLAN_VERSION,
+        "recipe": config.to_dict(),
+        "axis_no": hardware.robot.axis_id,
+        "lamps": [dio.tower_lamp_red, dio.tower_lamp_yellow, dio.tower_lamp_green, dio.beep],
+        "contact_torque_limit": contact_torque_limit,
+    }
+    canonical = json.dumps(inputs, sort_keys=True, separators=(",", ":"), default=str)
+    return hashlib.sha256(canonical.encode("utf-8")).hexdigest()
+
+
+def compile_plan(
+    config: TestConfiguration,
+    hardware: HardwareConfig,
+    contact_torque_limit: Optional[float] = None,
+    travel_torque_limit: float = 300.0,
+) -> CompiledPlan:
+    """
+    Build the hardware artifacts of a recipe
+
+    Args:
+        config: Test recipe
+        hardware: Station hardware assignment (axis, DIO pins)
+        contact_torque_limit: Torque limit (%) while in the stroke region
+            (None = no torque schedule)
+        travel_torque_limit: Torque limit (%) restored at the initial position
+    """
+    stroke = [float(p) for p in config.stroke_positions]
+    initial = float(config.initial_position)
+
+    # Every node stops (next velocity 0): force is measured at each position
+    profile = [float(config.velocity), float(config.acceleration), float(config.deceleration), 0.0]
+    nodes: List[List[float]] = []
+    for _ in range(config.repeat_count):
+        for _ in config.temperature_list:
+            nodes.extend([position, *profile] for position in stroke)
+            nodes.append([initial, *profile])
+    sequence = np.array(nodes, dtype="<f8").reshape(-1, 1 + SEQ_NODE_PROFILE_FIELDS)
+
+    # One-axis stroke: the counter table's Y input stays at its origin
+    triggers = np.array(
+        [[x, 0.0, PLAN_TRIGGER_PULSES, PLAN_TRIGGER_INTERVAL] for x in sorted(set(stroke))],
+        dtype="<f8",
+    ).reshape(-1, 4)
+
+    if contact_torque_limit is None or not stroke:
+        torque_schedule = np.zeros((0, 3), dtype="<f8")
+    else:
+        contact_start = min(stroke)
+        torque_schedule = np.array(
+            [
+                [initial, travel_torque_limit, travel_torque_limit],
+                [contact_start, contact_torque_limit, contact_torque_limit],
+            ],
+            dtype="<f8",
+        )
+
+    dio = hardware.digital_io
+    levels = {
+        PLAN_PHASE_READY: (0, 0, 1, 0),
+        PLAN_PHASE_RUNNING: (0, 1, 0, 0),
+        PLAN_PHASE_PASS: (0, 0, 1, 1),
+        PLAN_PHASE_FAIL: (1, 0, 0, 1),
+    }
+    pins = (dio.tower_lamp_red, dio.tower_lamp_yellow, dio.tower_lamp_green, dio.beep)
+    dio_map = np.array(
+        [[phase, pin, level] for phase, row in levels.items() for pin, level in zip(pins, row)],
+        dtype="<i4",
+    )
+
+    return CompiledPlan(
+        digest=recipe_digest(config, hardware, contact_torque_limit),
+        axis_no=hardware.robot.axis_id,
+        sequence=sequence,
+        triggers=triggers,
+        torque_schedule=torque_schedule,
+        dio_map=dio_map,
+    )
+
+
+# ============================================================================
+# Plan File Format
+# ============================================================================
+
+
+def write_plan_file(plan: CompiledPlan, path: Path) -> None:
+    """Write a plan atomically (temporary file + rename)"""
+    sections = [
+        (b"SEQN", plan.sequence),
+        (b"TRIG", plan.triggers),
+        (b"TORQ", plan.torque_schedule),
+        (b"DIOM", plan.dio_map),
+    ]
+    offset = _HEADER.size + _SECTION.size * len(sections)
+    table = []
+    payload = []
+    for tag, array in sections:
+        offset += -offset % 8
+        data = np.ascontiguousarray(array, dtype=_SECTION_DTYPES[tag]).tobytes()
+        rows, cols = array.shape
+        table.append(_SECTION.pack(tag, offset, rows, cols))
+        payload.append((offset, data))
+        offset += len(data)
+
+    blob = bytearray(offset)
+    digest = bytes.fromhex(plan.digest)
+    blob[: _HEADER.size] = _HEADER.pack(
+        PLAN_MAGIC, PLAN_VERSION, plan.axis_no, digest, len(sections)
+    )
+    blob[_HEADER.size : _HEADER.size + _SECTION.size * len(sections)] = b"".join(table)
+    for start, data in payload:
+        blob[start : start + len(data)] = data
+
+    path.parent.mkdir(parents=True, exist_ok=True)
+    fd, tmp_name = tempfile.mkstemp(dir=path.parent, suffix=".tmp")
+    try:
+        with os.fdopen(fd, "wb") as f:
+            f.write(blob)
+        os.replace(tmp_name, path)
+    except BaseException:
+        Path(tmp_name).unlink(missing_ok=True)
+        raise
+
+
+def map_plan_file(path: Path, expected_digest: Optional[str] = None) -> CompiledPlan:
+    """
+    Map a plan file; the returned arrays are read-only views into the mapping
+
+    An invalid file is unmapped before the error is raised, so the caller can
+    replace it (Windows refuses to replace a file that is still mapped).
+
+    Args:
+        path: Plan file
+        expected_digest: Reject a plan compiled from different inputs
+
+    Raises:
+        AXLConfigurationError: If the file is not a valid plan of this version
+    """
+    with open(path, "rb") as f:
+        try:
+            mapped = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        except ValueError as e:  # Empty file
+            raise AXLConfigurationError(f"Invalid plan file {path.name}: {e}") from e
+
+    try:
+        axis_no, digest, sections = _validate_plan(mapped, path.name, expected_digest)
+    except AXLConfigurationError:
+        mapped.close()
+        raise
+
+    # Views are created only after validation, so no export blocks close() above
+    arrays = {
+        tag: np.frombuffer(mapped, dtype=dtype, count=rows * cols, offset=offset).reshape(
+            rows, cols
+        )
+        for tag, (dtype, offset, rows, cols) in sections.items()
+    }
+    return CompiledPlan(
+        digest=digest,
+        axis_no=axis_no,
+        sequence=arrays[b"SEQN"],
+        triggers=arrays[b"TRIG"],
+        torque_schedule=arrays[b"TORQ"],
+        dio_map=arrays[b"DIOM"],
+    )
+
+
+def _validate_plan(
+    mapped: mmap.mmap, name: str, expected_digest: Optional[str]
+) -> Tuple[int, str, Dict[bytes, Tuple[np.dtype, int, int, int]]]:
+    if len(mapped) < _HEADER.size:
+        raise AXLConfigurationError(f"Invalid plan file {name}: truncated header")
+    magic, version, axis_no, digest, count = _HEADER.unpack_from(mapped, 0)
+    if magic != PLAN_MAGIC or version != PLAN_VERSION:
+        raise AXLConfigurationError(f"Invalid plan file {name}: magic {magic!r}, version {version}")
+    if expected_digest is not None and digest.hex() != expected_digest:
+        raise AXLConfigurationError(f"Invalid plan file {name}: digest mismatch")
+    if len(mapped) < _HEADER.size + count * _SECTION.size:
+        raise AXLConfigurationError(f"Invalid plan file {name}: truncated section table")
+
+    sections: Dict[bytes, Tuple[np.dtype, int, int, int]] = {}
+    for i in range(count):
+        tag, offset, rows, cols = _SECTION.unpack_from(mapped, _HEADER.size + i * _SECTION.size)
+        dtype = _SECTION_DTYPES.get(tag)
+        if dtype is None or offset + rows * cols * dtype.itemsize > len(mapped):
+            raise AXLConfigurationError(f"Invalid plan file {name}: bad section {tag!r}")
+        sections[tag] = (dtype, offset, rows, cols)
+    if set(sections) != set(_SECTION_DTYPES):
+        raise AXLConfigurationError(f"Invalid plan file {name}: missing sections")
+    return axis_no, digest.hex(), sections
+
+
+# ============================================================================
+# Cache
+# ============================================================================
+
+
+class RecipePlanCache:
+    """레시피 플랜 컴파일 캐시 (content-addressed, mmap)"""
+
+    def __init__(self, directory: Optional[Path] = None):
+        """
+        초기화
+
+        Args:
+            directory: Plan file directory (None = default_plan_directory())
+        """
+        self._directory = Path(directory) if directory is not None else default_plan_directory()
+        self._lock = threading.Lock()
+        self._mapped: Dict[str, CompiledPlan] = {}
+        self._hits = 0
+        self._compiles = 0
+
+    def path_for(self, digest: str) -> Path:
+        return self._directory / f"{digest}{PLAN_SUFFIX}"
+
+    def load(
+        self,
+        config: TestConfiguration,
+        hardware: HardwareConfig,
+        contact_torque_limit: Optional[float] = None,
+    ) -> CompiledPlan:
+        """
+        Plan of a recipe: mapped from the cache, compiled only when the hash is new
+
+        A plan file that fails validation is recompiled and replaced.
+        """
+        digest = recipe_digest(config, hardware, contact_torque_limit)
+        with self._lock:
+            plan = self._mapped.get(digest)
+            if plan is not None:
+                self._hits += 1
+                return plan
+
+            path = self.path_for(digest)
+            if path.exists():
+                try:
+                    plan = map_plan_file(path, expected_digest=digest)
+                except AXLConfigurationError as e:
+                    logger.warning(f"Discarding plan file: {e}")  # Already unmapped
+                else:
+                    self._hits += 1
+                    self._mapped[digest] = plan
+                    return plan
+
+            write_plan_file(compile_plan(config, hardware, contact_torque_limit), path)
+            plan = map_plan_file(path)
+            self._compiles += 1
+            self._mapped[digest] = plan
+            logger.info(f"Recipe plan compiled: {path.name}")
+            return plan
+
+    def get_stats(self) -> Dict[str, int]:
+        with self._lock:
+            return {"hits": self._hits, "compiles": self._compiles, "mapped": len(self._mapped)}
+
+
+# ============================================================================
+# Upload
+# ============================================================================
+
+
+def _double_ptr(array: np.ndarray) -> Tuple[Any, np.ndarray]:
+    """c_double pointer to a float64 array (the array keeps the memory alive)"""
+    contiguous = np.ascontiguousarray(array, dtype="<f8")
+    return contiguous.ctypes.data_as(POINTER(c_double)), contiguous
+
+
+def upload_plan(
+    axl: Any,
+    plan: CompiledPlan,
+    seq_map_no: int = 0,
+    counter_module: Optional[int] = None,
+    counter_table: int = 0,
+) -> Dict[str, int]:
+    """
+    Load a plan's motion artifacts into the controller
+
+    Args:
+        axl: AXLWrapper instance
+        plan: Compiled plan
+        seq_map_no: Sequence map receiving the stroke nodes
+        counter_module: Counter module receiving the trigger table (None = axis triggers only)
+        counter_table: Trigger table of the counter module
+
+    Returns:
+        Number of items uploaded per artifact
+    """
+    sequence_ptr, sequence = _double_ptr(plan.sequence)
+    axl.seq_set_axis_map(seq_map_no, [plan.axis_no])
+    axes = sequence.shape[1] - SEQ_NODE_PROFILE_FIELDS
+    axl.seq_upload_nodes(seq_map_no, sequence_ptr, sequence.shape[0], axes)
+
+    triggers = plan.triggers
+    if len(triggers):
+        position_ptr, positions = _double_ptr(triggers[:, 0])
+        axl.trigger_only_abs(plan.axis_no, position_ptr, len(positions))
+        if counter_module is not None:
+            point_ptr, points = _double_ptr(triggers[:, :2])
+            pulse_counts = (c_long * len(triggers))(*(int(n) for n in triggers[:, 2]))
+            interval_ptr, intervals = _double_ptr(triggers[:, 3])
+            axl.counter_set_trigger_table(
+                counter_module, counter_table, point_ptr, pulse_counts, interval_ptr, len(triggers)
+            )
+
+    for position, plus_limit, minus_limit in plan.torque_schedule:
+        axl.set_torque_limit_at_pos(plan.axis_no, plus_limit, minus_limit, position)
+
+    return {
+        "sequence_nodes": int(sequence.shape[0]),
+        "triggers": int(len(triggers)),
+        "torque_points": int(len(plan.torque_schedule)),
+    }
@@ -0,0 +1,392 @@
+"""
+AJINEXTEK Multi-Rate Sampling Scheduler
+
+One thread runs every periodic AXL task - status snapshots, DIO scans,
+alarm and health checks, odometry - at its own rate instead of one loop or
+thread per task. Tasks sit in an earliest-deadline-first queue keyed by
+their next due tick; the thread sleeps until the earliest deadline, so N
+tasks cost one wake-up per distinct due tick rather than N.
+
+Periods are rounded to the scheduler tick and the first run of a task is
+aligned to a multiple of its period, so harmonic rates (10 ms, 50 ms,
+100 ms ...) fall due on the same ticks. Tasks declare the driver reads they
+need as (method, *args) tuples; all tasks due on a tick share one sweep
+that issues each distinct read once, and get the values through Sweep.get().
+
+A task bound to an axis slows down to its idle period (by default
+SCHEDULER_IDLE_SLOWDOWN times its period) once the axis has not been in
+motion for SCHEDULER_IDLE_AFTER. Motion is detected from the in-motion read
+added to each sweep of an axis task, or signalled with notify_motion() when
+a move is started so sampling returns to the full rate at once.
+
+Existing cycle work can run as a task with no declared reads, e.g.
+add_task("dio", lambda sweep: scanner.scan_once(), 0.01).
+"""
+
+# Standard library imports
+from dataclasses import dataclass
+import heapq
+import itertools
+import math
+import threading
+import time
+from typing import Any, Callable, Dict, Iterable, List, Optional, Tuple
+
+# Third-party imports
+from loguru import logger
+
+# Local application imports
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    SCHEDULER_IDLE_AFTER,
+    SCHEDULER_IDLE_SLOWDOWN,
+    SCHEDULER_TICK,
+)
+
+Read = Tuple[Any, ...]  # (wrapper method name, *args)
+
+
+class Sweep:
+    """한 틱에서 병합 실행된 드라이버 읽기 결과"""
+
+    def __init__(self, tick: int, now: float, values: Dict[Read, Any]):
+        self.tick = tick
+        self.now = now
+        self._values = values
+
+    def get(self, method: str, *args: Any) -> Any:
+        """Value of a declared read; re-raises the error if the read failed"""
+        value = self._values[(method, *args)]
+        if isinstance(value, Exception):
+            raise value
+        return value
+
+
+@dataclass
+class _Task:
+    name: str
+    callback: Callable[[Sweep], None]
+    period_ticks: int
+    idle_ticks: int
+    reads: Tuple[Read, ...]
+    axis_no: Optional[int]
+    due_tick: int = 0
+    version: int = 0
+    idle: bool = False
+    runs: int = 0
+    errors: int = 0
+
+
+class SamplingScheduler:
+    """단일 스레드 다중 주기 AXL 샘플링 스케줄러 (EDF)"""
+
+    def __init__(
+        self,
+        axl: Optional[Any] = None,
+        tick: float = SCHEDULER_TICK,
+        idle_after: float = SCHEDULER_IDLE_AFTER,
+    ):
+        """
+        초기화
+
+        Args:
+            axl: AXLWrapper instance (defaults to the process-wide singleton)
+            tick: Time quantum in seconds; periods are rounded to whole ticks
+            idle_after: Seconds without motion before an axis counts as idle
+        """
+        if axl is None:
+            # Local application imports
+            from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import (
+                AXLWrapper,
+            )
+
+            axl = AXLWrapper.get_instance()
+
+        self._axl = axl
+        self._tick = tick
+        self._idle_after = idle_after
+        self._origin = time.monotonic()
+
+        self._lock = threading.RLock()
+        self._tasks: Dict[str, _Task] = {}
+        self._queue: List[Tuple[int, int, int, _Task]] = []  # (due tick, seq, version, task)
+        self._seq = itertools.count()
+        self._last_motion: Dict[int, float] = {}
+
+        self._wakeups = 0
+        self._sweeps = 0
+        self._reads_requested = 0
+        self._reads_issued = 0
+        self._late_ticks = 0
+
+        self._stopping = False
+        self._wakeup = threading.Event()
+        self._thread: Optional[threading.Thread] = None
+
+    @property
+    def origin(self) -> float:
+        """Monotonic time of tick 0"""
+        return self._origin
+
+    # ========================================================================
+    # Tasks
+    # ========================================================================
+
+    def add_task(
+        self,
+        name: str,
+        callback: Callable[[Sweep], None],
+        period: float,
+        reads: Iterable[Read] = (),
+        axis_no: Optional[int] = None,
+        idle_period: Optional[float] = None,
+    ) -> None:
+        """
+        Schedule a periodic task (replaces a task of the same name)
+
+        Args:
+            name: Task name
+            callback: Called on the scheduler thread with the tick's Sweep
+            period: Sampling period in seconds (rounded to whole ticks)
+            reads: Driver reads the callback needs, as (method, *args) tuples
+            axis_no: Axis whose idle state slows the task down
+            idle_period: Period while the axis is idle
+                (default SCHEDULER_IDLE_SLOWDOWN * period; only with axis_no)
+        """
+        period_ticks = self._to_ticks(period)
+        if idle_period is None:
+            idle_ticks = period_ticks * SCHEDULER_IDLE_SLOWDOWN
+        else:
+            idle_ticks = max(self._to_ticks(idle_period), period_ticks)
+        reads = tuple(tuple(r) for r in reads)
+        if axis_no is not None:
+            reads += (("read_in_motion", axis_no),)
+
+        with self._lock:
+            self._remove(name)
+            now = time.monotonic()
+            current = self._tick_at(now)
+            task = _Task(name, callback, period_ticks, idle_ticks, reads, axis_no)
+            if axis_no is not None:
+                self._last_motion.setdefault(axis_no, now)
+            self._push(task, -(-current // period_ticks) * period_ticks)
+        self._wakeup.set()
+
+    def remove_task(self, name: str) -> bool:
+        with self._lock:
+            return self._remove(name)
+
+    def notify_motion(self, axis_no: int) -> None:
+        """A move was started on an axis: sample its tasks at the full rate from now on"""
+        with self._lock:
+            now = time.monotonic()
+            self._last_motion[axis_no] = now
+            current = self._tick_at(now)
+            for task in self._tasks.values():
+                if task.axis_no == axis_no and task.idle:
+                    task.idle = False
+                    self._push(task, min(task.due_tick, current + 1))
+        self._wakeup.set()
+
+    def _remove(self, name: str) -> bool:
+        task = self._tasks.pop(name, None)
+        if task is None:
+            return False
+        task.version += 1  # Invalidates its queue entry
+        return True
+
+    def _push(self, task: _Task, due_tick: int) -> None:
+        task.version += 1
+        task.due_tick = due_tick
+        self._tasks[task.name] = task
+        heapq.heappush(self._queue, (due_tick, next(self._seq), task.version, task))
+
+    def _to_ticks(self, seconds: float) -> int:
+        if seconds <= 0:
+            raise ValueError("Task period must be positive")
+        return max(1, round(seconds / self._tick))
+
+    def _tick_at(self, now: float) -> int:
+        return math.floor((now - self._origin) / self._tick + 1e-9)
+
+    # ========================================================================
+    # Scheduling
+    # ========================================================================
+
+    def start(self) -> None:
+        """Start the scheduler thread"""
+        if self._thread is not None and self._thread.is_alive():
+            return
+        self._stopping = False
+        self._wakeup.clear()
+        self._thread = threading.Thread(target=self._run, name="AXL-Scheduler", daemon=True)
+        self._thread.start()
+        logger.info(f"Sampling scheduler started (tick: {self._tick * 1000:.1f} ms)")
+
+    def stop(self) -> None:
+        """Stop the scheduler thread"""
+        self._stopping = True
+        self._wakeup.set()
+        if self._thread is not None:
+            self._thread.join(timeout=2.0)
+            self._thread = None
+        logger.info("Sampling scheduler stopped")
+
+    @property
+    def is_running(self) -> bool:
+        return self._thread is not None and self._thread.is_alive()
+
+    def _run(self) -> None:
+        while not self._stopping:
+            self._wakeup.clear()
+            self.run_due()
+            with self._lock:
+                self._discard_stale()
+                due = self._queue[0][0] if self._queue else None
+            delay = None if due is None else self._origin + due * self._tick - time.monotonic()
+            if delay is None or delay > 0:
+                self._wakeup.wait(delay)
+
+    def _discard_stale(self) -> None:
+        while self._queue and self._queue[0][2] != self._queue[0][3].version:
+            heapq.heappop(self._queue)
+
+    def run_due(self, now: Optional[float] = None) -> int:
+        """
+        Run every task due at the current tick in one coalesced sweep
+
+        Returns:
+            Number of tasks run
+        """
+        if now is None:
+            now = time.monotonic()
+        current = self._tick_at(now)
+
+        with self._lock:
+            due: List[_Task] = []
+            while self._queue and self._queue[0][0] <= current:
+                due_tick, _, version, task = heapq.heappop(self._queue)
+                if version != task.version:
+                    continue
+                if due_tick < current:
+                    self._late_ticks += 1
+                due.append(task)
+            if not due:
+                return 0
+            self._wakeups += 1
+
+            requested = [read for task in due for read in task.reads]
+            unique = list(dict.fromkeys(requested))
+            self._reads_requested += len(requested)
+            self._reads_issued += len(unique)
+            self._sweeps += 1
+
+        values: Dict[Read, Any] = {}
+        for read in unique:
+            try:
+                values[read] = getattr(self._axl, read[0])(*read[1:])
+            except Exception as e:
+                values[read] = e
+        sweep = Sweep(current, now, values)
+
+        for axis in {task.axis_no for task in due if task.axis_no is not None}:
+            if values.get(("read_in_motion", axis)) is True:
+                self._last_motion[axis] = now
+
+        for task in due:
+            task.runs += 1
+            try:
+                task.callback(sweep)
+            except Exception as e:
+                task.errors += 1
+                if task.errors == 1 or task.errors % 100 == 0:
+                    logger.warning(f"Scheduler task {task.name} failed ({task.errors}x): {e}")
+
+        with self._lock:
+            for task in due:
+                if self._tasks.get(task.name) is not task:
+                    continue  # Removed or replaced by its callback
+                if task.axis_no is not None:
+                    last_motion = self._last_motion.get(task.axis_no, now)
+                    task.idle = now - last_motion >= self._idle_after
+                period = task.idle_ticks if task.idle else task.period_ticks
+                next_tick = task.due_tick + period
+                if next_tick <= current:
+                    # Overrun - resynchronize instead of bursting
+                    next_tick = current + period
+                self._push(task, next_tick)
+        return len(due)
+
+    # ========================================================================
+    # Status
+    # ========================================================================
+
+    def get_stats(self) -> Dict[str, Any]:
+        """Wake-up, sweep and read counters plus per-task runs, errors and rate"""
+        with self._lock:
+            return {
+                "wakeups": self._wakeups,
+                "sweeps": self._sweeps,
+                "reads_requested": self._reads_requested,
+                "reads_issued": self._reads_issued,
+                "late_ticks": self._late_ticks,
+                "tasks": {
+                    task.name: {
+                        "runs": task.runs,
+                        "errors": task.errors,
+                        "idle": task.idle,
+                        "period_ms": (task.idle_ticks if task.idle else task.period_ticks)
+                        * self._tick
+                        * 1000,
+                    }
+                    for task in self._tasks.values()
+                },
+            }
+
+
+class AxisOdometer:
+    """축 누적 이동 거리/이동 횟수 샘플링 태스크"""
+
+    def __init__(
+        self,
+        axis_no: int,
+        store: Optional[Any] = None,
+        persist_interval: float = 60.0,
+        deadband: float = 0.0,
+    ):
+        """
+        초기화
+
+        Args:
+            axis_no: Axis to track
+            store: BoardFlashStore to resume from and persist to (optional)
+            persist_interval: Minimum seconds between persisted updates
+            deadband: Position changes at or below this are treated as noise (unit)
+        """
+        self.axis_no = axis_no
+        self.key = f"odometer.{axis_no}"
+        self._store = store
+        self._persist_interval = persist_interval
+        self._deadband = deadband
+        self._position: Optional[float] = None
+        self._moving = False
+        self._last_persist = 0.0
+        saved = store.get_value(self.key) if store is not None else None
+        self.distance, self.moves = saved if saved else (0.0, 0)
+
+    @property
+    def reads(self) -> Tuple[Read, ...]:
+        return (("get_act_pos", self.axis_no),)
+
+    def __call__(self, sweep: Sweep) -> None:
+        position = sweep.get("get_act_pos", self.axis_no)
+        moved = self._position is not None and abs(position - self._position) > self._deadband
+        if moved:
+            self.distance += abs(position - self._position)
+            if not self._moving:
+                self.moves += 1
+        self._moving = moved
+        if self._position is None or moved:
+            self._position = position
+        if self._store is not None and sweep.now - self._last_persist >= self._persist_interval:
+            self._store.put_value(self.key, [round(self.distance, 3), self.moves])
+            self._last_persist = sweep.now
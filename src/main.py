@@ -530,6 +530,23 @@ class EOLTesterGUIApplication:
             logger.error(f"Failed to initialize database during startup: {e}", exc_info=True)
             logger.warning("Database will be auto-initialized when first needed (e.g., when opening Search tab)")
 
+    def _start_axl_bringup(self) -> None:
+        """Start AXL bring-up in the background as soon as the robot configuration is known"""
+        try:
+            robot_config = self.container.config.hardware.robot() or {}
+            if robot_config.get("model") != "ajinextek":
+                return
+
+            # Local application imports
+            from infrastructure.implementation.hardware.robot.ajinextek.axl_bringup import (
+                AXLBringup,
+            )
+
+            AXLBringup.get_instance().start(irq_no=robot_config.get("irq_no", 7))
+        except Exception as e:
+            # Robot connect() starts the bring-up itself if this early start fails
+            logger.warning(f"Could not start AXL background bring-up: {e}")
+
     def _setup_hardware_services_with_progress(self) -> None:
         """Setup hardware services with progress updates for splash screen"""
         logger.info("🔧 Hardware services setup started")
@@ -754,6 +771,7 @@ class EOLTesterGUIApplication:
 
             self.update_splash_progress(1)  # Initializing dependency injection...
             self.setup_container()
+            self._start_axl_bringup()
 
             self.update_splash_progress(2)  # Creating hardware factory...
             # Give user visual feedback that hardware factory is being created
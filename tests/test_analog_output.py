@@ -0,0 +1,118 @@
+"""
+Analog Output Ramp Tests
+
+Tests for the batched, slew-rate limited analog output service, run against
+the simulated AXL library with the ramp ticked by hand.
+"""
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from infrastructure.implementation.hardware.robot.ajinextek.analog_output import (
+    AnalogOutputRamp,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+    LatencyModel,
+    SimulatedAXL,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+
+
+@pytest.fixture
+def axl(monkeypatch):
+    """Fixture providing an opened AXLWrapper over a zero-latency simulator"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    wrapper = AXLWrapper.get_instance()
+    wrapper.dll = SimulatedAXL(latency=LatencyModel.zero())
+    wrapper.open(7)
+    yield wrapper
+    AXLWrapper.reset_for_testing()
+
+
+@pytest.fixture
+def ramp(axl):
+    """Fixture providing a ramp service with channels 0-2 configured at 10 V/s"""
+    service = AnalogOutputRamp(axl, tick_period=0.01, readback_every=5)
+    for channel in range(3):
+        service.configure_channel(channel, slew_rate=10.0)
+    axl.dll.reset_counters()
+    return service
+
+
+class TestAnalogOutputRamp:
+    """Test suite for the analog output ramp service"""
+
+    def test_slew_rate_limits_each_tick(self, axl, ramp):
+        """A target is approached by at most slew_rate * dt per tick"""
+        ramp.set_target(0, 1.0)
+
+        ramp.tick_once(0.01)
+        assert axl.dll.get_analog_output(0) == pytest.approx(0.1)
+
+        for _ in range(20):
+            ramp.tick_once(0.01)
+        assert axl.dll.get_analog_output(0) == pytest.approx(1.0)
+        assert ramp.wait_settled(timeout=0)
+
+    def test_one_driver_call_per_tick(self, axl, ramp):
+        """All moving channels are written with a single multi-channel call"""
+        ramp.set_targets({0: 1.0, 1: -1.0, 2: 0.5})
+
+        written = ramp.tick_once(0.01)
+
+        assert written == 3
+        assert axl.dll.call_counts == {"AxaoWriteMultiVoltage": 1}
+        assert axl.dll.get_analog_output(1) == pytest.approx(-0.1)
+
+    def test_idle_tick_makes_no_write(self, axl, ramp):
+        """Settled channels cost no driver calls"""
+        assert ramp.tick_once(0.01) == 0
+        assert "AxaoWriteMultiVoltage" not in axl.dll.call_counts
+
+    def test_ramp_to_arrives_together(self, axl, ramp):
+        """ramp_to scales per-channel rates so every channel finishes at once"""
+        ramp.ramp_to({0: 0.2, 1: 0.6}, duration=0.1)
+
+        for _ in range(9):
+            ramp.tick_once(0.01)
+        outputs = ramp.get_outputs()
+        assert outputs[0]["current"] < 0.2
+        assert outputs[1]["current"] < 0.6
+
+        ramp.tick_once(0.01)
+        assert axl.dll.get_analog_output(0) == pytest.approx(0.2)
+        assert axl.dll.get_analog_output(1) == pytest.approx(0.6)
+
+    def test_periodic_readback(self, axl, ramp):
+        """All channels are read back with one call every readback_every ticks"""
+        ramp.write_now({2: 3.0})
+        for _ in range(5):
+            ramp.tick_once(0.01)
+
+        assert axl.dll.call_counts["AxaoReadMultiVoltage"] == 1
+        assert ramp.get_outputs()[2]["readback"] == pytest.approx(3.0)
+        assert ramp.get_stats()["readbacks"] == 1
+
+    def test_targets_are_clamped_to_channel_range(self, axl):
+        """Targets outside the configured range are clamped"""
+        service = AnalogOutputRamp(axl)
+        service.configure_channel(0, min_volt=0.0, max_volt=5.0)
+
+        service.set_target(0, 8.0)
+        service.tick_once()
+
+        assert axl.dll.get_analog_output(0) == pytest.approx(5.0)
+
+    def test_timer_thread_ramps_to_target(self, axl):
+        """The background timer drives channels to their targets"""
+        service = AnalogOutputRamp(axl, tick_period=0.002)
+        service.configure_channel(0, slew_rate=100.0)
+        service.start()
+        try:
+            service.set_target(0, 1.0)
+            assert service.wait_settled(timeout=2.0)
+        finally:
+            service.stop()
+        assert axl.dll.get_analog_output(0) == pytest.approx(1.0)
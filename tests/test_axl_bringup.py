@@ -0,0 +1,157 @@
+"""
+AXL Bring-up Tests
+
+Tests for AXLBringup stages, readiness future and AxlOpen retry policy.
+"""
+
+# Standard library imports
+from pathlib import Path
+import threading
+from typing import List
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLConnectionError, AXLError
+from infrastructure.implementation.hardware.robot.ajinextek.axl_bringup import (
+    STAGE_OPEN,
+    STAGE_PARAMETERS,
+    STAGE_SERVO_READY,
+    STAGE_TOPOLOGY,
+    AXLBringup,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.error_codes import (
+    AXT_RT_NETWORK_ERROR,
+    AXT_RT_NOT_SUPPORT_VERSION,
+    AXT_RT_SUCCESS,
+)
+
+
+class FakeAXL:
+    """AXLWrapper stand-in with scripted AxlOpen results"""
+
+    def __init__(self, open_results: List[int], axis_count: int = 2) -> None:
+        self._connection_lock = threading.RLock()
+        self._open_results = list(open_results)
+        self._opened = False
+        self.axis_count = axis_count
+        self.open_calls = 0
+        self.loaded_files: List[str] = []
+
+    def is_opened(self) -> bool:
+        return self._opened
+
+    def open(self, irq_no: int) -> int:
+        self.open_calls += 1
+        result = self._open_results.pop(0) if self._open_results else AXT_RT_SUCCESS
+        self._opened = result == AXT_RT_SUCCESS
+        return result
+
+    def get_board_count(self) -> int:
+        return 1
+
+    def get_axis_count(self) -> int:
+        return self.axis_count
+
+    def get_lib_version(self) -> str:
+        return "Fake 1.0"
+
+    def load_para_all(self, file_path: str) -> int:
+        self.loaded_files.append(file_path)
+        return AXT_RT_SUCCESS
+
+    def read_servo_alarm(self, axis_no: int) -> bool:
+        return axis_no == 1
+
+
+@pytest.fixture
+def parameter_file(tmp_path: Path) -> Path:
+    """Fixture providing an existing motion parameter file"""
+    path = tmp_path / "robot_motion_settings.mot"
+    path.write_text("")
+    return path
+
+
+class TestAXLBringup:
+    """Test suite for background bring-up"""
+
+    def test_all_stages_complete(self, parameter_file: Path):
+        """Readiness future carries topology, alarms and per-stage timings"""
+        axl = FakeAXL([])
+        report = AXLBringup(axl).start(7, parameter_file).result(timeout=5)
+
+        assert report.axis_count == 2
+        assert report.alarmed_axes == [1]
+        assert axl.loaded_files == [str(parameter_file)]
+        assert set(report.timings) == {
+            STAGE_OPEN,
+            STAGE_TOPOLOGY,
+            STAGE_PARAMETERS,
+            STAGE_SERVO_READY,
+        }
+
+    def test_transient_open_error_is_retried(self, parameter_file: Path):
+        """Network errors back off and retry until AxlOpen succeeds"""
+        axl = FakeAXL([AXT_RT_NETWORK_ERROR, AXT_RT_NETWORK_ERROR])
+        report = AXLBringup(axl).start(7, parameter_file).result(timeout=5)
+
+        assert report.open_attempts == 3
+        assert report.open_results == [AXT_RT_NETWORK_ERROR, AXT_RT_NETWORK_ERROR, AXT_RT_SUCCESS]
+
+    def test_permanent_open_error_fails_fast(self, parameter_file: Path):
+        """Unsupported hardware is not retried"""
+        axl = FakeAXL([AXT_RT_NOT_SUPPORT_VERSION])
+        future = AXLBringup(axl).start(7, parameter_file)
+
+        with pytest.raises(AXLConnectionError):
+            future.result(timeout=5)
+        assert axl.open_calls == 1
+
+    def test_missing_parameter_file_fails_after_open(self, tmp_path: Path):
+        """Open future resolves even when a later stage fails"""
+        bringup = AXLBringup(FakeAXL([]))
+        ready = bringup.start(7, tmp_path / "missing.mot")
+
+        with pytest.raises(AXLError):
+            ready.result(timeout=5)
+        assert bringup.opened_future(7) is not None
+        assert STAGE_OPEN in bringup.get_timings()
+
+    def test_failed_bringup_is_restarted(self, parameter_file: Path):
+        """A new start() after a failure runs the bring-up again"""
+        axl = FakeAXL([AXT_RT_NOT_SUPPORT_VERSION])
+        bringup = AXLBringup(axl)
+        with pytest.raises(AXLConnectionError):
+            bringup.start(7, parameter_file).result(timeout=5)
+
+        report = bringup.start(7, parameter_file).result(timeout=5)
+
+        assert report.open_results == [AXT_RT_SUCCESS]
+
+    def test_invalidate_reloads_parameters_while_library_stays_open(self, parameter_file: Path):
+        """After invalidate() the library stays open but the parameter stage runs again"""
+        axl = FakeAXL([])
+        bringup = AXLBringup(axl)
+        bringup.start(7, parameter_file).result(timeout=5)
+        assert bringup.start(7, parameter_file).result(timeout=5).open_attempts == 1
+
+        bringup.invalidate()
+        report = bringup.start(7, parameter_file).result(timeout=5)
+
+        assert axl.open_calls == 1
+        assert report.parameter_file == str(parameter_file)
+        assert axl.loaded_files == [str(parameter_file)] * 2
+
+    def test_connection_lock_is_free_during_backoff(self, parameter_file: Path):
+        """Other callers can take the connection lock while AxlOpen backs off"""
+        axl = FakeAXL([AXT_RT_NETWORK_ERROR] * 3)  # Backs off for well over a second
+        ready = AXLBringup(axl).start(7, parameter_file)
+
+        acquired = axl._connection_lock.acquire(timeout=0.5)
+        if acquired:
+            axl._connection_lock.release()
+        ready.result(timeout=5)
+
+        assert acquired
+        assert axl.open_calls == 4
@@ -0,0 +1,112 @@
+"""
+AXL Axis Configuration Snapshot Tests
+
+Tests for capturing, serializing, restoring and diffing axis configuration
+snapshots against the simulated AXL library.
+"""
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLConfigurationError
+from infrastructure.implementation.hardware.robot.ajinextek.axl_config_snapshot import (
+    AxisConfigSnapshot,
+    capture_snapshot,
+    diff_snapshots,
+    restore_snapshot,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_parameter_cache import (
+    PARAM_BACKLASH,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+    LatencyModel,
+    SimulatedAXL,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+
+
+@pytest.fixture
+def axl(monkeypatch):
+    """Fixture providing an opened AXLWrapper over a zero-latency simulator"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    wrapper = AXLWrapper.get_instance()
+    wrapper.dll = SimulatedAXL(axis_count=2, latency=LatencyModel.zero())
+    wrapper.open(7)
+    yield wrapper
+    AXLWrapper.reset_for_testing()
+
+
+class TestAxisConfigSnapshot:
+    """Test suite for axis configuration snapshots"""
+
+    def test_blob_round_trip(self, axl):
+        """A blob parses back to an equal snapshot with the same hash"""
+        snapshot = capture_snapshot(axl)
+        blob = snapshot.to_bytes()
+        parsed = AxisConfigSnapshot.from_bytes(blob)
+
+        assert set(snapshot.axes) == {0, 1}
+        assert parsed.axes == snapshot.axes
+        assert parsed.hash == snapshot.hash
+        assert len(blob) < 256 * len(snapshot.axes)
+
+    def test_hash_changes_with_configuration(self, axl):
+        """Changing one parameter changes the hash"""
+        before = capture_snapshot(axl)
+        axl.set_max_vel(1, 12345.0)
+
+        assert capture_snapshot(axl).hash != before.hash
+
+    def test_diff_is_symbolic(self, axl):
+        """Diff names axis, parameter and field"""
+        before = capture_snapshot(axl)
+        axl.set_limit_config(0, 1, 0, 0)
+        axl.set_torque_limit(1, 150.0, 120.0)
+
+        differences = diff_snapshots(before.to_bytes(), capture_snapshot(axl).to_bytes())
+
+        assert [(d.axis, d.parameter, d.field_name) for d in differences] == [
+            (0, "limit", "pos_level"),
+            (1, "torque_limit", "plus"),
+            (1, "torque_limit", "minus"),
+        ]
+        assert str(differences[0]) == "axis 0 limit.pos_level: 0 -> 1"
+
+    def test_restore_writes_only_differences(self, axl):
+        """Restoring issues one setter per changed parameter and none when in sync"""
+        blob = capture_snapshot(axl).to_bytes()
+        axl.set_max_vel(0, 5000.0)
+        axl.home_set_vel(1, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0)
+
+        assert restore_snapshot(axl, blob) == 2
+        assert restore_snapshot(axl, blob) == 0
+        assert capture_snapshot(axl, refresh=True).to_bytes() == blob
+
+    def test_rejects_foreign_blob(self):
+        """Blobs with a wrong magic or trailing bytes are rejected"""
+        blob = AxisConfigSnapshot({0: {}}).to_bytes()
+
+        with pytest.raises(AXLConfigurationError):
+            AxisConfigSnapshot.from_bytes(b"XXXX" + blob[4:])
+        with pytest.raises(AXLConfigurationError):
+            AxisConfigSnapshot.from_bytes(blob + b"\0")
+
+    def test_unsupported_getters_are_not_retried(self, axl, monkeypatch):
+        """A getter that failed once is skipped by later captures sharing the set"""
+        calls = []
+
+        def missing_backlash(axis_no):
+            calls.append(axis_no)
+            raise AttributeError("AxmCompensationGetBacklash")
+
+        monkeypatch.setattr(axl, "get_backlash", missing_backlash)
+        unsupported = set()
+
+        first = capture_snapshot(axl, unsupported=unsupported)
+        second = capture_snapshot(axl, unsupported=unsupported)
+
+        assert calls == [0, 1]
+        assert unsupported == {(0, PARAM_BACKLASH), (1, PARAM_BACKLASH)}
+        assert first.to_bytes() == second.to_bytes()
@@ -0,0 +1,97 @@
+"""
+AXL Motion Parameter Cache Tests
+
+Tests for the write-through parameter cache in AXLWrapper, run against the
+simulated AXL library.
+"""
+
+# Standard library imports
+from pathlib import Path
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+    LatencyModel,
+    SimulatedAXL,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+from infrastructure.implementation.hardware.robot.ajinextek.constants import POS_ABS, POS_REL
+from infrastructure.implementation.hardware.robot.ajinextek.error_codes import AXT_RT_SUCCESS
+
+
+@pytest.fixture
+def axl(monkeypatch):
+    """Fixture providing an opened AXLWrapper over a zero-latency simulator"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    wrapper = AXLWrapper.get_instance()
+    wrapper.dll = SimulatedAXL(latency=LatencyModel.zero())
+    wrapper.open(7)
+    wrapper.dll.reset_counters()
+    yield wrapper
+    AXLWrapper.reset_for_testing()
+
+
+class TestAXLParameterCache:
+    """Test suite for the motion parameter cache"""
+
+    def test_unchanged_setter_is_suppressed(self, axl):
+        """Writing the same value twice reaches the driver once"""
+        assert axl.set_abs_rel_mode(0, POS_ABS) == AXT_RT_SUCCESS
+        assert axl.set_abs_rel_mode(0, POS_ABS) == AXT_RT_SUCCESS
+        assert axl.set_abs_rel_mode(0, POS_REL) == AXT_RT_SUCCESS
+
+        assert axl.dll.call_counts["AxmMotSetAbsRelMode"] == 2
+        assert axl.get_parameter_cache_stats()["suppressed_writes"] == 1
+
+    def test_getter_served_from_cache(self, axl):
+        """Getters read the driver once and return written values afterwards"""
+        first = axl.get_max_vel(0)
+        assert axl.get_max_vel(0) == first
+        axl.set_max_vel(0, 50000.0)
+
+        assert axl.get_max_vel(0) == 50000.0
+        assert axl.dll.call_counts["AxmMotGetMaxVel"] == 1
+        stats = axl.get_parameter_cache_stats()
+        assert stats["hits"] == 2
+        assert stats["misses"] == 2  # First read, changed write
+
+    def test_parameter_load_invalidates(self, axl, tmp_path: Path):
+        """Values loaded from a .mot file replace cached ones"""
+        axl.set_max_vel(0, 50000.0)
+        path = tmp_path / "params.mot"
+        axl.dll.AxmMotSaveParaAll(str(path).encode("utf-8"))
+        axl.set_max_vel(0, 60000.0)
+
+        assert axl.load_para_all(str(path)) == AXT_RT_SUCCESS
+        assert axl.get_max_vel(0) == 50000.0
+        assert axl.set_max_vel(0, 60000.0) == AXT_RT_SUCCESS
+        assert axl.dll.call_counts["AxmMotSetMaxVel"] == 3
+
+    def test_reopen_invalidates(self, axl):
+        """A library reopen forces the next setter to reach the driver"""
+        axl.set_limit_config(0, 1, 1, 0)
+        axl.close()
+        axl.open(7)
+        axl.set_limit_config(0, 1, 1, 0)
+
+        assert axl.dll.call_counts["AxmSignalSetLimit"] == 2
+        assert axl.get_limit_config(0) == (1, 1, 0)
+
+    def test_failed_setter_is_not_cached(self, axl):
+        """Setter errors leave the entry uncached"""
+        assert axl.set_accel_unit(99, 1) != AXT_RT_SUCCESS
+        assert axl.set_accel_unit(99, 1) != AXT_RT_SUCCESS
+
+        assert axl.dll.call_counts["AxmMotSetAccelUnit"] == 2
+
+    def test_home_parameters_use_header_signature(self, axl):
+        """Homing setters pass every AXM.h argument and round-trip through getters"""
+        axl.home_set_method(0, 0, 4, 0, 1000.0, 0.0)
+        axl.home_set_vel(0, 10000.0, 2000.0, 1000.0, 500.0, 40000.0, 20000.0)
+        axl.invalidate_parameter_cache(0)
+
+        assert axl.home_get_method(0) == (0, 4, 0, 1000.0, 0.0)
+        assert axl.home_get_vel(0) == (10000.0, 2000.0, 1000.0, 500.0, 40000.0, 20000.0)
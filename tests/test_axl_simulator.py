@@ -0,0 +1,116 @@
+"""
+AXL Simulator ABI Tests
+
+Checks the ctypes bindings of AXLWrapper and the entry points of the
+simulated AXL library against the vendor C headers, so a binding with the
+wrong argument count (stack corruption under stdcall) cannot pass the
+simulator-backed tests.
+"""
+
+# Standard library imports
+import inspect
+from pathlib import Path
+import re
+from types import SimpleNamespace
+from typing import Dict, Iterable
+
+# Third-party imports
+from loguru import logger
+import pytest
+
+# Local application imports
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import SimulatedAXL
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+
+HEADER_DIR = (
+    Path(__file__).parent.parent / "src" / "driver" / "ajinextek" / "AXL(Library)" / "C, C++"
+)
+
+
+class BindingRecorder:
+    """Stands in for the DLL and keeps every argtypes/restype the wrapper assigns"""
+
+    def __init__(self, missing: Iterable[str] = ()):
+        self.functions: Dict[str, SimpleNamespace] = {}
+        self._missing = set(missing)  # Exports an older DLL lacks
+
+    def __getattr__(self, name: str) -> SimpleNamespace:
+        if name.startswith("_") or name in self._missing:
+            raise AttributeError(name)
+        return self.functions.setdefault(name, SimpleNamespace())
+
+
+def _header_arity() -> Dict[str, int]:
+    """Parameter count of every __stdcall declaration in the C headers"""
+    arity = {}
+    for header in HEADER_DIR.glob("*.h"):
+        text = re.sub(r"//[^\n]*", "", header.read_text(encoding="cp949", errors="replace"))
+        for match in re.finditer(r"__stdcall\s+(\w+)\s*\(([^)]*)\)", text):
+            params = match.group(2).strip()
+            arity[match.group(1)] = 0 if params in ("", "void") else params.count(",") + 1
+    return arity
+
+
+@pytest.fixture
+def bindings(monkeypatch):
+    """argtypes assigned by AXLWrapper._setup_functions, by function name"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    wrapper = AXLWrapper.get_instance()
+    recorder = BindingRecorder()
+    wrapper.dll = recorder
+    wrapper._setup_functions()
+    yield {
+        name: function.argtypes
+        for name, function in recorder.functions.items()
+        if hasattr(function, "argtypes")
+    }
+    AXLWrapper.reset_for_testing()
+
+
+class TestSimulatorABI:
+    """Test suite for binding and simulator signatures"""
+
+    def test_simulated_functions_match_the_headers(self, bindings):
+        """Binding, simulator stub and header agree on the argument count"""
+        if not HEADER_DIR.is_dir():
+            pytest.skip("AXL C headers not installed")
+        arity = _header_arity()
+        checked = 0
+        for name, argtypes in bindings.items():
+            stub = getattr(SimulatedAXL, name, None)
+            if stub is None or name not in arity:
+                continue
+            stub_params = len(inspect.signature(stub).parameters) - 1  # self
+            assert len(argtypes) == arity[name], f"{name} binding"
+            assert stub_params == arity[name], f"{name} simulator stub"
+            checked += 1
+
+        assert {"AxmSeqAddNode", "AxcTableSetTriggerData"} <= set(bindings)
+        assert checked > 100
+
+    def test_older_library_lacks_only_optional_functions(self, monkeypatch):
+        """Functions newer than the original binding set are optional"""
+        monkeypatch.setenv("AXL_SIMULATOR", "true")
+        AXLWrapper.reset_for_testing()
+        wrapper = AXLWrapper.get_instance()
+        wrapper.dll = BindingRecorder(
+            missing=[
+                "AxmInfoGetAxis",
+                "AxmStatusReadVel",
+                "AxmMotGetAccelJerk",
+                "AxmMotSetDecelJerk",
+                "AxaoSetRange",
+                "AxmSignalReadInput",
+                "AxmSignalReadOutput",
+            ]
+        )
+        messages = []
+        sink = logger.add(lambda message: messages.append(str(message)), level="WARNING")
+        try:
+            wrapper._setup_functions()
+        finally:
+            logger.remove(sink)
+            AXLWrapper.reset_for_testing()
+
+        assert not [message for message in messages if "critical" in message]
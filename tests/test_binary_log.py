@@ -0,0 +1,131 @@
+"""
+Binary Hot-Path Log Tests
+
+Tests for per-thread binary log buffering, the background writer with
+rotation and the offline decoder.
+"""
+
+# Standard library imports
+import threading
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from infrastructure.implementation.hardware.common.binary_log import (
+    BinaryLog,
+    decode_log,
+    decode_records,
+)
+
+
+class TestBinaryLog:
+    """Test suite for the binary hot-path log"""
+
+    def test_round_trip_all_argument_types(self, tmp_path):
+        """Arguments are stored raw and rendered by the decoder"""
+        path = tmp_path / "trace.blog"
+        log = BinaryLog(path)
+        fmt = log.define("axis {} pos {:.1f} ok={} mode={} extra={}")
+
+        log.log(fmt, 3, 1234.5, True, "abs", [1, 2])
+        log.stop()
+
+        (line,) = list(decode_log(path))
+        assert line.endswith("axis 3 pos 1234.5 ok=True mode=abs extra=[1, 2]")
+        assert f"[{threading.current_thread().name}]" in line
+
+    def test_threads_have_separate_buffers(self, tmp_path):
+        """Records of concurrent producers all arrive, in order per thread"""
+        path = tmp_path / "trace.blog"
+        log = BinaryLog(path, flush_period=0.01)
+        fmt = log.define("sample {}")
+        log.start()
+
+        def produce() -> None:
+            for i in range(2000):
+                log.log(fmt, i)
+
+        threads = [threading.Thread(target=produce, name=f"producer-{n}") for n in range(4)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        log.stop()
+
+        per_thread = {}
+        for _, thread_name, message in decode_records(path):
+            per_thread.setdefault(thread_name, []).append(int(message.split()[1]))
+        assert sorted(per_thread) == [f"producer-{n}" for n in range(4)]
+        for values in per_thread.values():
+            assert values == list(range(2000))
+        assert log.get_stats()["dropped"] == 0
+
+    def test_rotated_files_decode_on_their_own(self, tmp_path):
+        """Every rotated file carries its own format and thread tables"""
+        path = tmp_path / "trace.blog"
+        log = BinaryLog(path, max_bytes=2048, backup_count=2)
+        fmt = log.define("tick {}")
+
+        for i in range(300):
+            log.log(fmt, i)
+            if i % 50 == 49:
+                log.flush()
+        log.stop()
+
+        assert log.get_stats()["rotations"] >= 2
+        for name in ("trace.blog", "trace.blog.1", "trace.blog.2"):
+            lines = list(decode_log(tmp_path / name))
+            assert lines and all(" tick " in line for line in lines)
+        assert not (tmp_path / "trace.blog.3").exists()
+
+    def test_restart_appends_to_existing_log(self, tmp_path):
+        """A new writer keeps the previous session's records and tables"""
+        path = tmp_path / "trace.blog"
+        for session in ("first", "second"):
+            log = BinaryLog(path)
+            log.log(log.define(session + " {}"), 1)
+            log.stop()
+
+        assert [line.split("] ")[1] for line in decode_log(path)] == ["first 1", "second 1"]
+
+    def test_exited_thread_buffer_dropped_after_flush(self, tmp_path):
+        """Buffers of finished threads are released once drained; indices are not reused"""
+        path = tmp_path / "trace.blog"
+        log = BinaryLog(path)
+        fmt = log.define("from {}")
+        for n in range(3):
+            thread = threading.Thread(target=log.log, args=(fmt, n), name=f"worker-{n}")
+            thread.start()
+            thread.join()
+            log.flush()
+        log.log(fmt, "main")
+        log.stop()
+
+        assert log.get_stats()["threads"] == 1
+        names = [thread_name for _, thread_name, _ in decode_records(path)]
+        assert names == ["worker-0", "worker-1", "worker-2", threading.current_thread().name]
+
+    def test_full_thread_buffer_drops(self, tmp_path):
+        """A producer never blocks; records beyond the buffer capacity are counted as dropped"""
+        log = BinaryLog(tmp_path / "trace.blog", thread_capacity=10)
+        fmt = log.define("x {}")
+
+        for i in range(15):
+            log.log(fmt, i)
+
+        assert log.get_stats() == {
+            "records": 0,
+            "pending": 10,
+            "dropped": 5,
+            "threads": 1,
+            "rotations": 0,
+        }
+        log.stop()
+
+    def test_decoder_rejects_other_files(self, tmp_path):
+        """Files without the binary log header are refused"""
+        path = tmp_path / "other.blog"
+        path.write_bytes(b"not a binary log at all")
+        with pytest.raises(ValueError):
+            list(decode_log(path))
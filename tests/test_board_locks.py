@@ -0,0 +1,181 @@
+"""
+Per-Board Lock Sharding Tests
+
+Tests for board topology discovery, call routing to board locks and the
+concurrency of calls on different boards, using the simulated AXL library
+split across two boards.
+"""
+
+# Standard library imports
+import threading
+import time
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLFunctionNotAvailableError
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+    LatencyModel,
+    SimulatedAXL,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+from infrastructure.implementation.hardware.robot.ajinextek.board_locks import (
+    BOARD_UNMAPPED,
+    BoardTopology,
+    ShardedAXL,
+)
+
+SLOW_COMMAND = LatencyModel(
+    open=0.0, status=0.0, command=0.05, motion=0.0, io=0.0, file=0.0, jitter=0.0
+)
+
+
+def _open(latency: LatencyModel) -> AXLWrapper:
+    wrapper = AXLWrapper.get_instance()
+    wrapper.dll = SimulatedAXL(axis_count=4, latency=latency, board_count=2)
+    wrapper.open(7)
+    return wrapper
+
+
+@pytest.fixture
+def axl(monkeypatch):
+    """Fixture providing an opened AXLWrapper over a zero-latency two-board simulator"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    yield _open(LatencyModel.zero())
+    AXLWrapper.reset_for_testing()
+
+
+@pytest.fixture
+def slow_axl(monkeypatch):
+    """Fixture providing a two-board simulator whose commands take 50 ms"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    yield _open(SLOW_COMMAND)
+    AXLWrapper.reset_for_testing()
+
+
+def _acquisitions(sharded: ShardedAXL) -> dict:
+    return {board: s["acquisitions"] for board, s in sharded.get_stats().items()}
+
+
+class TestBoardTopology:
+    """Test suite for topology discovery"""
+
+    def test_discover_splits_axes_and_modules(self, axl):
+        """Axes and DIO modules report the board they sit on"""
+        topology = BoardTopology.discover(axl)
+
+        assert topology.axes == {0: 0, 1: 0, 2: 1, 3: 1}
+        assert topology.dio_modules == {0: 0, 1: 1}
+        assert topology.boards() == {0, 1}
+
+    def test_explicit_aio_and_counter_boards(self):
+        topology = BoardTopology()
+        topology.assign_aio([0, 1], 1)
+        topology.assign_counter([0], 2)
+
+        assert topology.board_of("aio", 1) == 1
+        assert topology.board_of("counter", 0) == 2
+        assert topology.board_of("counter", 5) == BOARD_UNMAPPED
+
+
+class TestRouting:
+    """Test suite for mapping wrapper calls to board locks"""
+
+    def test_axis_call_locks_its_board(self, axl):
+        sharded = ShardedAXL(axl)
+
+        sharded.servo_on(3, 1)
+
+        assert _acquisitions(sharded) == {BOARD_UNMAPPED: 0, 0: 0, 1: 1}
+        assert axl.is_servo_on(3)
+
+    def test_status_reads_are_lock_free(self, axl):
+        sharded = ShardedAXL(axl)
+
+        sharded.read_in_motion(0)
+        sharded.status_read_vel(1)
+        sharded.get_cmd_pos(2)
+
+        assert set(_acquisitions(sharded).values()) == {0}
+
+    def test_queue_draining_reads_take_locks(self, axl):
+        """Reads that pop driver FIFOs/queues are not lock-free"""
+        sharded = ShardedAXL(axl)
+
+        with pytest.raises(AXLFunctionNotAvailableError):  # Not in the simulator
+            sharded.status_read_mon_ex(3, None)
+        assert _acquisitions(sharded) == {BOARD_UNMAPPED: 0, 0: 0, 1: 1}
+
+        sharded.read_interrupt_status()
+        assert _acquisitions(sharded) == {BOARD_UNMAPPED: 1, 0: 1, 1: 2}
+
+    def test_multi_axis_call_locks_every_board_involved(self, axl):
+        sharded = ShardedAXL(axl)
+
+        sharded.move_multi_smooth_stop([0, 3])
+
+        assert _acquisitions(sharded) == {BOARD_UNMAPPED: 0, 0: 1, 1: 1}
+
+    def test_dio_and_unmapped_resources(self, axl):
+        """DIO modules route by module; resources missing from the topology share a lock"""
+        sharded = ShardedAXL(axl)
+
+        sharded.write_output_bit(1, 0, True)
+        sharded.ao_set_range(0, -10.0, 10.0)
+
+        assert _acquisitions(sharded) == {BOARD_UNMAPPED: 1, 0: 0, 1: 1}
+
+    def test_counter_module_routes_to_counter_board(self, axl):
+        """counter_* module numbers are counter resources, not DIO modules"""
+        topology = BoardTopology.discover(axl)
+        topology.assign_counter([1], 0)
+        sharded = ShardedAXL(axl, topology)
+
+        sharded.counter_set_trigger_table(1, 0, None, None, None, 0)
+
+        assert _acquisitions(sharded) == {BOARD_UNMAPPED: 0, 0: 1, 1: 0}
+
+    def test_global_call_locks_all_boards(self, axl):
+        sharded = ShardedAXL(axl)
+
+        sharded.get_axis_count()
+
+        assert set(_acquisitions(sharded).values()) == {1}
+
+
+class TestConcurrency:
+    """Test suite for parallel traffic on independent boards"""
+
+    def _run_pair(self, sharded: ShardedAXL, axes) -> float:
+        start = threading.Barrier(len(axes))
+
+        def worker(axis_no: int) -> None:
+            start.wait()
+            sharded.servo_on(axis_no, 1)
+
+        threads = [threading.Thread(target=worker, args=(axis,)) for axis in axes]
+        began = time.perf_counter()
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        return time.perf_counter() - began
+
+    def test_different_boards_overlap(self, slow_axl):
+        sharded = ShardedAXL(slow_axl)
+
+        elapsed = self._run_pair(sharded, [0, 2])
+
+        assert elapsed < 0.09
+        assert all(s["contended"] == 0 for s in sharded.get_stats().values())
+
+    def test_same_board_serializes(self, slow_axl):
+        sharded = ShardedAXL(slow_axl)
+
+        elapsed = self._run_pair(sharded, [0, 1])
+
+        assert elapsed >= 0.1
+        assert sharded.get_stats()[0]["contended"] == 1
@@ -0,0 +1,250 @@
+"""
+BS205 Stream Reader Tests
+
+Tests for incremental BS205 frame scanning, the threaded stream reader
+against an emulated indicator port, and streamed reads through
+BS205LoadCell.
+"""
+
+# Standard library imports
+from array import array
+import asyncio
+import threading
+import time
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from infrastructure.implementation.hardware.loadcell.bs205.bs205_loadcell import BS205LoadCell
+from infrastructure.implementation.hardware.loadcell.bs205.stream_reader import (
+    BS205FrameScanner,
+    BS205StreamReader,
+)
+
+
+def _frame(text: str, indicator_id: int = 1) -> bytes:
+    return b"\x02" + bytes([0x30 + indicator_id]) + text.encode("ascii") + b"\x03"
+
+
+def _scan(scanner: BS205FrameScanner, data: bytes):
+    weights = array("d", [0.0]) * 16
+    ends = array("l", [0]) * 16
+    count = scanner.feed(data, len(data), weights, ends)
+    return list(weights[:count]), list(ends[:count])
+
+
+class FakeBS205Port:
+    """Emulated indicator: answers each ID+R+CRLF request with a weight frame"""
+
+    def __init__(self, weight: float = 1.5, **settings):
+        self.settings = settings
+        self.timeout = settings.get("timeout", 0.01)
+        self.weight = weight
+        self.written = []
+        self.closed = False
+        self._rx = bytearray()
+        self._cond = threading.Condition()
+
+    @property
+    def in_waiting(self) -> int:
+        with self._cond:
+            return len(self._rx)
+
+    def write(self, data: bytes) -> int:
+        self.written.append(bytes(data))
+        if data[1:2] == b"R":
+            with self._cond:
+                self._rx += _frame(f"{'+' if self.weight >= 0 else '-'}{abs(self.weight):6.3f}")
+                self._cond.notify()
+        return len(data)
+
+    def read(self, size: int = 1) -> bytes:
+        with self._cond:
+            if not self._rx:
+                self._cond.wait(self.timeout)
+            data = bytes(self._rx[:size])
+            del self._rx[:size]
+            return data
+
+    def close(self) -> None:
+        self.closed = True
+
+
+class FirstRequestLostPort(FakeBS205Port):
+    """Indicator that misses the first weight request"""
+
+    def write(self, data: bytes) -> int:
+        if not self.written:
+            self.written.append(bytes(data))
+            return len(data)
+        return super().write(data)
+
+
+class _FakeConnection:
+    async def disconnect(self) -> None:
+        pass
+
+
+class TestFrameScanner:
+    """Test suite for incremental frame scanning"""
+
+    def test_parses_sign_padding_and_decimals(self):
+        scanner = BS205FrameScanner()
+        data = _frame("+ 7.487") + b"\r\n" + _frame("-12.34") + _frame("+  7487")
+
+        weights, ends = _scan(scanner, data)
+
+        assert weights == pytest.approx([7.487, -12.34, 7487.0])
+        assert ends[0] == 9
+        assert scanner.errors == 0
+
+    def test_frame_split_across_reads(self):
+        scanner = BS205FrameScanner()
+        data = _frame("+ 1.250")
+
+        assert _scan(scanner, data[:4])[0] == []
+        assert _scan(scanner, data[4:])[0] == pytest.approx([1.25])
+
+    def test_resynchronizes_after_corrupt_frames(self):
+        scanner = BS205FrameScanner(indicator_id=1)
+        data = (
+            b"\x02\x31+1.2"  # Truncated by the next STX
+            + _frame("+2.000", indicator_id=2)  # Other indicator
+            + _frame("+1x000")
+            + _frame("+3.000")
+        )
+
+        assert _scan(scanner, data)[0] == pytest.approx([3.0])
+        assert scanner.errors == 3
+
+
+class TestStreamReader:
+    """Test suite for the stream reader on the serial reactor"""
+
+    def test_poll_mode_streams_timestamped_weights(self):
+        ports = []
+
+        def factory(**settings):
+            ports.append(FakeBS205Port(**settings))
+            return ports[-1]
+
+        reader = BS205StreamReader("COM3", indicator_id=1, serial_factory=factory)
+        before = time.monotonic()
+        reader.start()
+        try:
+            deadline = time.monotonic() + 2.0
+            while reader.get_statistics()["frames"] < 20 and time.monotonic() < deadline:
+                time.sleep(0.01)
+            ports[0].weight = -2.0
+            time.sleep(0.05)
+            timestamp, weight = reader.latest()
+        finally:
+            reader.stop()
+
+        assert ports[0].settings["baudrate"] == 9600
+        assert ports[0].closed
+        assert weight == pytest.approx(-2.0)
+        assert before < timestamp <= time.monotonic()
+        times, weights = reader.window()
+        assert len(weights) >= 20
+        assert (times[1:] >= times[:-1]).all()
+
+    def test_commands_are_written_between_requests(self):
+        port = FakeBS205Port()
+        reader = BS205StreamReader("COM3", serial_factory=lambda **_: port)
+        reader.start()
+        try:
+            reader.send_command("Z")
+            time.sleep(0.05)
+        finally:
+            reader.stop()
+
+        assert b"1Z\r\n" in port.written
+        assert port.written[0] == b"1R\r\n"
+
+    def test_lost_response_is_requested_again(self):
+        port = FirstRequestLostPort()
+        reader = BS205StreamReader("COM3", serial_factory=lambda **_: port, request_timeout=0.05)
+        reader.start()
+        try:
+            deadline = time.monotonic() + 1.0
+            while reader.get_statistics()["frames"] < 3 and time.monotonic() < deadline:
+                time.sleep(0.01)
+        finally:
+            reader.stop()
+
+        stats = reader.get_statistics()
+        assert stats["request_timeouts"] == 1
+        assert stats["frames"] >= 3
+
+
+class TestStreamingLoadCell:
+    """Test suite for streamed reads through BS205LoadCell"""
+
+    @pytest.mark.asyncio
+    async def test_read_force_and_hold_while_streaming(self):
+        port = FakeBS205Port(weight=4.25)
+        loadcell = BS205LoadCell("COM3", 9600, 1.0, 8, 1, None, 1)
+        loadcell._connection = _FakeConnection()
+        loadcell._is_connected = True
+
+        stream = await loadcell.start_streaming(serial_factory=lambda **_: port)
+        try:
+            force = await loadcell.read_force()
+            assert force.value == pytest.approx(4.25)
+            assert await loadcell.hold() is True
+            time.sleep(0.05)
+            assert b"1H\r\n" in port.written
+            assert stream.window_stats()["count"] > 0
+        finally:
+            await loadcell.disconnect()
+
+        assert loadcell.get_stream() is None
+        assert port.closed
+
+    @pytest.mark.asyncio
+    async def test_streamed_peak_force_sees_every_frame(self):
+        port = FakeBS205Port(weight=1.0)
+        loadcell = BS205LoadCell("COM3", 9600, 1.0, 8, 1, None, 1)
+        loadcell._connection = _FakeConnection()
+        loadcell._is_connected = True
+
+        await loadcell.start_streaming(serial_factory=lambda **_: port)
+        try:
+            # A 20 ms spike would fall between two 200 ms command/response polls
+            task = asyncio.ensure_future(loadcell.read_peak_force(duration_ms=200))
+            await asyncio.sleep(0.05)
+            port.weight = -6.5
+            await asyncio.sleep(0.02)
+            port.weight = 1.0
+            peak = await task
+        finally:
+            await loadcell.disconnect()
+
+        assert peak.value == pytest.approx(-6.5)
+
+
+    @pytest.mark.asyncio
+    async def test_overlapping_peak_reads_keep_their_own_windows(self):
+        port = FakeBS205Port(weight=1.0)
+        loadcell = BS205LoadCell("COM3", 9600, 1.0, 8, 1, None, 1)
+        loadcell._connection = _FakeConnection()
+        loadcell._is_connected = True
+
+        await loadcell.start_streaming(serial_factory=lambda **_: port)
+        try:
+            long_read = asyncio.ensure_future(loadcell.read_peak_force(duration_ms=300))
+            await asyncio.sleep(0.05)
+            port.weight = -6.5
+            await asyncio.sleep(0.02)
+            port.weight = 1.0
+            await asyncio.sleep(0.03)
+            # Starts after the spike and ends first; must not reset the long window
+            short_peak = await loadcell.read_peak_force(duration_ms=100)
+            long_peak = await long_read
+        finally:
+            await loadcell.disconnect()
+
+        assert short_peak.value == pytest.approx(1.0)
+        assert long_peak.value == pytest.approx(-6.5)
@@ -0,0 +1,189 @@
+"""
+Cycle Trace What-If Analyzer Tests
+
+Tests for timeline reconstruction from recorded AXL calls, what-if
+re-simulation of velocities, settle times and overlap rules, and trace
+recording through TracingAXL on the simulated AXL library.
+"""
+
+# Standard library imports
+import time
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from infrastructure.implementation.hardware.common.binary_log import BinaryLog
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+    LatencyModel,
+    SimulatedAXL,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+from infrastructure.implementation.hardware.robot.ajinextek.constants import POS_ABS
+from infrastructure.implementation.hardware.robot.ajinextek.cycle_trace import (
+    SEGMENT_SETTLE,
+    SEGMENT_WAIT,
+    TraceCall,
+    TraceMarker,
+    TracingAXL,
+    WhatIf,
+    build_timeline,
+    load_trace,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.measurement_order import (
+    AxisProfile,
+)
+
+
+def _call(start, method, *args, result=0):
+    return TraceCall(start, 0.001, method, args, result)
+
+
+# 100 units at 1000 unit/s, 10000 unit/s^2: triangular 0.1 s + 0.1 s profile ending at
+# 0.211; the stop is seen at 0.221 (10 ms overshoot), then 0.1 s settle and 0.18 s dwell
+TRACE = [
+    TraceMarker(0.0, "move"),
+    _call(0.0, "get_cmd_pos", 0, result=0.0),
+    _call(0.01, "move_start_pos", 0, 100.0, 1000.0, 10000.0, 10000.0),
+    _call(0.02, "read_in_motion", 0, result=True),
+    _call(0.12, "read_in_motion", 0, result=True),
+    _call(0.22, "read_in_motion", 0, result=False),
+    TraceMarker(0.321, "measure"),
+    _call(0.321, "status_read_torque", 0, result=1.5),
+    _call(0.5, "write_output_bit", 0, 1, True),
+]
+
+
+@pytest.fixture
+def axl(monkeypatch):
+    """Fixture providing an opened AXLWrapper over a zero-latency simulator"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    wrapper = AXLWrapper.get_instance()
+    wrapper.dll = SimulatedAXL(latency=LatencyModel.zero())
+    wrapper.open(7)
+    yield wrapper
+    AXLWrapper.reset_for_testing()
+
+
+class TestTimeline:
+    """Test suite for timeline reconstruction"""
+
+    def test_segments_and_recorded_times(self):
+        timeline = build_timeline(TRACE)
+
+        recorded = timeline.recorded()
+        assert recorded.total == pytest.approx(0.501)
+        assert recorded.phases == pytest.approx({"move": 0.321, "measure": 0.18})
+        assert recorded.kinds[SEGMENT_WAIT] == pytest.approx(0.201)
+        assert recorded.kinds[SEGMENT_SETTLE] == pytest.approx(0.1)
+
+    def test_unchanged_parameters_reproduce_the_recording(self):
+        timeline = build_timeline(TRACE)
+        assert timeline.simulate().phases == pytest.approx(timeline.recorded().phases)
+
+    def test_axes_waited_together_keep_one_wait_each(self):
+        """Interleaved polls of two axes give two waits; the later covers the rest"""
+        trace = [
+            _call(0.0, "get_cmd_pos", 0, result=0.0),
+            _call(0.002, "get_cmd_pos", 1, result=0.0),
+            _call(0.01, "move_start_pos", 0, 100.0, 1000.0, 10000.0, 10000.0),
+            _call(0.012, "move_start_pos", 1, 50.0, 1000.0, 10000.0, 10000.0),
+            _call(0.02, "read_in_motion", 0, result=True),
+            _call(0.03, "read_in_motion", 1, result=True),
+            _call(0.12, "read_in_motion", 0, result=True),
+            _call(0.13, "read_in_motion", 1, result=True),
+            _call(0.22, "read_in_motion", 0, result=False),
+            _call(0.23, "read_in_motion", 1, result=False),
+        ]
+        timeline = build_timeline(trace)
+
+        waits = [s for s in timeline.segments if s.kind == SEGMENT_WAIT]
+        assert [s.axis_no for s in waits] == [0, 1]
+        assert [s.duration for s in waits] == pytest.approx([0.201, 0.01])
+        assert timeline.recorded().total == pytest.approx(0.231)
+        assert timeline.simulate().total == pytest.approx(0.231)
+        # Axis 0 now takes 0.4 s instead of 0.2 s and sets the cycle time
+        assert timeline.simulate(WhatIf(accel_scale=0.25)).total == pytest.approx(0.421)
+
+    def test_unknown_start_keeps_the_recorded_motion(self):
+        """Without a known start position the move is not re-simulated"""
+        trace = [event for event in TRACE if getattr(event, "method", "") != "get_cmd_pos"]
+        timeline = build_timeline(trace)
+
+        faster = timeline.simulate(WhatIf(accel_scale=4.0))
+
+        assert faster.total == pytest.approx(timeline.recorded().total)
+
+
+class TestWhatIf:
+    """Test suite for what-if re-simulation"""
+
+    def test_faster_acceleration_shortens_the_wait(self):
+        """At 40000 unit/s^2 the move takes 0.125 s instead of 0.2 s"""
+        predicted = build_timeline(TRACE).simulate(WhatIf(accel_scale=4.0))
+
+        assert predicted.phases["move"] == pytest.approx(0.321 - 0.075)
+        assert predicted.phases["measure"] == pytest.approx(0.18)
+
+    def test_axis_profile_limits_the_velocity(self):
+        """The maximum velocity of the axis caps a velocity increase"""
+        what_if = WhatIf(velocity=2000.0, accel_scale=4.0)
+        free = build_timeline(TRACE).simulate(what_if)
+        timeline = build_timeline(TRACE, profiles={0: AxisProfile(max_velocity=500.0)})
+        capped = timeline.simulate(what_if)
+
+        # Unlimited: 0.1 s instead of 0.2 s. Capped at 500 unit/s: 0.2125 s instead of 0.25 s
+        assert free.phases["move"] == pytest.approx(0.321 - 0.1)
+        assert capped.phases["move"] == pytest.approx(0.321 - 0.0375)
+
+    def test_settle_rules(self):
+        timeline = build_timeline(TRACE)
+
+        assert timeline.simulate(WhatIf(settle=0.02)).total == pytest.approx(0.421)
+        assert timeline.simulate(WhatIf(phase_settle={"move": 0.05})).total == pytest.approx(0.451)
+        # The 0.1 s settle runs entirely during the 0.1 s deceleration
+        overlapped = timeline.simulate(WhatIf(settle_during_decel=True))
+        assert overlapped.kinds[SEGMENT_SETTLE] == pytest.approx(0.0)
+
+    def test_wait_by_profile_removes_poll_overshoot(self):
+        predicted = build_timeline(TRACE).simulate(WhatIf(wait_by_profile=True))
+        assert predicted.total == pytest.approx(0.491)
+
+    def test_format_against_baseline(self):
+        timeline = build_timeline(TRACE)
+        table = timeline.simulate(WhatIf(settle=0.0)).format_against(timeline.recorded())
+        assert "-0.100" in table.splitlines()[1]
+        assert table.splitlines()[-1].startswith("total")
+
+
+class TestTracingAXL:
+    """Test suite for recording through the tracing proxy"""
+
+    def test_recorded_cycle_round_trip(self, axl, tmp_path):
+        path = tmp_path / "cycle.blog"
+        log = BinaryLog(path)
+        traced = TracingAXL(axl, log)
+
+        traced.mark_phase("move")
+        traced.servo_on(0, 1)
+        traced.set_abs_rel_mode(0, POS_ABS)
+        traced.get_cmd_pos(0)
+        traced.move_start_pos(0, 20.0, 1000.0, 20000.0, 20000.0)
+        while traced.read_in_motion(0):
+            time.sleep(0.005)
+        time.sleep(0.03)
+        traced.mark_phase("measure")
+        traced.read_servo_alarm(0)
+        log.stop()
+
+        events = load_trace(path)
+        timeline = build_timeline(events)
+
+        move = [s for s in timeline.segments if s.kind == "move"][0]
+        assert move.distance == pytest.approx(20.0)
+        assert move.motion_time == pytest.approx(0.0632, abs=1e-3)
+        assert list(timeline.recorded().phases) == ["move", "measure"]
+        assert timeline.recorded().kinds[SEGMENT_SETTLE] >= 0.03
+        assert timeline.simulate().total == pytest.approx(timeline.recorded().total)
+        assert events[1].method == "servo_on" and events[1].args == (0, 1)
@@ -0,0 +1,127 @@
+"""
+Simulated DUT Plant Tests
+
+Tests for the DUT contact/spring model and its coupling to the simulated
+AXL library's servo load ratio and the mock loadcell.
+"""
+
+# Third-party imports
+import asyncio
+import pytest
+
+# Local application imports
+from infrastructure.implementation.hardware.loadcell.mock.mock_loadcell import MockLoadCell
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+    LatencyModel,
+    SIM_LOAD_RATIO_PER_NEWTON,
+    SimulatedAXL,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+from infrastructure.implementation.hardware.robot.ajinextek.dut_model import DUTModel, DUTPlant
+
+CONTACT = 1000.0
+
+
+@pytest.fixture
+def axl(monkeypatch):
+    """Fixture providing an opened AXLWrapper over a zero-latency simulator, servo on"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    wrapper = AXLWrapper.get_instance()
+    wrapper.dll = SimulatedAXL(latency=LatencyModel.zero())
+    wrapper.open(7)
+    wrapper.servo_on(0, 1)
+    yield wrapper
+    AXLWrapper.reset_for_testing()
+
+
+class TestDUTPlant:
+    """Test suite for the force-displacement model"""
+
+    def test_free_travel_and_nonlinear_spring(self):
+        """No force before contact, k * (d + c * d^3) beyond it"""
+        plant = DUTPlant(DUTModel(CONTACT, stiffness=2.0, cubic_stiffness=0.01))
+
+        assert plant.force(CONTACT - 50.0) == 0.0
+        assert plant.force(CONTACT) == 0.0
+        assert plant.force(CONTACT + 10.0) == pytest.approx(2.0 * (10.0 + 0.01 * 1000.0))
+
+    def test_negative_direction(self):
+        """A DUT pressed from above deflects towards lower positions"""
+        plant = DUTPlant(DUTModel(CONTACT, stiffness=2.0, direction=-1))
+
+        assert plant.force(CONTACT + 10.0) == 0.0
+        assert plant.force(CONTACT - 10.0) == pytest.approx(20.0)
+
+    def test_temperature_scales_stiffness(self):
+        """Stiffness changes by the temperature coefficient per degree"""
+        model = DUTModel(CONTACT, stiffness=2.0, stiffness_temp_coeff=-0.01)
+        cold = DUTPlant(model, temperature=25.0)
+        hot = DUTPlant(model, temperature=45.0)
+
+        assert hot.force(CONTACT + 10.0) == pytest.approx(cold.force(CONTACT + 10.0) * 0.8)
+
+    def test_unloading_branch_shows_hysteresis(self):
+        """Releasing returns less force than pressing, meeting at the turning point"""
+        plant = DUTPlant(DUTModel(CONTACT, stiffness=2.0, hysteresis=0.2))
+
+        loading = plant.force(CONTACT + 10.0)
+        peak = plant.force(CONTACT + 20.0)
+        unloading = plant.force(CONTACT + 10.0)
+
+        assert peak == pytest.approx(40.0)
+        assert unloading == pytest.approx(loading * 0.9)
+        assert plant.force(CONTACT + 20.0) == pytest.approx(peak)
+
+        plant.force(CONTACT - 1.0)  # Back in free travel: history forgotten
+        assert plant.force(CONTACT + 10.0) == pytest.approx(loading)
+
+    def test_loadcell_noise_is_seeded(self):
+        """The same seed reproduces the same noisy readings"""
+        model = DUTModel(CONTACT, stiffness=2.0, noise=0.5)
+        first = DUTPlant(model, seed=3)
+        second = DUTPlant(model, seed=3)
+
+        readings = [first.loadcell(CONTACT + 10.0) for _ in range(5)]
+
+        assert readings == [second.loadcell(CONTACT + 10.0) for _ in range(5)]
+        assert readings != [20.0] * 5
+
+    def test_invalid_parameters(self):
+        with pytest.raises(ValueError):
+            DUTModel(CONTACT, stiffness=0.0)
+        with pytest.raises(ValueError):
+            DUTModel(CONTACT, stiffness=1.0, hysteresis=1.0)
+
+
+class TestSimulatorCoupling:
+    """Test suite for the DUT inside the simulated AXL library"""
+
+    def test_load_ratio_follows_axis_position(self, axl):
+        """The servo load ratio carries the DUT reaction force at the axis position"""
+        axl.dll.attach_dut(0, DUTModel(CONTACT, stiffness=2.0))
+
+        axl.set_cmd_pos(0, CONTACT - 100.0)
+        assert axl.status_read_servo_load_ratio(0) == 0.0
+
+        axl.set_cmd_pos(0, CONTACT + 25.0)
+        assert axl.status_read_servo_load_ratio(0) == pytest.approx(
+            50.0 * SIM_LOAD_RATIO_PER_NEWTON
+        )
+
+        axl.dll.set_dut_temperature(0, 25.0)
+        axl.dll.detach_dut(0)
+        assert axl.status_read_servo_load_ratio(0) == 0.0
+
+    def test_mock_loadcell_reads_dut_force(self, axl):
+        """The mock loadcell reports the simulated DUT force"""
+        axl.dll.attach_dut(0, DUTModel(CONTACT, stiffness=2.0))
+        axl.set_cmd_pos(0, CONTACT + 10.0)
+        loadcell = MockLoadCell()
+        loadcell.set_force_source(lambda: axl.dll.read_loadcell(0))
+
+        async def read() -> float:
+            await loadcell.connect()
+            return (await loadcell.read_force()).value
+
+        assert asyncio.run(read()) == pytest.approx(20.0)
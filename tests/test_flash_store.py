@@ -0,0 +1,134 @@
+"""
+Board Data Flash Key-Value Store Tests
+
+Tests for the append-only page ring on the simulated AXL library's board
+data flash: persistence across mounts, CRC checks, wear leveling and
+compaction.
+"""
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLConfigurationError, AXLError
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+    LatencyModel,
+    SimulatedAXL,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+from infrastructure.implementation.hardware.robot.ajinextek.error_codes import (
+    AXT_RT_DATA_FLASH_BUSY,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.flash_store import (
+    BoardFlashStore,
+    MAX_RECORD_DATA,
+)
+
+PAGES = 8
+
+
+@pytest.fixture
+def axl(monkeypatch):
+    """Fixture providing an opened AXLWrapper over a zero-latency simulator, instant flash"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    wrapper = AXLWrapper.get_instance()
+    wrapper.dll = SimulatedAXL(latency=LatencyModel.zero())
+    wrapper.dll.flash_write_time = 0.0
+    wrapper.open(7)
+    yield wrapper
+    AXLWrapper.reset_for_testing()
+
+
+def _store(axl, **kwargs) -> BoardFlashStore:
+    options = dict(first_page=10, page_count=PAGES, write_interval=0.0)
+    options.update(kwargs)
+    store = BoardFlashStore(axl, **options)
+    store.mount()
+    return store
+
+
+class TestDataFlash:
+    """Test suite for the data flash wrapper calls"""
+
+    def test_round_trip_and_busy(self, axl):
+        """Pages read back what was written; a write during programming is rejected"""
+        axl.set_data_flash(0, 3, b"abc")
+        assert axl.get_data_flash(0, 3, 4) == b"abc\xff"
+
+        axl.dll.flash_write_time = 10.0
+        axl.set_data_flash(0, 4, b"x")
+        with pytest.raises(AXLError) as exc_info:
+            axl.set_data_flash(0, 5, b"y")
+        assert exc_info.value.error_code == AXT_RT_DATA_FLASH_BUSY
+
+
+class TestBoardFlashStore:
+    """Test suite for the key-value store"""
+
+    def test_values_survive_remount(self, axl):
+        store = _store(axl)
+        store.put("calib_hash", bytes.fromhex("deadbeef"))
+        store.put_value("home_offset", -12.5)
+        store.put_value("odometer", 1200)
+        store.put_value("odometer", 1201)
+        store.delete("calib_hash")
+
+        again = _store(axl)
+
+        assert again.snapshot() == {"home_offset": b"-12.5", "odometer": b"1201"}
+        assert again.get_value("odometer") == 1201
+        assert again.get("calib_hash") is None
+
+    def test_unchanged_value_is_not_rewritten(self, axl):
+        store = _store(axl)
+        store.put_value("fingerprint", "a1b2")
+        writes = store.get_stats()["page_writes"]
+
+        store.put_value("fingerprint", "a1b2")
+
+        assert store.get_stats()["page_writes"] == writes
+
+    def test_corrupt_record_is_dropped(self, axl):
+        """A record failing its CRC ends the scan of its page, earlier records survive"""
+        store = _store(axl)
+        store.put("a", b"1")
+        store.put("b", b"2")
+        axl.dll.corrupt_flash(0, 10, 14 + 5 + 2 + 5)  # Key byte of the second record
+
+        assert _store(axl).snapshot() == {"a": b"1"}
+
+    def test_wear_spreads_over_the_ring(self, axl):
+        """Rewriting one key cycles through every page and compacts the others forward"""
+        store = _store(axl)
+        store.put_value("serial", "SN-0001")
+        for count in range(400):
+            store.put_value("odometer", count)
+
+        wear = axl.dll.get_flash_wear(0)[10 : 10 + PAGES]
+        assert min(wear) > 0
+        assert max(wear) - min(wear) <= max(wear) // 2
+        assert store.get_stats()["compactions"] > 0
+        assert store.get_stats()["free_pages"] >= 2
+        assert _store(axl).snapshot() == {"serial": b'"SN-0001"', "odometer": b"399"}
+
+    def test_pages_outside_the_store_are_untouched(self, axl):
+        store = _store(axl)
+        for count in range(100):
+            store.put_value("odometer", count)
+
+        wear = axl.dll.get_flash_wear(0)
+        assert sum(wear[:10]) == sum(wear[10 + PAGES :]) == 0
+
+    def test_full_store_and_oversized_records(self, axl):
+        store = _store(axl, page_count=4)
+        with pytest.raises(ValueError):
+            store.put("key", b"x" * MAX_RECORD_DATA)
+        with pytest.raises(AXLConfigurationError):
+            for n in range(20):
+                store.put(f"k{n}", b"x" * 40)
+
+    def test_requires_mount(self, axl):
+        store = BoardFlashStore(axl, write_interval=0.0)
+        with pytest.raises(AXLConfigurationError):
+            store.get("anything")
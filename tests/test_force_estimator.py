@@ -0,0 +1,132 @@
+"""
+Sensorless Force Estimator Tests
+
+Tests for the torque-to-force model fitted against loadcell readings, run
+against the simulated AXL library's servo load ratio.
+"""
+
+# Third-party imports
+import numpy as np
+import pytest
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLConfigurationError
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+    LatencyModel,
+    SIM_FRICTION_LOAD_RATIO,
+    SIM_LOAD_RATIO_PER_NEWTON,
+    SimulatedAXL,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+from infrastructure.implementation.hardware.robot.ajinextek.force_estimator import (
+    ForceModel,
+    SensorlessForceEstimator,
+)
+
+
+@pytest.fixture
+def axl(monkeypatch):
+    """Fixture providing an opened AXLWrapper over a zero-latency simulator, servo on"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    wrapper = AXLWrapper.get_instance()
+    wrapper.dll = SimulatedAXL(latency=LatencyModel.zero())
+    wrapper.open(7)
+    wrapper.servo_on(0, 1)
+    yield wrapper
+    AXLWrapper.reset_for_testing()
+
+
+def _calibrate_with_friction(estimator: SensorlessForceEstimator, noise: float = 0.0) -> None:
+    """Synthetic stroke: torque = force * k + friction * dir, in both directions"""
+    rng = np.random.default_rng(1)
+    for force in np.linspace(0.0, 200.0, 12):
+        for direction in (1, -1):
+            torque = force * SIM_LOAD_RATIO_PER_NEWTON + SIM_FRICTION_LOAD_RATIO * direction
+            measured = force + rng.normal(0.0, noise) if noise else force
+            estimator.add_calibration_sample(measured, torque=torque, velocity=100.0 * direction)
+
+
+class TestSensorlessForceEstimator:
+    """Test suite for the sensorless force estimator"""
+
+    def test_fit_recovers_gain_and_friction(self, axl):
+        """Gain, offset and friction come out of a two-direction calibration stroke"""
+        estimator = SensorlessForceEstimator(axl, axis_no=0)
+        _calibrate_with_friction(estimator)
+
+        model = estimator.fit()
+
+        assert model.gain == pytest.approx(1.0 / SIM_LOAD_RATIO_PER_NEWTON)
+        assert model.offset == pytest.approx(0.0, abs=1e-6)
+        expected_friction = -SIM_FRICTION_LOAD_RATIO / SIM_LOAD_RATIO_PER_NEWTON
+        assert model.friction == pytest.approx(expected_friction)
+
+    def test_estimate_reads_simulated_load(self, axl):
+        """A standing axis under load is estimated from the servo load ratio"""
+        estimator = SensorlessForceEstimator(axl, axis_no=0)
+        _calibrate_with_friction(estimator, noise=0.5)
+        estimator.fit()
+
+        axl.dll.set_external_force(0, 120.0)
+        estimate = estimator.estimate()
+
+        assert estimate.velocity == 0.0
+        assert estimate.lower < 120.0 < estimate.upper
+        assert estimate.force == pytest.approx(120.0, abs=2.0)
+        assert not estimate.extrapolated
+
+    def test_bounds_widen_outside_calibrated_range(self, axl):
+        """Extrapolated estimates are flagged and less certain"""
+        estimator = SensorlessForceEstimator(axl, axis_no=0)
+        _calibrate_with_friction(estimator, noise=0.5)
+        estimator.fit()
+
+        inside = estimator.estimate(torque=5.0, velocity=0.0)
+        outside = estimator.estimate(torque=50.0, velocity=0.0)
+
+        assert outside.extrapolated
+        assert outside.upper - outside.lower > inside.upper - inside.lower
+
+    def test_single_direction_fixes_friction_at_zero(self, axl):
+        """Friction cannot be separated from the offset without both directions"""
+        estimator = SensorlessForceEstimator(axl, axis_no=0)
+        for force in np.linspace(0.0, 100.0, 10):
+            estimator.add_calibration_sample(force, torque=force * 0.1 + 1.0, velocity=50.0)
+
+        model = estimator.fit()
+
+        assert model.friction == 0.0
+        assert model.gain == pytest.approx(10.0)
+
+    def test_guard_uses_far_bound(self, axl):
+        """may_exceed trips when the confidence bound crosses the limit"""
+        estimator = SensorlessForceEstimator(axl, axis_no=0)
+        _calibrate_with_friction(estimator, noise=2.0)
+        estimator.fit()
+        estimate = estimator.estimate(torque=100.0 * SIM_LOAD_RATIO_PER_NEWTON, velocity=0.0)
+
+        between = (estimate.force + estimate.upper) / 2
+        assert estimator.may_exceed(between, estimate)
+        assert not estimator.may_exceed(estimate.upper + 1.0, estimate)
+
+    def test_uncalibrated_and_underdetermined(self, axl):
+        """Estimating needs a model, fitting needs enough samples"""
+        estimator = SensorlessForceEstimator(axl, axis_no=0)
+        with pytest.raises(AXLConfigurationError):
+            estimator.estimate()
+
+        estimator.add_calibration_sample(10.0, torque=1.0, velocity=0.0)
+        with pytest.raises(ValueError):
+            estimator.fit()
+
+    def test_model_round_trip(self, axl):
+        """A fitted model survives to_dict/from_dict unchanged"""
+        estimator = SensorlessForceEstimator(axl, axis_no=0)
+        _calibrate_with_friction(estimator, noise=0.5)
+        model = estimator.fit()
+
+        restored = ForceModel.from_dict(model.to_dict())
+
+        assert restored == model
+        assert restored.predict(4.0, 1) == model.predict(4.0, 1)
@@ -0,0 +1,274 @@
+"""
+Interlock Engine Tests
+
+Tests for compiling interlock rules and evaluating them on the process image
+scan cycle, run against the simulated AXL library with cycles driven by hand.
+"""
+
+# Third-party imports
+import numpy as np
+import pytest
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLConfigurationError, AXLError
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+    LatencyModel,
+    SimulatedAXL,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    INTERLOCK_MAX_MISSED_SCANS,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.error_codes import (
+    AXT_RT_MOTION_INVALID_METHOD,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.interlock import (
+    InterlockEngine,
+    InterlockRule,
+    OP_AND,
+    OP_DI,
+    OP_IN_MOTION,
+    OP_NOT,
+    OP_RULE,
+    ai_above,
+    compile_rules,
+    di,
+    estop,
+    in_motion,
+    on_delay,
+    rising,
+    set_outputs,
+    sstop,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.process_image import (
+    ProcessImage,
+    ProcessImageScanner,
+)
+
+INPUT_MODULE = 0
+OUTPUT_MODULE = 1
+DOOR_OPEN = 3
+CLAMP_CLOSED = 4
+
+
+@pytest.fixture
+def axl(monkeypatch):
+    """Fixture providing an opened AXLWrapper over a zero-latency simulator, servo on"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    wrapper = AXLWrapper.get_instance()
+    wrapper.dll = SimulatedAXL(latency=LatencyModel.zero())
+    wrapper.open(7)
+    wrapper.servo_on(0, 1)
+    yield wrapper
+    AXLWrapper.reset_for_testing()
+
+
+@pytest.fixture
+def engine(axl):
+    """Engine over a hand-driven scanner of both DIO modules, axis 0 and AI 0"""
+    scanner = ProcessImageScanner(axl)
+    scanner.add_dio_module(INPUT_MODULE)
+    scanner.add_dio_module(OUTPUT_MODULE)
+    scanner.add_axis(0)
+    scanner.add_analog_inputs([0])
+    interlocks = InterlockEngine(scanner, axl)
+    interlocks.attach()
+    return interlocks
+
+
+def _image(timestamp: float, inputs: int = 0) -> ProcessImage:
+    """Minimal image with one input dword on the input module"""
+    return ProcessImage(
+        timestamp=timestamp,
+        dio_inputs={INPUT_MODULE: np.array([inputs], dtype=np.uint32)},
+        axis_motion={0: False},
+    )
+
+
+class TestInterlockCompiler:
+    """Test suite for the rule compiler"""
+
+    def test_rules_compile_to_flat_postfix(self):
+        """Expressions become one postfix program, rule results delimited by OP_RULE"""
+        program = compile_rules(
+            [
+                InterlockRule("door", di(0, 3) & in_motion(0), estop(0)),
+                InterlockRule("clamp", ~di(0, 4), sstop(0)),
+            ]
+        )
+
+        assert program.code == (
+            (OP_DI, 0, 3),
+            (OP_IN_MOTION, 0, 0),
+            (OP_AND, 0, 0),
+            (OP_RULE, 0, 0),
+            (OP_DI, 0, 4),
+            (OP_NOT, 0, 0),
+            (OP_RULE, 1, 0),
+        )
+
+    def test_slots_and_constants_are_allocated(self):
+        """Edges and timers get their own state slots, thresholds go to the constant table"""
+        program = compile_rules(
+            [
+                InterlockRule("edge", rising(di(0, 1)) | rising(di(0, 2)), estop(0)),
+                InterlockRule("hot", on_delay(ai_above(0, 4.5), 0.2), estop(0)),
+            ]
+        )
+
+        assert program.edge_slots == 2
+        assert program.timer_slots == 1
+        assert program.constants == (4.5, 0.2)
+
+
+class TestInterlockEngine:
+    """Test suite for rule evaluation and reactions"""
+
+    def test_door_open_stops_moving_axis(self, axl, engine):
+        """The stop is issued from the scan cycle that sees the door open"""
+        engine.add_rule(InterlockRule("door", di(INPUT_MODULE, DOOR_OPEN), estop(0)))
+        axl.move_start_vel(0, 100.0, 1000.0, 1000.0)
+        engine.scanner.scan_once()
+        assert axl.read_in_motion(0)
+
+        axl.dll.set_input(INPUT_MODULE, DOOR_OPEN, True)
+        engine.scanner.scan_once()
+
+        assert not axl.read_in_motion(0)
+        assert engine.get_status()["door"]["active"]
+        assert engine.get_status()["door"]["trips"] == 1
+
+    def test_active_stop_rule_blocks_new_moves(self, axl, engine):
+        """A move started while the rule holds is stopped on the next cycle"""
+        engine.add_rule(InterlockRule("clamp", ~di(INPUT_MODULE, CLAMP_CLOSED), sstop(0)))
+        engine.scanner.scan_once()
+        axl.dll.reset_counters()
+
+        axl.move_start_vel(0, 100.0, 1000.0, 1000.0)
+        engine.scanner.scan_once()  # Sees the axis moving
+        engine.scanner.scan_once()
+
+        assert axl.dll.call_counts["AxmMoveMultiSStop"] == 1
+        assert engine.get_status()["clamp"]["trips"] == 1
+
+    def test_output_rule_forces_and_releases(self, axl, engine):
+        """Forced outputs win over queued writes until the rule clears"""
+        axl.write_output_dword(OUTPUT_MODULE, 0, 0b1)
+        engine.add_rule(
+            InterlockRule(
+                "estop", di(INPUT_MODULE, DOOR_OPEN), set_outputs(OUTPUT_MODULE, {0: False})
+            )
+        )
+
+        axl.dll.set_input(INPUT_MODULE, DOOR_OPEN, True)
+        engine.scanner.scan_once()
+        assert not axl.dll.get_output(OUTPUT_MODULE, 0)  # Written directly by the rule
+
+        engine.scanner.queue_output(OUTPUT_MODULE, 0, True)
+        engine.scanner.scan_once()
+        assert not axl.dll.get_output(OUTPUT_MODULE, 0)
+
+        axl.dll.set_input(INPUT_MODULE, DOOR_OPEN, False)
+        engine.scanner.scan_once()
+        engine.scanner.queue_output(OUTPUT_MODULE, 0, True)
+        engine.scanner.scan_once()
+        assert axl.dll.get_output(OUTPUT_MODULE, 0)
+
+    def test_latched_rule_needs_reset(self, axl, engine):
+        """A latched rule holds after its condition clears until reset()"""
+        engine.add_rule(
+            InterlockRule("door", di(INPUT_MODULE, DOOR_OPEN), estop(0), latch=True)
+        )
+        door_open = 1 << DOOR_OPEN
+
+        assert engine.evaluate(_image(0.0, door_open)) == ["door"]
+        assert engine.evaluate(_image(0.1)) == ["door"]
+
+        engine.reset("door")
+        assert engine.evaluate(_image(0.2)) == []
+
+    def test_reset_before_trip_does_not_unlatch(self, axl, engine):
+        """A reset while inactive is ignored; the next trip still latches"""
+        engine.add_rule(
+            InterlockRule("door", di(INPUT_MODULE, DOOR_OPEN), estop(0), latch=True)
+        )
+
+        engine.reset("door")
+        assert engine.evaluate(_image(0.0, 1 << DOOR_OPEN)) == ["door"]
+        assert engine.evaluate(_image(0.1)) == ["door"]
+
+    def test_on_delay_and_rising_edge(self, axl, engine):
+        """Timers measure image time, edges fire for a single cycle"""
+        engine.add_rule(InterlockRule("held", on_delay(di(INPUT_MODULE, 0), 0.5), estop(0)))
+        engine.add_rule(InterlockRule("edge", rising(di(INPUT_MODULE, 1)), estop(0)))
+
+        assert engine.evaluate(_image(0.0, 0b11)) == ["edge"]
+        assert engine.evaluate(_image(0.4, 0b11)) == []
+        assert engine.evaluate(_image(0.5, 0b11)) == ["held"]
+        assert engine.evaluate(_image(0.6, 0b00)) == []
+
+    def test_rule_changes_keep_edge_and_timer_state(self, axl, engine):
+        """Adding or removing a rule neither re-fires edges nor restarts timers"""
+        engine.add_rule(InterlockRule("spare", rising(di(INPUT_MODULE, 2)), estop(0)))
+        engine.add_rule(InterlockRule("held", on_delay(di(INPUT_MODULE, 0), 0.5), estop(0)))
+        engine.add_rule(InterlockRule("edge", rising(di(INPUT_MODULE, 1)), estop(0)))
+        assert engine.evaluate(_image(0.0, 0b11)) == ["edge"]
+
+        engine.remove_rule("spare")  # Shifts the slots of the remaining rules
+        engine.add_rule(InterlockRule("door", di(INPUT_MODULE, DOOR_OPEN), estop(0)))
+
+        assert engine.evaluate(_image(0.1, 0b11)) == []
+        assert engine.evaluate(_image(0.5, 0b11)) == ["held"]
+
+    def test_rejected_stop_is_counted_and_reissued(self, axl, engine, monkeypatch):
+        """A stop the library rejects is logged as an error and retried next cycle"""
+        engine.add_rule(InterlockRule("door", di(INPUT_MODULE, DOOR_OPEN), estop(0)))
+        axl.move_start_vel(0, 100.0, 1000.0, 1000.0)
+        emergency_stop = axl.move_multi_emergency_stop
+        rejected = [AXT_RT_MOTION_INVALID_METHOD]
+
+        def first_stop_rejected(axes):
+            return rejected.pop() if rejected else emergency_stop(axes)
+
+        monkeypatch.setattr(axl, "move_multi_emergency_stop", first_stop_rejected)
+
+        axl.dll.set_input(INPUT_MODULE, DOOR_OPEN, True)
+        engine.scanner.scan_once()
+        assert axl.read_in_motion(0)
+        assert engine.get_stats()["action_errors"] == 1
+
+        engine.scanner.scan_once()
+        assert not axl.read_in_motion(0)
+        assert engine.get_stats()["action_errors"] == 1
+
+    def test_missed_scans_trip_the_stop_rules(self, axl, engine, monkeypatch):
+        """Without images the stop actions are issued after the missed-scan limit"""
+        engine.add_rule(InterlockRule("door", di(INPUT_MODULE, DOOR_OPEN), sstop(0)))
+        axl.move_start_vel(0, 100.0, 1000.0, 1000.0)
+        engine.scanner.scan_once()
+        axl.dll.reset_counters()
+
+        def broken_read(module_no, dword):
+            raise AXLError("bus error")
+
+        monkeypatch.setattr(axl, "read_input_dword", broken_read)
+        for _ in range(INTERLOCK_MAX_MISSED_SCANS + 2):
+            assert not engine.scanner.scan_once()
+
+        assert axl.dll.call_counts["AxmMoveMultiSStop"] == 1
+        assert engine.get_stats()["fail_safe_trips"] == 1
+        assert not engine.get_status()["door"]["active"]
+
+        monkeypatch.undo()
+        assert engine.scanner.scan_once()
+        assert engine.get_stats()["missed_scans"] == 0
+
+    def test_unscanned_io_is_rejected(self, engine):
+        """Rules may only read IO the scanner sweeps"""
+        with pytest.raises(AXLConfigurationError):
+            engine.add_rule(InterlockRule("axis", in_motion(5), estop(5)))
+        with pytest.raises(AXLConfigurationError):
+            engine.add_rule(InterlockRule("ai", ai_above(3, 1.0), estop(0)))
+        with pytest.raises(AXLConfigurationError):
+            engine.add_rule(InterlockRule("out", di(0, 0), set_outputs(INPUT_MODULE, {0: True})))
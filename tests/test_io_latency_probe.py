@@ -0,0 +1,131 @@
+"""
+Loopback IO Latency Probe Tests
+
+Tests for polling and interrupt edge timing over loopback wiring on the
+simulated AXL library, the latency histogram and IO point parsing.
+"""
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLError
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+    LatencyModel,
+    SimulatedAXL,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+from infrastructure.implementation.hardware.robot.ajinextek.error_codes import (
+    AXT_RT_DIO_INVALID_VALUE,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.io_latency_probe import (
+    IOPoint,
+    LatencyHistogram,
+    LoopbackProbe,
+)
+
+DIO_OUT = IOPoint("dio", 1, 0)
+DIO_IN = IOPoint("dio", 0, 0)
+DELAY = 0.002
+
+
+@pytest.fixture
+def axl(monkeypatch):
+    """Fixture providing an opened AXLWrapper over a zero-latency simulator"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    wrapper = AXLWrapper.get_instance()
+    wrapper.dll = SimulatedAXL(latency=LatencyModel.zero())
+    wrapper.open(7)
+    yield wrapper
+    AXLWrapper.reset_for_testing()
+
+
+class TestLoopbackProbe:
+    """Test suite for polling and interrupt timing"""
+
+    def test_polling_measures_wire_delay(self, axl):
+        axl.dll.wire_loopback(DIO_OUT, DIO_IN, delay=DELAY)
+        probe = LoopbackProbe(DIO_OUT, DIO_IN, axl=axl, settle=0.0)
+
+        histogram = probe.measure_polling(10)
+
+        assert (histogram.count, histogram.timeouts) == (10, 0)
+        assert DELAY <= histogram.percentile(50) < DELAY + 0.05
+        assert probe.get_stats()["polls"] > 10
+
+    def test_interrupt_measures_wire_delay(self, axl):
+        """Both edges interrupt; the callback is removed after the run"""
+        axl.dll.wire_loopback(DIO_OUT, DIO_IN, delay=DELAY)
+        probe = LoopbackProbe(DIO_OUT, DIO_IN, axl=axl, settle=0.0)
+
+        histogram = probe.measure_interrupt(10)
+
+        assert (histogram.count, histogram.timeouts) == (10, 0)
+        assert DELAY <= histogram.percentile(50) < DELAY + 0.05
+        assert axl.read_interrupt_status() == (0, 1)
+        assert not axl._interrupt_procs
+
+    def test_interrupt_on_input_past_the_first_dword(self, axl):
+        """The interrupt flag is matched within the input's 32-point group"""
+        axl.dll = SimulatedAXL(
+            latency=LatencyModel.zero(), dio_modules=[(0, 64, 0), (0, 0, 16)]
+        )
+        high_input = IOPoint("dio", 0, 40)
+        axl.dll.wire_loopback(DIO_OUT, high_input, delay=DELAY)
+        probe = LoopbackProbe(DIO_OUT, high_input, axl=axl, settle=0.0)
+
+        histogram = probe.measure_interrupt(4)
+
+        assert (histogram.count, histogram.timeouts) == (4, 0)
+        assert axl.read_interrupt_status() == (0, 1 << 8)
+        assert axl.dll._modules[0].rising_edges == axl.dll._modules[0].falling_edges == 0
+
+    def test_edge_mode_takes_one_edge_per_call(self, axl):
+        """AxdiInterruptEdgeSetBit accepts DOWN_EDGE(0) and UP_EDGE(1) only"""
+        assert axl.dll.AxdiInterruptEdgeSetBit(0, 0, 2, 1) == AXT_RT_DIO_INVALID_VALUE
+        with pytest.raises(AXLError):
+            axl.set_interrupt_edge(0, 0, "both")
+
+    def test_axis_output_to_dio_input(self, axl):
+        output = IOPoint("axis", 1, 1)
+        axl.dll.wire_loopback(output, DIO_IN, delay=DELAY)
+
+        histogram = LoopbackProbe(output, DIO_IN, axl=axl, settle=0.0).measure_interrupt(4)
+
+        assert (histogram.count, histogram.timeouts) == (4, 0)
+
+    def test_interrupt_needs_dio_input(self, axl):
+        probe = LoopbackProbe(DIO_OUT, IOPoint("axis", 0, 0), axl=axl)
+        with pytest.raises(ValueError):
+            probe.measure_interrupt(1)
+
+    def test_unwired_edges_time_out(self, axl):
+        probe = LoopbackProbe(DIO_OUT, DIO_IN, axl=axl, timeout=0.005, settle=0.0)
+
+        histogram = probe.measure_polling(4)
+
+        assert (histogram.count, histogram.timeouts) == (2, 2)  # Input stays low
+
+
+class TestLatencyHistogram:
+    """Test suite for histogram statistics and IO point parsing"""
+
+    def test_percentiles_and_bins(self):
+        histogram = LatencyHistogram("polling", [0.001] * 98 + [0.004, 0.010], timeouts=1)
+
+        summary = histogram.summary()
+        assert (summary["count"], summary["timeouts"]) == (100, 1)
+        assert summary["p50_ms"] == pytest.approx(1.0)
+        assert summary["p99_ms"] == pytest.approx(4.0)
+        assert summary["max_ms"] == pytest.approx(10.0)
+        assert sum(count for _, _, count in histogram.bins()) == 100
+        assert histogram.suggested_timeout(3.0) == pytest.approx(0.030)
+        assert "100 edges, 1 timeouts" in histogram.format()
+
+    def test_parse_io_point(self):
+        assert IOPoint.parse("axis:3:1") == IOPoint("axis", 3, 1)
+        with pytest.raises(ValueError):
+            IOPoint.parse("aio:0:0")
+        with pytest.raises(ValueError):
+            IOPoint.parse("dio:0")
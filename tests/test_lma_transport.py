@@ -0,0 +1,153 @@
+"""
+LMA MCU Transport Tests
+
+Tests for vectorized frame scanning, status-code response matching in the
+reader-thread transport and the LMAMCU commands running on it, against an
+emulated MCU port.
+"""
+
+# Standard library imports
+import struct
+import threading
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from infrastructure.implementation.hardware.mcu.lma import lma_mcu
+from infrastructure.implementation.hardware.mcu.lma.lma_mcu import LMAMCU
+from infrastructure.implementation.hardware.mcu.lma.transport import (
+    LMAFrameScanner,
+    LMATransport,
+    encode_frame,
+)
+
+
+def _temperature_frame(ir_temp: float, outside_temp: float) -> bytes:
+    return encode_frame(0x07, struct.pack(">II", int(ir_temp * 10), int(outside_temp * 10)))
+
+
+class FakeMCUPort:
+    """Emulated MCU: acknowledges each command with its own status code"""
+
+    def __init__(self, **settings):
+        self.settings = settings
+        self.timeout = settings.get("timeout", 1.0)
+        self.is_open = True
+        self.written = []
+        self.follow_ups = {}  # cmd -> extra frames sent after the ACK
+        self._rx = bytearray()
+        self._cond = threading.Condition()
+
+    def push(self, data: bytes) -> None:
+        with self._cond:
+            self._rx += data
+            self._cond.notify()
+
+    @property
+    def in_waiting(self) -> int:
+        with self._cond:
+            return len(self._rx)
+
+    def write(self, data: bytes) -> int:
+        self.written.append(bytes(data))
+        cmd = data[2]
+        if cmd == 0x07:
+            reply = _temperature_frame(52.5, 24.0)
+        else:
+            reply = encode_frame(cmd)
+        # Line noise before the reply
+        self.push(b"\x00\xff" + reply + self.follow_ups.get(cmd, b""))
+        return len(data)
+
+    def read(self, size: int = 1) -> bytes:
+        with self._cond:
+            if not self._rx:
+                self._cond.wait(self.timeout)
+            data = bytes(self._rx[:size])
+            del self._rx[:size]
+            return data
+
+    def close(self) -> None:
+        self.is_open = False
+
+
+class TestFrameScanner:
+    """Test suite for frame extraction"""
+
+    def test_frames_split_across_reads_and_noise(self):
+        scanner = LMAFrameScanner()
+        stream = b"\x13\x37" + encode_frame(0x05) + b"\xff" + _temperature_frame(40.5, 21.0)
+
+        frames = scanner.feed(stream[:9]) + scanner.feed(stream[9:])
+
+        assert frames == [encode_frame(0x05), _temperature_frame(40.5, 21.0)]
+        assert scanner.discarded == 3
+
+    def test_stx_pattern_inside_payload_is_not_a_frame(self):
+        payload = b"\xff\xff\xff\xf6" + b"\x00\x00\x00\x01"
+        scanner = LMAFrameScanner()
+
+        assert scanner.feed(encode_frame(0x07, payload)) == [encode_frame(0x07, payload)]
+
+    def test_bogus_stx_does_not_hold_back_a_later_frame(self):
+        """An FFFF whose length runs past the buffer is noise once a valid frame follows"""
+        scanner = LMAFrameScanner()
+
+        frames = scanner.feed(b"\xff\xff\x01\x0c" + encode_frame(0x0B))
+
+        assert frames == [encode_frame(0x0B)]
+        assert scanner.feed(b"") == []
+
+
+class TestTransport:
+    """Test suite for status-code matching"""
+
+    def test_response_matched_by_status_and_events_kept(self):
+        port = FakeMCUPort(timeout=1.0)
+        port.follow_ups[0x05] = encode_frame(0x0B)
+        transport = LMATransport(port)
+        transport.start()
+        try:
+            port.push(_temperature_frame(30.0, 20.0))  # Unsolicited, before the request
+            response = transport.request(encode_frame(0x05, b"\x00\x00\x01\x90"), timeout=1.0)
+            reached = transport.wait_for(0x0B, timeout=1.0)
+            missing = transport.wait_for(0x0D, timeout=0.05)
+        finally:
+            transport.stop()
+
+        assert response.raw == encode_frame(0x05)
+        assert reached.status == 0x0B
+        assert missing is None
+        assert transport.latest_temperature()[1:] == (30.0, 20.0)
+        assert port.timeout == 1.0  # Restored on stop
+
+
+class TestLMAMCUOnTransport:
+    """Test suite for LMAMCU commands over the transport"""
+
+    @pytest.mark.asyncio
+    async def test_commands_and_signals(self, monkeypatch):
+        ports = []
+
+        def open_port(**settings):
+            ports.append(FakeMCUPort(**settings))
+            return ports[-1]
+
+        monkeypatch.setattr(lma_mcu.serial, "Serial", open_port)
+        mcu = LMAMCU(port="COM9", baudrate=115200, timeout=1.0)
+        await mcu.connect()
+        try:
+            ports[0].push(encode_frame(0x00))  # Boot complete
+            await mcu.wait_boot_complete()
+
+            assert await mcu.get_temperature() == pytest.approx(52.5)
+
+            ports[0].follow_ups[0x05] = encode_frame(0x0B)
+            await mcu.set_operating_temperature(60.0)
+            assert mcu.get_cached_temperature() == pytest.approx(52.5)
+        finally:
+            await mcu.disconnect()
+
+        assert ports[0].written[-1] == encode_frame(0x05, struct.pack(">I", 600))
+        assert not ports[0].is_open
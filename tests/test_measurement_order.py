@@ -0,0 +1,143 @@
+"""
+Measurement Travel-Order Planner Tests
+
+Tests for the move-time and thermal cost models and the ordering of the
+temperature x position matrix, with axis limits read from the simulated AXL
+library.
+"""
+
+# Standard library imports
+from itertools import permutations
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+    LatencyModel,
+    SimulatedAXL,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+from infrastructure.implementation.hardware.robot.ajinextek.measurement_order import (
+    AxisLimits,
+    STEP_MOVE,
+    STEP_THERMAL,
+    ThermalModel,
+    plan_measurements,
+    read_axis_limits,
+)
+
+LIMITS = AxisLimits(velocity=100000.0, accel=85000.0, decel=85000.0)
+THERMAL = ThermalModel(heat_rate=1.0, cool_rate=0.2, settle_time=2.0)
+POSITIONS = [50000.0, 110000.0, 170000.0]
+
+
+@pytest.fixture
+def axl(monkeypatch):
+    """Fixture providing an opened AXLWrapper over a zero-latency simulator"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    wrapper = AXLWrapper.get_instance()
+    wrapper.dll = SimulatedAXL(latency=LatencyModel.zero())
+    wrapper.open(7)
+    yield wrapper
+    AXLWrapper.reset_for_testing()
+
+
+def _plan(temperatures, **kwargs):
+    options = dict(
+        limits=LIMITS,
+        thermal=THERMAL,
+        measure_time=1.0,
+        start_temperature=25.0,
+        start_position=1000.0,
+    )
+    options.update(kwargs)
+    return plan_measurements(temperatures, POSITIONS, **options)
+
+
+class TestCostModels:
+    """Test suite for the move and thermal cost models"""
+
+    def test_trapezoid_and_triangle(self):
+        """Long moves cruise, short moves never reach the velocity"""
+        limits = AxisLimits(velocity=100.0, accel=100.0, decel=100.0)
+
+        assert limits.move_time(1000.0) == pytest.approx(1.0 + 9.0 + 1.0)
+        assert limits.move_time(-25.0) == pytest.approx(1.0)
+        assert limits.move_time(0.0) == 0.0
+
+    def test_jerk_slows_ramps(self):
+        """S-curve jerk ramps lengthen the accel and decel phases"""
+        scurve = AxisLimits(100.0, 100.0, 100.0, accel_jerk=100.0, decel_jerk=100.0)
+
+        assert scurve.move_time(1000.0) == pytest.approx(2.0 + 8.0 + 2.0)
+
+    def test_thermal_rates(self):
+        """Heating and cooling use their own rates; no change costs nothing"""
+        assert THERMAL.transition_time(38.0, 52.0) == pytest.approx(14.0 + 2.0)
+        assert THERMAL.transition_time(52.0, 38.0) == pytest.approx(70.0 + 2.0)
+        assert THERMAL.transition_time(52.0, 52.0) == 0.0
+
+    def test_limits_from_driver(self, axl):
+        """Velocity is clamped to the axis maximum, jerk only counts in S-curve modes"""
+        axl.set_max_vel(0, 80000.0)
+        axl.set_accel_jerk(0, 40.0)
+        axl.set_decel_jerk(0, 60.0)
+
+        trapezoid = read_axis_limits(axl, 0, 100000.0, 85000.0, 85000.0)
+        axl.set_profile_mode(0, 3)
+        scurve = read_axis_limits(axl, 0, 100000.0, 85000.0, 85000.0)
+        axl.set_profile_mode(0, 8)  # ASYM_S_M3_SW_MODE
+        software_scurve = read_axis_limits(axl, 0, 100000.0, 85000.0, 85000.0)
+
+        assert trapezoid == AxisLimits(80000.0, 85000.0, 85000.0)
+        assert (scurve.accel_jerk, scurve.decel_jerk) == (40.0, 60.0)
+        assert software_scurve == scurve
+
+
+class TestPlanMeasurements:
+    """Test suite for the travel-order planner"""
+
+    def test_baseline_matches_nested_sequence(self):
+        """Without options the plan walks temperatures and positions as configured"""
+        plan = _plan([52.0, 38.0], reorder=False, allow_reverse=False, prepositioning=False)
+
+        assert plan.points == tuple((t, p) for t in (52.0, 38.0) for p in POSITIONS)
+        assert plan.timeline[-1].end == plan.total_time
+
+    def test_orders_temperatures_to_avoid_slow_cooling(self):
+        """With slow cooling the heating order goes up monotonically"""
+        plan = _plan([66.0, 38.0, 52.0])
+
+        assert plan.temperature_order == [38.0, 52.0, 66.0]
+
+    def test_reverses_alternate_sweeps(self):
+        """Consecutive sweeps alternate direction instead of travelling back"""
+        plan = _plan([38.0, 52.0], thermal=ThermalModel(heat_rate=1000.0, cool_rate=1000.0))
+
+        assert [reverse for _, reverse in plan.sweeps] == [False, True]
+        assert plan.points[2][1] == plan.points[3][1] == 170000.0
+
+    def test_prepositioning_overlaps_moves_with_thermal_waits(self):
+        """Moves run during temperature changes and the cycle gets shorter"""
+        plan = _plan([38.0, 52.0])
+        sequential = _plan([38.0, 52.0], prepositioning=False)
+
+        first_heat = next(s for s in plan.timeline if s.kind == STEP_THERMAL)
+        first_move = next(s for s in plan.timeline if s.kind == STEP_MOVE)
+        assert first_move.start == first_heat.start
+        assert plan.total_time < sequential.total_time
+
+    def test_exact_order_beats_every_fixed_order(self):
+        """The optimized plan is never slower than any configured order"""
+        temperatures = [66.0, 38.0, 52.0, 45.0]
+        best = _plan(temperatures, standby_temperature=38.0)
+
+        for order in permutations(temperatures):
+            fixed = _plan(list(order), standby_temperature=38.0, reorder=False)
+            assert best.total_time <= fixed.total_time + 1e-9
+
+    def test_empty_matrix(self):
+        with pytest.raises(ValueError):
+            _plan([])
@@ -0,0 +1,153 @@
+"""
+Multi-Axis Jog Controller Tests
+
+Tests for MultiAxisJogController against a recording AXL stand-in.
+"""
+
+# Standard library imports
+import time
+from typing import Any, List, Tuple
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from domain.exceptions.robot_exceptions import RobotMotionError
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    MULTI_VEL_SYNC_STOP,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.multi_axis_jog import (
+    MultiAxisJogController,
+)
+
+
+class RecordingAXL:
+    """Minimal AXLWrapper stand-in that records every call"""
+
+    def __init__(self) -> None:
+        self.calls: List[Tuple[str, Any]] = []
+
+    def override_set_max_vel(self, axis_no: int, max_vel: float) -> int:
+        self.calls.append(("override_set_max_vel", (axis_no, max_vel)))
+        return 0
+
+    def move_start_multi_vel(self, axes, velocities, accels, decels, sync_mode) -> int:
+        self.calls.append(("move_start_multi_vel", (axes, velocities, sync_mode)))
+        return 0
+
+    def override_multi_vel(self, axes, velocities) -> int:
+        self.calls.append(("override_multi_vel", (axes, velocities)))
+        return 0
+
+    def move_multi_stop(self, axes, decels) -> int:
+        self.calls.append(("move_multi_stop", (axes, decels)))
+        return 0
+
+    def move_multi_emergency_stop(self, axes) -> int:
+        self.calls.append(("move_multi_emergency_stop", (axes,)))
+        return 0
+
+    def names(self) -> List[str]:
+        return [name for name, _ in self.calls]
+
+
+@pytest.fixture
+def axl() -> RecordingAXL:
+    """Fixture providing a recording AXL stand-in"""
+    return RecordingAXL()
+
+
+@pytest.fixture
+def jog(axl: RecordingAXL) -> MultiAxisJogController:
+    """Fixture providing a jog controller with a fast watchdog"""
+    controller = MultiAxisJogController(axl, watchdog_period=0.005)
+    yield controller
+    controller.close()
+
+
+class TestMultiAxisJogGroup:
+    """Test suite for synchronized start/retarget/stop"""
+
+    def test_start_uses_single_group_call(self, jog: MultiAxisJogController, axl: RecordingAXL):
+        """All axes start through one AxmMoveStartMultiVelEx call"""
+        jog.start([0, 1], [10.0, -5.0], [100.0, 100.0], [100.0, 100.0])
+
+        assert axl.names().count("move_start_multi_vel") == 1
+        assert ("move_start_multi_vel", ([0, 1], [10.0, -5.0], MULTI_VEL_SYNC_STOP)) in axl.calls
+        assert jog.is_active
+
+    def test_retarget_and_stop(self, jog: MultiAxisJogController, axl: RecordingAXL):
+        """Retarget sends one override, stop sends one group stop"""
+        jog.start([0, 1], [10.0, -5.0], [100.0, 100.0], [50.0, 60.0], max_velocities=[20, 20])
+        jog.retarget([15.0, -8.0])
+        jog.stop()
+
+        assert ("override_multi_vel", ([0, 1], [15.0, 8.0])) in axl.calls
+        assert ("move_multi_stop", ([0, 1], [50.0, 60.0])) in axl.calls
+        assert not jog.is_active
+
+    def test_override_limit_written_once(self, jog: MultiAxisJogController, axl: RecordingAXL):
+        """Unchanged override limits are not re-sent on restart"""
+        for _ in range(3):
+            jog.start([0], [10.0], [100.0], [100.0])
+            jog.stop()
+
+        assert axl.names().count("override_set_max_vel") == 1
+
+    def test_retarget_rejects_direction_change(self, jog: MultiAxisJogController):
+        """Velocity overrides cannot reverse an axis"""
+        jog.start([0], [10.0], [100.0], [100.0])
+
+        with pytest.raises(ValueError):
+            jog.retarget([-10.0])
+
+    def test_retarget_rejects_direction_change_through_zero(
+        self, jog: MultiAxisJogController, axl: RecordingAXL
+    ):
+        """Every velocity is checked against the start direction, not the last one"""
+        jog.start([0, 1], [5.0, 0.0], [100.0, 100.0], [100.0, 100.0])
+
+        for velocities in ([0.0, 0.0], [-5.0, 0.0], [5.0, 3.0]):
+            with pytest.raises(ValueError):
+                jog.retarget(velocities)
+        jog.retarget([2.0, 0.0])
+
+        assert axl.calls[-1] == ("override_multi_vel", ([0, 1], [2.0, 0.0]))
+
+    def test_second_start_rejected(self, jog: MultiAxisJogController):
+        """Only one jog group may run at a time"""
+        jog.start([0], [10.0], [100.0], [100.0])
+
+        with pytest.raises(RobotMotionError):
+            jog.start([1], [10.0], [100.0], [100.0])
+
+
+class TestMultiAxisJogDeadman:
+    """Test suite for deadman keepalive supervision"""
+
+    def test_deadman_stops_when_keepalive_lapses(
+        self, jog: MultiAxisJogController, axl: RecordingAXL
+    ):
+        """Group is stopped automatically once keepalives stop"""
+        jog.start_deadman([0, 1], [10.0, 10.0], [100.0, 100.0], [100.0, 100.0], timeout=0.05)
+
+        deadline = time.monotonic() + 2.0
+        while jog.is_active and time.monotonic() < deadline:
+            time.sleep(0.01)
+
+        assert not jog.is_active
+        assert jog.deadman_tripped
+        assert "move_multi_stop" in axl.names()
+
+    def test_keepalive_keeps_group_running(
+        self, jog: MultiAxisJogController, axl: RecordingAXL
+    ):
+        """Regular keepalives prevent the deadman stop"""
+        jog.start_deadman([0], [10.0], [100.0], [100.0], timeout=0.1)
+
+        for _ in range(10):
+            time.sleep(0.02)
+            jog.keepalive()
+
+        assert jog.is_active
+        assert "move_multi_stop" not in axl.names()
@@ -0,0 +1,97 @@
+"""
+Peak Tracker Tests
+
+Tests for streaming peak and extremum tracking per armed measurement
+window, and for mapping the peak time to an axis position.
+"""
+
+# Standard library imports
+import math
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from infrastructure.implementation.hardware.common.peak_tracker import PeakTracker
+from infrastructure.implementation.hardware.common.sample_ring import TimestampedRing
+
+
+class FakeStream:
+    """Sample stream with BS205StreamReader's listener interface"""
+
+    def __init__(self):
+        self.listeners = []
+
+    def add_listener(self, listener):
+        self.listeners.append(listener)
+
+    def emit(self, timestamp, value):
+        for listener in self.listeners:
+            listener(timestamp, value)
+
+
+class FakePositionSampler:
+    """PositionSampler stand-in exposing one (cmd, act) ring"""
+
+    def __init__(self, ring):
+        self.ring = ring
+
+    def get_ring(self, axis):
+        return self.ring
+
+
+class TestPeakTracker:
+    """Test suite for armed peak tracking"""
+
+    def test_samples_outside_the_window_are_ignored(self):
+        stream = FakeStream()
+        tracker = PeakTracker()
+        tracker.attach(stream)
+
+        stream.emit(1.0, 9.0)  # Before arming
+        tracker.arm()
+        for timestamp, value in [(2.0, 1.0), (2.1, -3.5), (2.2, 2.5)]:
+            stream.emit(timestamp, value)
+        result = tracker.disarm()
+        stream.emit(3.0, 9.0)  # After disarming
+
+        assert result.count == 3
+        assert (result.peak, result.peak_time) == (-3.5, 2.1)
+        assert (result.maximum, result.maximum_time) == (2.5, 2.2)
+        assert (result.minimum, result.minimum_time) == (-3.5, 2.1)
+        assert result.end is not None
+        assert tracker.result() == result
+
+    def test_reset_and_rearm_start_a_new_window(self):
+        tracker = PeakTracker()
+        assert not tracker.disarm().valid
+
+        tracker.arm()
+        tracker.update(1.0, 5.0)
+        tracker.reset()
+        tracker.update(1.1, 2.0)
+        assert tracker.is_armed
+        assert tracker.result().peak == 2.0
+
+        tracker.arm()
+        result = tracker.result()
+        assert result.count == 0
+        assert math.isnan(result.peak)
+
+    def test_peak_time_maps_to_axis_position(self):
+        ring = TimestampedRing(16, 2)
+        ring.append(10.0, (100.0, 99.0))
+        ring.append(10.2, (120.0, 118.0))
+        tracker = PeakTracker(position_sampler=FakePositionSampler(ring), axis=0)
+
+        tracker.arm()
+        tracker.update(10.05, 1.0)
+        tracker.update(10.15, 4.0)
+        result = tracker.disarm()
+
+        assert result.cmd_position == pytest.approx(115.0)
+        assert result.act_position == pytest.approx(113.25)
+
+    def test_position_sampler_needs_an_axis(self):
+        with pytest.raises(ValueError):
+            PeakTracker(position_sampler=FakePositionSampler(TimestampedRing(4, 2)))
@@ -0,0 +1,157 @@
+"""
+Coherent Position Sampler Tests
+
+Tests for AxmStatusReadMotionInfo snapshots, coherent (cmd, act) capture
+with derived velocity and following error, and the fallback to separate
+position reads, against the simulated AXL library.
+"""
+
+# Standard library imports
+import time
+
+# Third-party imports
+import numpy as np
+import pytest
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLFunctionNotAvailableError
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+    LatencyModel,
+    SimulatedAXL,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import (
+    MOTION_INFO,
+    AXLWrapper,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.constants import (
+    MECH_SIG_INPOS,
+    MOTION_INFO_ACT_POS,
+    MOTION_INFO_CMD_POS,
+    MOTION_INFO_MECH_SIG,
+    MOTION_INFO_UNIV_IO,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.position_sampler import (
+    PositionSampler,
+)
+
+
+@pytest.fixture
+def axl(monkeypatch):
+    """Fixture providing an opened AXLWrapper over a zero-latency simulator"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    wrapper = AXLWrapper.get_instance()
+    wrapper.dll = SimulatedAXL(latency=LatencyModel.zero())
+    wrapper.open(7)
+    wrapper.servo_on(0, 1)
+    yield wrapper
+    AXLWrapper.reset_for_testing()
+
+
+def _capture_move(axl, sampler, samples: int = 40) -> None:
+    """Sample axis 0 through the constant-velocity part of a 500 unit/s move"""
+    axl.move_start_pos(0, 1000.0, 500.0, 100000.0, 100000.0)
+    for _ in range(samples):
+        sampler.sample_once()
+        time.sleep(0.003)
+
+
+class TestMotionInfo:
+    """Test suite for the AxmStatusReadMotionInfo wrapper call"""
+
+    def test_mask_selects_fields(self, axl):
+        axl.set_act_pos(0, 5.0)
+        info = MOTION_INFO()
+        info.dActPos = -1.0
+        info.dwMask = MOTION_INFO_CMD_POS | MOTION_INFO_MECH_SIG
+
+        axl.status_read_motion_info(0, info)
+
+        assert info.dCmdPos == 0.0
+        assert info.dActPos == -1.0  # Not selected
+        assert info.dwMechSig & MECH_SIG_INPOS
+
+        info.dwMask = MOTION_INFO_ACT_POS
+        axl.status_read_motion_info(0, info)
+        assert info.dActPos == 5.0
+
+    def test_layout_matches_axhs_header(self, axl):
+        """Two doubles and five DWORDs; mask 0x10 reads both universal signal words"""
+        assert [name for name, _ in MOTION_INFO._fields_] == [
+            "dCmdPos",
+            "dActPos",
+            "dwMechSig",
+            "dwDrvStat",
+            "dwInput",
+            "dwOutput",
+            "dwMask",
+        ]
+        axl.dll.set_universal_input(0, 2, True)
+        axl.write_universal_output(0, 0x5)
+        info = MOTION_INFO()
+        info.dwMask = MOTION_INFO_UNIV_IO
+
+        axl.status_read_motion_info(0, info)
+
+        assert (info.dwInput, info.dwOutput) == (0x4, 0x5)
+
+
+class TestPositionSampler:
+    """Test suite for coherent capture and derived kinematics"""
+
+    def test_velocity_and_following_error(self, axl):
+        """The actual position trails by velocity x lag; one call per pair"""
+        axl.dll.set_following_lag(0, 0.01)
+        sampler = PositionSampler(axl)
+        sampler.add_axis(0)
+
+        _capture_move(axl, sampler)
+        k = sampler.kinematics(0)
+
+        assert len(k["time"]) == 40
+        assert np.median(k["cmd_vel"]) == pytest.approx(500.0, rel=0.02)
+        assert np.median(k["following_error"]) == pytest.approx(5.0, rel=0.02)
+        assert axl.dll.call_counts["AxmStatusReadMotionInfo"] == 40
+        assert axl.dll.call_counts.get("AxmStatusGetCmdPos", 0) == 0
+        assert sampler.get_statistics()["coherent"]
+
+    def test_fallback_to_separate_reads(self, axl, monkeypatch):
+        def missing(axis_no, info):
+            raise AXLFunctionNotAvailableError("AxmStatusReadMotionInfo not available")
+
+        monkeypatch.setattr(axl, "status_read_motion_info", missing)
+        sampler = PositionSampler(axl)
+        sampler.add_axis(0)
+
+        sampler.sample_once()
+        sampler.sample_once()
+
+        stats = sampler.get_statistics()
+        assert not stats["coherent"]
+        assert stats["axes"][0]["samples"] == 2
+        assert axl.dll.call_counts["AxmStatusGetActPos"] == 2
+
+    def test_single_sample_and_unknown_axis(self, axl):
+        sampler = PositionSampler(axl)
+        sampler.add_axis(0)
+        sampler.sample_once()
+
+        k = sampler.kinematics(0)
+
+        assert list(k["cmd_vel"]) == [0.0]
+        with pytest.raises(ValueError):
+            sampler.kinematics(1)
+
+    def test_thread_samples_at_period(self, axl):
+        sampler = PositionSampler(axl, period=0.005)
+        sampler.add_axis(0)
+        sampler.add_axis(1)
+
+        sampler.start()
+        time.sleep(0.2)
+        sampler.stop()
+
+        stats = sampler.get_statistics()
+        assert 20 <= stats["axes"][0]["samples"] <= 45
+        assert stats["axes"][0]["samples"] == stats["axes"][1]["samples"]
+        assert not sampler.is_running
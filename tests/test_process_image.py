@@ -0,0 +1,136 @@
+"""
+Process Image Scanner Tests
+
+Tests for the cyclic process image over DIO, axis universal IO and analog
+inputs, run against the simulated AXL library with cycles driven by hand.
+"""
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+    LatencyModel,
+    SimulatedAXL,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+from infrastructure.implementation.hardware.robot.ajinextek.process_image import (
+    ProcessImageScanner,
+)
+
+INPUT_MODULE = 0
+OUTPUT_MODULE = 1
+
+
+@pytest.fixture
+def axl(monkeypatch):
+    """Fixture providing an opened AXLWrapper over a zero-latency simulator"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    wrapper = AXLWrapper.get_instance()
+    wrapper.dll = SimulatedAXL(latency=LatencyModel.zero())
+    wrapper.open(7)
+    yield wrapper
+    AXLWrapper.reset_for_testing()
+
+
+@pytest.fixture
+def scanner(axl):
+    """Scanner over both DIO modules, axis 0 and analog inputs 0-1"""
+    service = ProcessImageScanner(axl)
+    service.add_dio_module(INPUT_MODULE)
+    service.add_dio_module(OUTPUT_MODULE)
+    service.add_axis(0)
+    service.add_analog_inputs([0, 1])
+    axl.dll.reset_counters()
+    return service
+
+
+class TestProcessImageScanner:
+    """Test suite for the process image scanner"""
+
+    def test_image_reflects_all_sources(self, axl, scanner):
+        """One cycle captures DIO, universal inputs and analog inputs"""
+        axl.dll.set_input(INPUT_MODULE, 3, True)
+        axl.dll.set_universal_input(0, 1, True)
+        axl.dll.set_analog_input(1, 2.5)
+
+        assert scanner.scan_once()
+        image = scanner.image
+
+        assert image.cycle == 1
+        assert image.input_bit(INPUT_MODULE, 3)
+        assert not image.input_bit(INPUT_MODULE, 4)
+        assert image.axis_input_bit(0, 1)
+        assert image.analog(1) == pytest.approx(2.5)
+
+    def test_one_sweep_per_cycle(self, axl, scanner):
+        """A cycle costs a fixed set of driver calls, independent of readers"""
+        scanner.scan_once()
+        for _ in range(100):
+            scanner.image.input_bit(INPUT_MODULE, 0)
+
+        assert axl.dll.call_counts == {
+            "AxdiReadInportDword": 1,
+            "AxdoReadOutportDword": 1,
+            "AxmSignalReadInput": 1,
+            "AxmSignalReadOutput": 1,
+            "AxmStatusReadInMotion": 1,
+            "AxaiSwReadMultiVoltage": 1,
+        }
+
+    def test_queued_outputs_flush_once_per_cycle(self, axl, scanner):
+        """Queued bits of one dword are merged into a single write"""
+        scanner.scan_once()
+        axl.dll.reset_counters()
+
+        scanner.queue_outputs(OUTPUT_MODULE, {4: True, 5: True, 6: False})
+        scanner.queue_output(OUTPUT_MODULE, 6, True)
+        scanner.queue_axis_output(0, 2, True)
+        assert not axl.dll.get_output(OUTPUT_MODULE, 4)  # Nothing written before the cycle
+
+        scanner.scan_once()
+
+        assert axl.dll.call_counts["AxdoWriteOutportDword"] == 1
+        assert axl.dll.call_counts["AxmSignalWriteOutput"] == 1
+        assert [axl.dll.get_output(OUTPUT_MODULE, pin) for pin in (4, 5, 6)] == [True] * 3
+        assert scanner.image.output_bit(OUTPUT_MODULE, 6)
+        assert scanner.image.axis_output_bit(0, 2)
+
+    def test_unchanged_output_is_not_written(self, axl, scanner):
+        """Queueing the current level costs no write"""
+        scanner.scan_once()
+        axl.dll.reset_counters()
+
+        scanner.queue_output(OUTPUT_MODULE, 0, False)
+        scanner.scan_once()
+
+        assert "AxdoWriteOutportDword" not in axl.dll.call_counts
+
+    def test_double_buffer_keeps_front_stable(self, axl, scanner):
+        """The published image does not change while the next one is scanned"""
+        scanner.scan_once()
+        front = scanner.image
+        snapshot = scanner.snapshot()
+
+        axl.dll.set_input(INPUT_MODULE, 0, True)
+        scanner.scan_once()
+
+        assert not front.input_bit(INPUT_MODULE, 0)
+        assert scanner.image.input_bit(INPUT_MODULE, 0)
+        assert scanner.image is not front
+        assert snapshot.cycle == 1
+
+    def test_background_scan(self, axl):
+        """The scan thread publishes cycles and flushes queued writes on stop"""
+        scanner = ProcessImageScanner(axl, scan_period=0.002)
+        scanner.add_dio_module(OUTPUT_MODULE)
+        scanner.start()
+        try:
+            assert scanner.wait_cycle(timeout=1.0)
+            scanner.queue_output(OUTPUT_MODULE, 7, True)
+        finally:
+            scanner.stop()
+
+        assert axl.dll.get_output(OUTPUT_MODULE, 7)
+        assert scanner.get_stats()["cycles"] >= 2
@@ -0,0 +1,156 @@
+"""
+Recipe Plan Cache Tests
+
+Tests for compiling recipes into hardware artifacts, the content-addressed
+mmap plan files and uploading a plan to the simulated AXL library.
+"""
+
+# Standard library imports
+from dataclasses import replace
+import mmap
+
+# Third-party imports
+import numpy as np
+import pytest
+
+# Local application imports
+from domain.exceptions.robot_exceptions import AXLConfigurationError
+from domain.value_objects.hardware_config import HardwareConfig
+from domain.value_objects.test_configuration import TestConfiguration as RecipeConfiguration
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+    LatencyModel,
+    SimulatedAXL,
+)
+from infrastructure.implementation.hardware.robot.ajinextek import recipe_plan
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+from infrastructure.implementation.hardware.robot.ajinextek.recipe_plan import (
+    PLAN_PHASE_FAIL,
+    PLAN_PHASE_READY,
+    RecipePlanCache,
+    compile_plan,
+    map_plan_file,
+    upload_plan,
+    write_plan_file,
+)
+
+
+@pytest.fixture
+def recipe():
+    """Two temperatures, two stroke positions"""
+    return RecipeConfiguration(
+        temperature_list=[38.0, 52.0],
+        stroke_positions=[150000.0, 170000.0],
+    )
+
+
+@pytest.fixture
+def axl(monkeypatch):
+    """Fixture providing an opened AXLWrapper over a zero-latency simulator"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    wrapper = AXLWrapper.get_instance()
+    wrapper.dll = SimulatedAXL(latency=LatencyModel.zero())
+    wrapper.open(7)
+    yield wrapper
+    AXLWrapper.reset_for_testing()
+
+
+class TestRecipePlan:
+    """Test suite for the recipe plan compiler and cache"""
+
+    def test_compile_artifacts(self, recipe):
+        """The plan holds the stroke order, triggers, torque points and DIO maps"""
+        hardware = HardwareConfig()
+        plan = compile_plan(recipe, hardware, contact_torque_limit=120.0)
+
+        assert plan.sequence[:, 0].tolist() == [150000.0, 170000.0, 1000.0] * 2
+        assert plan.sequence[0, 1:].tolist() == [
+            recipe.velocity,
+            recipe.acceleration,
+            recipe.deceleration,
+            0.0,
+        ]
+        assert plan.triggers.tolist() == [
+            [150000.0, 0.0, 1.0, 1000.0],
+            [170000.0, 0.0, 1.0, 1000.0],
+        ]
+        assert plan.torque_schedule.tolist() == [
+            [1000.0, 300.0, 300.0],
+            [150000.0, 120.0, 120.0],
+        ]
+        dio = hardware.digital_io
+        assert plan.dio_outputs(PLAN_PHASE_READY)[dio.tower_lamp_green] is True
+        assert plan.dio_outputs(PLAN_PHASE_FAIL)[dio.tower_lamp_red] is True
+
+    def test_cache_maps_instead_of_recompiling(self, tmp_path, recipe):
+        """A second cache instance maps the existing file without compiling"""
+        hardware = HardwareConfig()
+        first = RecipePlanCache(tmp_path).load(recipe, hardware)
+
+        cache = RecipePlanCache(tmp_path)
+        plan = cache.load(recipe, hardware)
+
+        assert cache.get_stats()["compiles"] == 0
+        assert plan.digest == first.digest
+        assert not plan.sequence.flags.writeable  # mmap view, not a copy
+        np.testing.assert_array_equal(plan.sequence, first.sequence)
+
+    def test_recipe_change_recompiles(self, tmp_path, recipe):
+        """Any recipe change produces a new content address"""
+        cache = RecipePlanCache(tmp_path)
+        hardware = HardwareConfig()
+        first = cache.load(recipe, hardware)
+
+        second = cache.load(replace(recipe, stroke_positions=[160000.0]), hardware)
+
+        assert second.digest != first.digest
+        assert cache.get_stats()["compiles"] == 2
+        assert len(list(tmp_path.glob("*.plan"))) == 2
+
+    def test_corrupt_plan_file_is_replaced(self, tmp_path, recipe):
+        """A damaged file is rejected on mapping and recompiled by the cache"""
+        hardware = HardwareConfig()
+        plan = RecipePlanCache(tmp_path).load(recipe, hardware)
+        path = RecipePlanCache(tmp_path).path_for(plan.digest)
+        path.write_bytes(b"JUNK" + path.read_bytes()[4:])
+
+        with pytest.raises(AXLConfigurationError):
+            map_plan_file(path)
+
+        cache = RecipePlanCache(tmp_path)
+        assert cache.load(recipe, hardware).digest == plan.digest
+        assert cache.get_stats()["compiles"] == 1
+
+    def test_rejected_plan_file_is_unmapped(self, tmp_path, recipe, monkeypatch):
+        """A rejected file is unmapped before it is replaced (required on Windows)"""
+        path = RecipePlanCache(tmp_path).path_for("stale")
+        write_plan_file(compile_plan(recipe, HardwareConfig()), path)
+        mappings = []
+        original = mmap.mmap
+
+        def tracked_mmap(*args, **kwargs):
+            mappings.append(original(*args, **kwargs))
+            return mappings[-1]
+
+        monkeypatch.setattr(recipe_plan.mmap, "mmap", tracked_mmap)
+
+        with pytest.raises(AXLConfigurationError):
+            map_plan_file(path, expected_digest="0" * 64)
+
+        assert len(mappings) == 1 and mappings[0].closed
+
+    def test_upload_to_controller(self, tmp_path, recipe, axl):
+        """Uploading pushes nodes, triggers and torque switch points to the library"""
+        plan = RecipePlanCache(tmp_path).load(recipe, HardwareConfig(), contact_torque_limit=120.0)
+
+        counts = upload_plan(axl, plan, seq_map_no=1, counter_module=0)
+
+        assert counts == {"sequence_nodes": 6, "triggers": 2, "torque_points": 2}
+        sim = axl.dll
+        assert sim.get_seq_nodes(1) == [tuple(node) for node in plan.sequence.tolist()]
+        assert sim.get_trigger_positions(0) == [150000.0, 170000.0]
+        assert sim.get_counter_triggers(0) == [
+            (150000.0, 0.0, 1, 1000.0),
+            (170000.0, 0.0, 1, 1000.0),
+        ]
+        assert sim.get_torque_at_pos(0)[150000.0] == (120.0, 120.0, 0)
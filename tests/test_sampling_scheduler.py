@@ -0,0 +1,171 @@
+"""
+Multi-Rate Sampling Scheduler Tests
+
+Tests for EDF scheduling, harmonic alignment, coalesced driver sweeps,
+idle-axis slowdown and the odometry task against the simulated AXL library.
+"""
+
+# Standard library imports
+import time
+
+# Third-party imports
+import pytest
+
+# Local application imports
+from infrastructure.implementation.hardware.robot.ajinextek.axl_simulator import (
+    LatencyModel,
+    SimulatedAXL,
+)
+from infrastructure.implementation.hardware.robot.ajinextek.axl_wrapper import AXLWrapper
+from infrastructure.implementation.hardware.robot.ajinextek.flash_store import BoardFlashStore
+from infrastructure.implementation.hardware.robot.ajinextek.sampling_scheduler import (
+    AxisOdometer,
+    SamplingScheduler,
+)
+
+TICK = 0.005
+
+
+@pytest.fixture
+def axl(monkeypatch):
+    """Fixture providing an opened AXLWrapper over a zero-latency simulator"""
+    monkeypatch.setenv("AXL_SIMULATOR", "true")
+    AXLWrapper.reset_for_testing()
+    wrapper = AXLWrapper.get_instance()
+    wrapper.dll = SimulatedAXL(latency=LatencyModel.zero())
+    wrapper.dll.flash_write_time = 0.0
+    wrapper.open(7)
+    yield wrapper
+    AXLWrapper.reset_for_testing()
+
+
+def _run_ticks(scheduler: SamplingScheduler, ticks: int) -> None:
+    """Drive the scheduler tick by tick on a synthetic clock"""
+    for tick in range(ticks):
+        scheduler.run_due(scheduler.origin + tick * TICK)
+
+
+class TestScheduling:
+    """Test suite for rates, alignment and coalescing"""
+
+    def test_rates_and_harmonic_alignment(self, axl):
+        """Harmonic tasks fall due on shared ticks: one wake-up per fast-task tick"""
+        scheduler = SamplingScheduler(axl, tick=TICK)
+        runs = {"fast": [], "slow": []}
+        scheduler.add_task("fast", lambda s: runs["fast"].append(s.tick), 0.01)
+        scheduler.add_task("slow", lambda s: runs["slow"].append(s.tick), 0.05)
+
+        _run_ticks(scheduler, 40)
+
+        assert runs["fast"] == list(range(0, 40, 2))
+        assert runs["slow"] == [0, 10, 20, 30]
+        assert scheduler.get_stats()["wakeups"] == len(runs["fast"])
+
+    def test_same_tick_reads_are_coalesced(self, axl):
+        """Tasks due together share one sweep; each distinct read is issued once"""
+        scheduler = SamplingScheduler(axl, tick=TICK)
+        seen = []
+        scheduler.add_task(
+            "status",
+            lambda s: seen.append(s.get("get_cmd_pos", 0)),
+            0.01,
+            reads=[("get_cmd_pos", 0), ("read_servo_alarm", 0)],
+        )
+        scheduler.add_task(
+            "alarm",
+            lambda s: seen.append(s.get("read_servo_alarm", 0)),
+            0.01,
+            reads=[("read_servo_alarm", 0)],
+        )
+        before = axl.dll.call_counts.get("AxmSignalReadServoAlarm", 0)
+
+        scheduler.run_due(scheduler.origin)
+
+        stats = scheduler.get_stats()
+        assert (stats["sweeps"], stats["reads_requested"], stats["reads_issued"]) == (1, 3, 2)
+        assert axl.dll.call_counts.get("AxmSignalReadServoAlarm", 0) - before == 1
+        assert seen == [0.0, False]
+
+    def test_failed_read_only_fails_its_tasks(self, axl):
+        scheduler = SamplingScheduler(axl, tick=TICK)
+        ok = []
+        scheduler.add_task("bad", lambda s: s.get("get_cmd_pos", 99), 0.01, [("get_cmd_pos", 99)])
+        scheduler.add_task("good", lambda s: ok.append(s.tick), 0.01)
+
+        _run_ticks(scheduler, 4)
+
+        tasks = scheduler.get_stats()["tasks"]
+        assert tasks["bad"]["errors"] == 2
+        assert ok == [0, 2]
+
+    def test_overrun_resynchronizes(self, axl):
+        """A late scheduler runs each task once and does not burst to catch up"""
+        scheduler = SamplingScheduler(axl, tick=TICK)
+        ticks = []
+        scheduler.add_task("fast", lambda s: ticks.append(s.tick), 0.01)
+
+        scheduler.run_due(scheduler.origin)
+        scheduler.run_due(scheduler.origin + 20 * TICK)
+        scheduler.run_due(scheduler.origin + 21 * TICK)
+        scheduler.run_due(scheduler.origin + 22 * TICK)
+
+        assert ticks == [0, 20, 22]
+        assert scheduler.get_stats()["late_ticks"] == 1
+
+    def test_thread_runs_tasks(self, axl):
+        scheduler = SamplingScheduler(axl, tick=TICK)
+        runs = []
+        scheduler.add_task("fast", lambda s: runs.append(s.now), 0.02)
+        scheduler.add_task("slow", lambda s: None, 0.1)
+
+        scheduler.start()
+        time.sleep(0.3)
+        scheduler.stop()
+
+        assert 8 <= len(runs) <= 17
+        assert scheduler.get_stats()["wakeups"] <= len(runs) + 1
+        assert not scheduler.is_running
+
+
+class TestIdleAxes:
+    """Test suite for idle-axis slowdown"""
+
+    def test_idle_axis_is_sampled_slower(self, axl):
+        scheduler = SamplingScheduler(axl, tick=TICK, idle_after=0.05)
+        ticks = []
+        scheduler.add_task("axis0", lambda s: ticks.append(s.tick), 0.01, axis_no=0)
+
+        _run_ticks(scheduler, 60)
+
+        gaps = [b - a for a, b in zip(ticks, ticks[1:])]
+        assert gaps[:4] == [2, 2, 2, 2]
+        assert gaps[-1] == 20
+        assert scheduler.get_stats()["tasks"]["axis0"]["idle"]
+
+    def test_motion_restores_full_rate(self, axl):
+        scheduler = SamplingScheduler(axl, tick=TICK, idle_after=0.0)
+        scheduler.add_task("axis0", lambda s: None, 0.01, axis_no=0, idle_period=0.5)
+        scheduler.run_due(time.monotonic() + 0.01)
+        assert scheduler.get_stats()["tasks"]["axis0"]["period_ms"] == pytest.approx(500.0)
+
+        scheduler.notify_motion(0)
+
+        assert scheduler.get_stats()["tasks"]["axis0"]["period_ms"] == pytest.approx(10.0)
+
+
+class TestAxisOdometer:
+    """Test suite for the odometry task"""
+
+    def test_distance_moves_and_persistence(self, axl):
+        store = BoardFlashStore(axl, write_interval=0.0)
+        store.mount()
+        scheduler = SamplingScheduler(axl, tick=TICK)
+        odometer = AxisOdometer(0, store=store, persist_interval=0.0)
+        scheduler.add_task("odometer", odometer, 0.01, odometer.reads)
+
+        for tick, position in enumerate([0.0, 10.0, 25.0, 25.0, 25.0, 20.0, 20.0]):
+            axl.set_act_pos(0, position)
+            scheduler.run_due(scheduler.origin + tick * 2 * TICK)
+
+        assert (odometer.distance, odometer.moves) == (30.0, 2)
+        assert AxisOdometer(0, store=store).distance == 30.0
@@ -0,0 +1,264 @@
+"""
+Serial Reactor Tests
+
+Tests for terminator framing and the single-thread serial reactor:
+per-port request/response matching, deadlines, listeners and instrument
+frame scanners as framing plugins, against devices emulated on
+pseudo-terminals (select backend) and in memory (reader thread backend).
+"""
+
+# Standard library imports
+import os
+import sys
+import threading
+import time
+
+# Third-party imports
+import pytest
+import serial
+
+# Local application imports
+from driver.serial.exceptions import SerialTimeoutError
+from driver.serial.reactor import SerialReactor, TerminatorFramer
+from infrastructure.implementation.hardware.mcu.lma.transport import (
+    LMAFrameScanner,
+    encode_frame,
+)
+
+needs_pty = pytest.mark.skipif(sys.platform == "win32", reason="needs pseudo-terminals")
+
+
+class PtyDevice:
+    """Device emulated on the master side of a pty; the slave opens as a pyserial port"""
+
+    def __init__(self, respond):
+        # Standard library imports
+        import tty
+
+        self._respond = respond  # bytes received -> bytes to answer
+        self._master, slave = os.openpty()
+        tty.setraw(slave)
+        self.port = serial.Serial(os.ttyname(slave), 115200)
+        os.close(slave)
+        self._thread = threading.Thread(target=self._run, daemon=True)
+        self._thread.start()
+
+    def _run(self) -> None:
+        while True:
+            try:
+                data = os.read(self._master, 1024)
+            except OSError:
+                return
+            reply = self._respond(data)
+            if reply:
+                os.write(self._master, reply)
+
+    def close(self) -> None:
+        self.port.close()
+        os.close(self._master)
+
+
+class MemoryDevice:
+    """In-memory port without fileno(), as seen by the reactor on Windows"""
+
+    def __init__(self, respond):
+        self.timeout = None
+        self._respond = respond
+        self._rx = bytearray()
+        self._cond = threading.Condition()
+
+    @property
+    def in_waiting(self) -> int:
+        with self._cond:
+            return len(self._rx)
+
+    def write(self, data: bytes) -> int:
+        with self._cond:
+            self._rx += self._respond(data)
+            self._cond.notify()
+        return len(data)
+
+    def read(self, size: int = 1) -> bytes:
+        with self._cond:
+            if not self._rx:
+                self._cond.wait(self.timeout)
+            data = bytes(self._rx[:size])
+            del self._rx[:size]
+            return data
+
+
+@pytest.fixture
+def reactor():
+    instance = SerialReactor()
+    instance.start()
+    yield instance
+    instance.close()
+
+
+class TestTerminatorFramer:
+    """Test suite for terminator framing"""
+
+    def test_frames_split_across_reads(self):
+        framer = TerminatorFramer(b"\r\n", max_size=16)
+
+        assert framer.feed(b"+1.25\r") == []
+        assert framer.feed(b"\n-2.00\r\n+3") == [b"+1.25\r\n", b"-2.00\r\n"]
+        assert framer.feed(b"x" * 20) == []
+        assert framer.errors == 1
+
+
+@needs_pty
+class TestSerialReactor:
+    """Test suite for the selector reactor"""
+
+    def test_requests_on_two_ports_complete_independently(self, reactor):
+        loadcell = PtyDevice(lambda data: b"+" + data.strip() + b"\r\n")
+        scale = PtyDevice(lambda data: b"OK\r\n")
+        try:
+            reactor.add_port("loadcell", loadcell.port, TerminatorFramer(b"\r\n"))
+            reactor.add_port("scale", scale.port, TerminatorFramer(b"\r\n"))
+
+            first = reactor.request("loadcell", b"1R\r\n")
+            second = reactor.request("scale", b"Z\r\n")
+            frame = first.result(timeout=1.0)
+
+            assert frame.data == b"+1R\r\n"
+            assert frame.port == "loadcell"
+            assert second.result(timeout=1.0).data == b"OK\r\n"
+            assert frame.timestamp <= time.monotonic()
+            stats = reactor.get_statistics()
+            assert stats["loadcell"]["frames"] == 1
+            assert stats["loadcell"]["last_round_trip"] < 1.0
+        finally:
+            reactor.remove_port("loadcell")
+            reactor.remove_port("scale")
+            loadcell.close()
+            scale.close()
+
+    def test_status_matching_with_lma_scanner_and_listeners(self, reactor):
+        mcu = PtyDevice(lambda data: encode_frame(0x0B) + encode_frame(data[2]))
+        seen = []
+        try:
+            reactor.add_port("mcu", mcu.port, LMAFrameScanner())
+            reactor.add_listener("mcu", lambda frame: seen.append(frame.data[2]))
+
+            future = reactor.request(
+                "mcu", encode_frame(0x05), match=lambda frame: frame[2] == 0x05
+            )
+
+            assert future.result(timeout=1.0).data == encode_frame(0x05)
+            deadline = time.monotonic() + 1.0
+            while len(seen) < 2 and time.monotonic() < deadline:
+                time.sleep(0.001)  # Listeners run after the future is resolved
+            assert seen == [0x0B, 0x05]
+            assert reactor.get_statistics()["mcu"]["unmatched"] == 1
+        finally:
+            reactor.remove_port("mcu")
+            mcu.close()
+
+    def test_deadline_fails_the_future(self, reactor):
+        silent = PtyDevice(lambda data: b"")
+        try:
+            reactor.add_port("silent", silent.port, TerminatorFramer())
+
+            future = reactor.request("silent", b"?\r", timeout=0.05)
+
+            with pytest.raises(SerialTimeoutError):
+                future.result(timeout=1.0)
+            assert reactor.get_statistics()["silent"]["timeouts"] == 1
+        finally:
+            reactor.remove_port("silent")
+            silent.close()
+
+    def test_port_closed_right_after_removal(self, reactor):
+        """remove_port() returns after the unregister, so closing at once is safe"""
+        other = PtyDevice(lambda data: b"OK\r")
+        try:
+            reactor.add_port("other", other.port, TerminatorFramer())
+            for index in range(20):
+                device = PtyDevice(lambda data: b"")
+                reactor.add_port(f"device{index}", device.port, TerminatorFramer())
+                reactor.remove_port(f"device{index}")
+                device.close()
+
+            assert reactor.is_running
+            assert reactor.request("other", b"?\r").result(timeout=1.0).data == b"OK\r"
+        finally:
+            reactor.remove_port("other")
+            other.close()
+
+    def test_failing_framer_does_not_stop_the_reactor(self, reactor):
+        class BrokenFramer:
+            def feed(self, data):
+                raise RuntimeError("framer bug")
+
+        broken = PtyDevice(lambda data: b"x")
+        other = PtyDevice(lambda data: b"OK\r")
+        try:
+            reactor.add_port("broken", broken.port, BrokenFramer())
+            reactor.add_port("other", other.port, TerminatorFramer())
+
+            lost = reactor.request("broken", b"?", timeout=0.05)
+
+            with pytest.raises(SerialTimeoutError):
+                lost.result(timeout=1.0)
+            assert reactor.is_running
+            assert reactor.request("other", b"?\r").result(timeout=1.0).data == b"OK\r"
+        finally:
+            reactor.remove_port("broken")
+            reactor.remove_port("other")
+            broken.close()
+            other.close()
+
+    @pytest.mark.asyncio
+    async def test_request_async(self, reactor):
+        device = PtyDevice(lambda data: b"ACK\r")
+        try:
+            reactor.add_port("device", device.port, TerminatorFramer())
+
+            frame = await reactor.request_async("device", b"PING\r")
+
+            assert frame.data == b"ACK\r"
+        finally:
+            reactor.remove_port("device")
+            device.close()
+
+
+class TestThreadedPorts:
+    """Test suite for the reader thread backend"""
+
+    def test_unselectable_port_gets_a_reader_thread(self, reactor):
+        device = MemoryDevice(lambda data: b"+" + data.strip() + b"\r\n")
+        silent = MemoryDevice(lambda data: b"")
+        try:
+            reactor.add_port("loadcell", device, TerminatorFramer(b"\r\n"))
+            reactor.add_port("silent", silent, TerminatorFramer(b"\r\n"))
+
+            frame = reactor.request("loadcell", b"1R\r\n").result(timeout=1.0)
+            lost = reactor.request("silent", b"1R\r\n", timeout=0.05)
+
+            assert frame.data == b"+1R\r\n"
+            with pytest.raises(SerialTimeoutError):
+                lost.result(timeout=1.0)
+            stats = reactor.get_statistics()
+            assert stats["loadcell"]["backend"] == "thread"
+            assert stats["silent"]["timeouts"] == 1
+        finally:
+            reactor.remove_port("loadcell")
+            reactor.remove_port("silent")
+
+        assert reactor.get_statistics() == {}
+
+    @needs_pty
+    def test_threaded_backend_on_a_real_port(self, reactor):
+        device = PtyDevice(lambda data: b"ACK\r")
+        try:
+            reactor.add_port("device", device.port, TerminatorFramer(), threaded=True)
+
+            frame = reactor.request("device", b"PING\r").result(timeout=1.0)
+
+            assert frame.data == b"ACK\r"
+            assert reactor.get_statistics()["device"]["backend"] == "thread"
+        finally:
+            reactor.remove_port("device")
+            device.close()
@@ -0,0 +1,173 @@
+"""
+Thermal Settle Detector Tests
+
+Tests for the online step response fit, time-to-band prediction and the
+settle signal, standalone and through LMAMCU on an emulated MCU whose
+temperature follows a first-order step.
+"""
+
+# Standard library imports
+import math
+import struct
+import threading
+import time
+
+# Third-party imports
+import numpy as np
+import pytest
+
+# Local application imports
+from infrastructure.implementation.hardware.mcu.lma import lma_mcu
+from infrastructure.implementation.hardware.mcu.lma.lma_mcu import LMAMCU
+from infrastructure.implementation.hardware.mcu.lma.thermal_settle import ThermalSettleDetector
+from infrastructure.implementation.hardware.mcu.lma.transport import LMAFrame, encode_frame
+
+
+def _step(t: float, start: float, final: float, tau: float) -> float:
+    return final + (start - final) * math.exp(-t / tau)
+
+
+class ThermalMCUPort:
+    """Emulated MCU whose IR temperature follows a first-order step from creation"""
+
+    def __init__(self, start=25.0, final=60.0, tau=0.6, **settings):
+        self.timeout = settings.get("timeout", 1.0)
+        self.is_open = True
+        self.requests = 0
+        self._curve = (start, final, tau)
+        self._origin = time.monotonic()
+        self._rx = bytearray()
+        self._cond = threading.Condition()
+
+    @property
+    def in_waiting(self) -> int:
+        with self._cond:
+            return len(self._rx)
+
+    def write(self, data: bytes) -> int:
+        if data[2] == 0x07:
+            self.requests += 1
+            temp = _step(time.monotonic() - self._origin, *self._curve)
+            reply = encode_frame(0x07, struct.pack(">II", round(temp * 10), 240))
+        else:
+            reply = encode_frame(data[2])
+        with self._cond:
+            self._rx += reply
+            self._cond.notify()
+        return len(data)
+
+    def read(self, size: int = 1) -> bytes:
+        with self._cond:
+            if not self._rx:
+                self._cond.wait(self.timeout)
+            data = bytes(self._rx[:size])
+            del self._rx[:size]
+            return data
+
+    def close(self) -> None:
+        self.is_open = False
+
+
+class TestThermalSettleDetector:
+    """Test suite for the online step response fit"""
+
+    def test_first_order_step_predicts_and_settles_on_time(self):
+        rng = np.random.default_rng(7)
+        detector = ThermalSettleDetector(target=60.0, tolerance=1.0)
+        band_time = 8.0 * math.log(35.0)  # |25 - 60| * exp(-t / 8) = 1
+
+        settled_time = None
+        for index in range(400):
+            t = index * 0.25
+            temp = round(_step(t, 25.0, 60.0, 8.0) + rng.normal(0.0, 0.05), 1)
+            estimate = detector.update(100.0 + t, temp)
+            if t == 10.0:
+                assert estimate.time_to_band == pytest.approx(band_time - t, abs=2.0)
+                assert not estimate.settled
+            if detector.is_settled:
+                settled_time = t
+                break
+
+        assert band_time <= settled_time <= band_time + 2.0
+        assert detector.settled_at == pytest.approx(100.0 + settled_time)
+        assert detector.estimate().final_temperature == pytest.approx(60.0, abs=0.1)
+        assert detector.estimate().time_constants[0] == pytest.approx(8.0, rel=0.1)
+
+    def test_second_order_response_fits_final_temperature(self):
+        detector = ThermalSettleDetector(target=80.0, tolerance=0.5, order=2)
+        for index in range(120):
+            t = index * 0.5
+            temp = 80.0 - 40.0 * math.exp(-t / 3.0) - 15.0 * math.exp(-t / 20.0)
+            estimate = detector.update(t, temp)
+
+        assert estimate.final_temperature == pytest.approx(80.0, abs=0.2)
+        assert sorted(estimate.time_constants) == pytest.approx([3.0, 20.0], rel=0.15)
+
+    def test_unreachable_target_never_settles(self):
+        detector = ThermalSettleDetector(target=60.0, tolerance=1.0)
+        for index in range(300):
+            t = index * 0.25
+            estimate = detector.update(t, round(_step(t, 25.0, 55.0, 8.0), 1))
+
+        assert not detector.is_settled
+        assert estimate.time_to_band is None
+        assert estimate.final_temperature == pytest.approx(55.0, abs=0.1)
+
+    @pytest.mark.asyncio
+    async def test_frames_are_fitted_by_the_waiter(self):
+        """on_frame() only records; wait_settled() fits in a worker thread"""
+        detector = ThermalSettleDetector(target=60.0, tolerance=1.0, order=2)
+        for index in range(40):
+            t = index * 0.5
+            temp = round(_step(t, 25.0, 60.0, 2.0) * 10)
+            raw = encode_frame(0x07, struct.pack(">II", temp, 240))
+            detector.on_frame(LMAFrame(0x07, raw, t))
+
+        assert detector.estimate() is None
+
+        estimate = await detector.wait_settled(timeout=2.0)
+
+        assert estimate.samples == 40
+        assert estimate.final_temperature == pytest.approx(60.0, abs=0.2)
+
+    def test_invalid_order_rejected(self):
+        with pytest.raises(ValueError):
+            ThermalSettleDetector(target=60.0, tolerance=1.0, order=3)
+
+
+class TestLMAMCUSettle:
+    """Test suite for LMAMCU.wait_temperature_settled over the transport"""
+
+    @pytest.mark.asyncio
+    async def test_wait_returns_once_step_settles(self, monkeypatch):
+        ports = []
+        fit_threads = set()
+        fit = ThermalSettleDetector._fit
+
+        def recording_fit(detector, data):
+            fit_threads.add(threading.current_thread().name)
+            return fit(detector, data)
+
+        monkeypatch.setattr(ThermalSettleDetector, "_fit", recording_fit)
+
+        def open_port(**settings):
+            ports.append(ThermalMCUPort(**settings))
+            return ports[-1]
+
+        monkeypatch.setattr(lma_mcu.serial, "Serial", open_port)
+        mcu = LMAMCU(port="COM9", baudrate=115200, timeout=1.0)
+        await mcu.connect()
+        try:
+            started = time.monotonic()
+            estimate = await mcu.wait_temperature_settled(
+                60.0, 1.0, timeout=5.0, request_interval=0.05
+            )
+            elapsed = time.monotonic() - started
+        finally:
+            await mcu.disconnect()
+
+        assert estimate.settled
+        assert estimate.final_temperature == pytest.approx(60.0, abs=0.3)
+        assert elapsed < 4.0
+        assert ports[0].requests >= estimate.samples
+        assert fit_threads and not any(name.startswith("Serial-Reactor") for name in fit_threads)